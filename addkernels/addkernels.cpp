@@ -25,6 +25,7 @@
  *******************************************************************************/
 #include "include_inliner.hpp"
 #include "miopen/filesystem.hpp"
+#include <bzlib.h>
 #include <algorithm>
 #include <fstream>
 #include <iomanip>
@@ -110,6 +111,9 @@ void PrintHelp()
     std::cout << "           -m[ark-includes] : mark variables that represent include files with "
                  "'_INCLUDE'. Default: off"
               << std::endl;
+    std::cout << "           -a[rchive] <variable>: store all the files bzip2-compressed in one "
+                 "archive array with an index. Default: one array per file"
+              << std::endl;
 }
 
 [[noreturn]] void WrongUsage(std::string_view error)
@@ -127,13 +131,7 @@ void PrintHelp()
     WrongUsage(ss.str());
 }
 
-void Process(const fs::path& sourcePath,
-             std::ostream& target,
-             size_t bufferSize,
-             size_t lineSize,
-             bool recurse,
-             bool as_extern,
-             bool mark_includes)
+void Inline(const fs::path& sourcePath, std::ostream& target, bool recurse)
 {
     if(!fs::exists(sourcePath))
     {
@@ -189,6 +187,22 @@ void Process(const fs::path& sourcePath,
         source = &inlinerTemp;
     }
 
+    // streaming an empty buffer sets failbit on the target
+    if(source->peek() != std::char_traits<char>::eof())
+        target << source->rdbuf();
+}
+
+void Process(const fs::path& sourcePath,
+             std::ostream& target,
+             size_t bufferSize,
+             size_t lineSize,
+             bool recurse,
+             bool as_extern,
+             bool mark_includes)
+{
+    std::stringstream source;
+    Inline(sourcePath, source, recurse);
+
     auto variable{sourcePath.stem().string()};
     std::transform(variable.begin(), variable.end(), variable.begin(), ::toupper);
 
@@ -200,7 +214,67 @@ void Process(const fs::path& sourcePath,
         variable = "MIOPEN_KERNEL_" + variable;
     }
 
-    Bin2Hex(*source, target, variable, true, bufferSize, lineSize);
+    Bin2Hex(source, target, variable, true, bufferSize, lineSize);
+}
+
+std::string Compress(const std::string& text, const fs::path& sourcePath)
+{
+    // bzip2 guarantees that 1% + 600 bytes is enough for incompressible data
+    std::string result(text.size() + text.size() / 100 + 600, '\0');
+    auto length = static_cast<unsigned int>(result.size());
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+    const auto status = BZ2_bzBuffToBuffCompress(result.data(),
+                                                 &length,
+                                                 const_cast<char*>(text.data()),
+                                                 static_cast<unsigned int>(text.size()),
+                                                 9,
+                                                 0,
+                                                 30);
+    // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+    if(status != BZ_OK)
+    {
+        std::cerr << "Error compressing file: " << sourcePath << " (" << status << ")"
+                  << std::endl;
+        // NOLINTNEXTLINE (concurrency-mt-unsafe)
+        std::exit(1);
+    }
+    result.resize(length);
+    return result;
+}
+
+void ProcessArchive(const std::vector<fs::path>& sourcePaths,
+                    std::ostream& target,
+                    const std::string& variable,
+                    size_t bufferSize,
+                    size_t lineSize,
+                    bool recurse)
+{
+    std::stringstream archive;
+    std::stringstream index;
+    size_t offset = 0;
+
+    for(const auto& sourcePath : sourcePaths)
+    {
+        std::stringstream source;
+        Inline(sourcePath, source, recurse);
+        const auto text       = source.str();
+        const auto compressed = Compress(text, sourcePath);
+
+        index << "    { \"" << sourcePath.filename().string() << "\", " << offset << ", "
+              << compressed.size() << ", " << text.size() << " },\n";
+
+        archive.write(compressed.data(), compressed.size());
+        offset += compressed.size();
+    }
+
+    Bin2Hex(archive, target, variable, false, bufferSize, lineSize);
+
+    target << std::setbase(10);
+    target << "extern const miopen::KernelArchiveEntry " << variable << "_INDEX[];\n";
+    target << "extern const size_t " << variable << "_INDEX_SIZE;\n";
+    target << "const miopen::KernelArchiveEntry " << variable << "_INDEX[] = {\n"
+           << index.str() << "};\n";
+    target << "const size_t " << variable << "_INDEX_SIZE = " << sourcePaths.size() << ";\n";
 }
 
 int main(int argc, char* argv[])
@@ -215,6 +289,7 @@ int main(int argc, char* argv[])
     // before running the algorithm.
 
     std::string guard;
+    std::string archive;
     size_t bufferSize = 512;
     size_t lineSize   = 16;
 
@@ -270,6 +345,10 @@ int main(int argc, char* argv[])
         {
             as_extern = true;
         }
+        else if(arg == "-a" || arg == "-archive")
+        {
+            archive = argv[++i];
+        }
         else
         {
             UnknownArgument(arg);
@@ -290,9 +369,17 @@ int main(int argc, char* argv[])
     ss << "#ifndef MIOPEN_USE_CLANG_TIDY\n"
           "#include <cstddef>\n";
 
-    for(const auto& file : sourceFiles)
+    if(!archive.empty())
     {
-        Process(file, ss, bufferSize, lineSize, recurse, as_extern, mark_includes);
+        ss << "#include <miopen/kernel_archive.hpp>\n";
+        ProcessArchive(sourceFiles, ss, archive, bufferSize, lineSize, recurse);
+    }
+    else
+    {
+        for(const auto& file : sourceFiles)
+        {
+            Process(file, ss, bufferSize, lineSize, recurse, as_extern, mark_includes);
+        }
     }
 
     ss << "#endif\n";
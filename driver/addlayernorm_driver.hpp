@@ -26,6 +26,7 @@
 #ifndef GUARD_MIOPEN_ADDLAYERNORM_DRIVER_HPP
 #define GUARD_MIOPEN_ADDLAYERNORM_DRIVER_HPP
 
+#include <../test/cpu_norm.hpp>
 #include <../test/tensor_holder.hpp>
 #include <../test/verify.hpp>
 #include "InputFlags.hpp"
@@ -69,26 +70,21 @@ int32_t mloAddLayerNormForwardRunHost(miopenTensorDescriptor_t inputDesc,
 
     int32_t ret = 0;
 
-    for(int32_t o = 0; o < outer_size; o++)
-    {
-        Tcheck pmean = 0.0f;
-        Tcheck pvar  = 0.0f;
-        for(int32_t i = 0; i < inner_size; i++)
-        {
-            Tcheck tmp = static_cast<Tcheck>(input[o * inner_size + i]) +
-                         static_cast<Tcheck>(input2[o * inner_size + i]);
-            pmean += tmp;
-            pvar += tmp * tmp;
-        }
+    const auto moments =
+        cpu_norm_moments(outer_size, 1, inner_size, [&](size_t o, size_t, size_t i) {
+            return static_cast<Tcheck>(input[o * inner_size + i]) +
+                   static_cast<Tcheck>(input2[o * inner_size + i]);
+        });
 
-        pmean        = pmean / inner_size;
-        pvar         = pvar / inner_size - pmean * pmean;
+    cpu_norm_for_each(outer_size, outer_size * inner_size, [&](size_t o) {
+        Tcheck pmean = static_cast<Tcheck>(moments[o].mean);
+        Tcheck pvar  = static_cast<Tcheck>(moments[o].variance());
         Tcheck prstd = 1.0f / sqrt(pvar + eps);
 
         meanhost[o] = pmean;
         rstdhost[o] = prstd;
 
-        for(int32_t i = 0; i < inner_size; i++)
+        for(size_t i = 0; i < inner_size; i++)
         {
             Tcheck pweight =
                 (mode == MIOPEN_ELEMENTWISE_AFFINE_FUSED_ADD) ? 1 : static_cast<Tcheck>(weight[i]);
@@ -100,7 +96,7 @@ int32_t mloAddLayerNormForwardRunHost(miopenTensorDescriptor_t inputDesc,
                     prstd * pweight +
                 pbias;
         }
-    }
+    });
     return ret;
 }
 
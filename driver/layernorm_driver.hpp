@@ -26,6 +26,7 @@
 #ifndef GUARD_MIOPEN_LAYERNORM_DRIVER_HPP
 #define GUARD_MIOPEN_LAYERNORM_DRIVER_HPP
 
+#include <../test/cpu_norm.hpp>
 #include <../test/tensor_holder.hpp>
 #include <../test/verify.hpp>
 #include "InputFlags.hpp"
@@ -68,25 +69,20 @@ int32_t mloLayerNormForwardRunHost(miopenTensorDescriptor_t inputDesc,
 
     int32_t ret = 0;
 
-    for(int32_t o = 0; o < outer_size; o++)
-    {
-        Tcheck pmean = 0.0f;
-        Tcheck pvar  = 0.0f;
-        for(int32_t i = 0; i < inner_size; i++)
-        {
-            Tcheck tmp = static_cast<Tcheck>(input[o * inner_size + i]);
-            pmean += tmp;
-            pvar += tmp * tmp;
-        }
+    const auto moments =
+        cpu_norm_moments(outer_size, 1, inner_size, [&](size_t o, size_t, size_t i) {
+            return static_cast<Tcheck>(input[o * inner_size + i]);
+        });
 
-        pmean        = pmean / inner_size;
-        pvar         = pvar / inner_size - pmean * pmean;
+    cpu_norm_for_each(outer_size, outer_size * inner_size, [&](size_t o) {
+        Tcheck pmean = static_cast<Tcheck>(moments[o].mean);
+        Tcheck pvar  = static_cast<Tcheck>(moments[o].variance());
         Tcheck prstd = 1.0f / sqrt(pvar + eps);
 
         meanhost[o] = pmean;
         rstdhost[o] = prstd;
 
-        for(int32_t i = 0; i < inner_size; i++)
+        for(size_t i = 0; i < inner_size; i++)
         {
             Tcheck pweight =
                 (mode == MIOPEN_ELEMENTWISE_AFFINE) ? 1 : static_cast<Tcheck>(weight[i]);
@@ -94,7 +90,7 @@ int32_t mloLayerNormForwardRunHost(miopenTensorDescriptor_t inputDesc,
             outputhost[o * inner_size + i] =
                 (static_cast<Tcheck>(input[o * inner_size + i]) - pmean) * prstd * pweight + pbias;
         }
-    }
+    });
     return ret;
 }
 
@@ -30,6 +30,8 @@
 #include <cmath>
 #include <iomanip>
 
+#include "../test/cpu_norm.hpp"
+
 #define MIO_HEIRARCH_SEL 0
 
 #if(MIO_HEIRARCH_SEL == 1)
@@ -62,98 +64,56 @@ int miopenBNFwdTrainPerActivationRunHost(
 {
 
     // C*H*W is also stored as in_nstride, H*W is in_cstride, W is in_hstride.
-    unsigned int index;
-    unsigned int adjIndex;
     unsigned int in_dstride = height * width;
     unsigned int in_cstride = depth * in_dstride;
     unsigned int in_nstride = channels * in_cstride;
 
-    Tref mean_accum     = static_cast<Tref>(0.);
-    Tref variance_accum = static_cast<Tref>(0.);
-    Tref elemStd        = static_cast<Tref>(0.);
+    // #1 calculate the mean and the variance of each activation over the mini_batch
+    // sigma^2 = (1/batch_mean) * sum( (x_i - batch_mean)^2 )
+    const auto moments = cpu_norm_moments(
+        in_nstride, 1, n_batchs, [&](std::size_t adjIndex, std::size_t, std::size_t bidx) {
+            return static_cast<Tref>(in_ptr[in_nstride * bidx + adjIndex]);
+        });
 
     int ret = 0;
-    for(int cidx = 0; cidx < channels; cidx++)
-    { // via channel
-        mean_accum     = static_cast<Tref>(0.);
-        variance_accum = static_cast<Tref>(0.);
-        // process the batch per channel
-        for(int didx = 0; didx < depth; didx++)
-        { // via depth
-            for(int row = 0; row < height; row++)
-            { // via rows
-                for(int column = 0; column < width; column++)
-                { // via columns
-                    mean_accum = static_cast<Tref>(0.);
-                    adjIndex   = in_cstride * cidx + in_dstride * didx + width * row + column;
-                    for(int bidx = 0; bidx < n_batchs; bidx++)
-                    { // via mini_batch
-                        index = in_nstride * bidx + adjIndex;
-                        // #1 calculate the mean
-                        // iterating through the stack of images in the mini_batch
-                        mean_accum += in_ptr[index];
-                    }
-                    mean_accum /= static_cast<Tref>(n_batchs);
-
-                    if(savemeanvar)
-                        saveMean[adjIndex] = mean_accum;
-                    if(runningmeanvar)
-                    {
-                        Tref newRunMean =
-                            runningMean[adjIndex] * (static_cast<Tref>(1) - expAvgFactor);
-                        runningMean[adjIndex] =
-                            mean_accum * expAvgFactor + newRunMean; // newMean*factor + tmp
-                    }
+    cpu_norm_for_each(in_nstride, in_nstride * n_batchs, [&](std::size_t adjIndex) {
+        Tref mean_accum     = static_cast<Tref>(moments[adjIndex].mean);
+        Tref variance_accum = static_cast<Tref>(moments[adjIndex].variance());
 
-                    elemStd        = static_cast<Tref>(0.);
-                    variance_accum = static_cast<Tref>(0.);
-                    // #2 calculate the variances
-                    // sigma^2 = (1/batch_mean) * sum( (x_i - batch_mean)^2 )
-                    for(int bidx = 0; bidx < n_batchs; bidx++)
-                    { // via mini_batch
-                        // per (x-dims) channel load a block of data into LDS
-                        index   = in_nstride * bidx + adjIndex;
-                        elemStd = in_ptr[index] -
-                                  mean_accum; // (x_i - mean) //this is reused but needs recalc
-                        variance_accum += elemStd * elemStd; // sum{ (x_i - mean)^2 }
-                    }                                        // end for(n)
-
-                    variance_accum /= static_cast<Tref>(n_batchs); // (1/N)*sum{ (x_i - mean)^2 }
+        if(savemeanvar)
+            saveMean[adjIndex] = mean_accum;
+        if(runningmeanvar)
+        {
+            Tref newRunMean = runningMean[adjIndex] * (static_cast<Tref>(1) - expAvgFactor);
+            runningMean[adjIndex] = mean_accum * expAvgFactor + newRunMean; // newMean*factor + tmp
 
-                    if(runningmeanvar)
-                    {
-                        // var(n+1) = p * var(n-1) + (1 - p)*(b/b-1)*var(n)
-                        Tref adjust = (n_batchs == 1)
-                                          ? variance_accum
+            // var(n+1) = p * var(n-1) + (1 - p)*(b/b-1)*var(n)
+            Tref adjust = (n_batchs == 1) ? variance_accum
                                           : (static_cast<Tref>(n_batchs) /
                                              static_cast<Tref>(n_batchs - 1) * variance_accum);
-                        runningVariance[adjIndex] =
-                            (static_cast<Tref>(1) - expAvgFactor) * runningVariance[cidx] +
-                            expAvgFactor * adjust;
-                    }
+            runningVariance[adjIndex] =
+                (static_cast<Tref>(1) - expAvgFactor) * runningVariance[adjIndex] +
+                expAvgFactor * adjust;
+        }
 
-                    // #3 add epsilon for numeric stability, sqr_root, and invert
-                    Tref elemInvVar = static_cast<Tref>(1.0) / sqrt(variance_accum + epsilon);
+        // #3 add epsilon for numeric stability, sqr_root, and invert
+        Tref elemInvVar = static_cast<Tref>(1.0) / sqrt(variance_accum + epsilon);
 
-                    if(savemeanvar)
-                        saveInvVariance[adjIndex] = elemInvVar; /*output only*/
+        if(savemeanvar)
+            saveInvVariance[adjIndex] = elemInvVar; /*output only*/
 
-                    // #4 apply the normalization
-                    // x_hat = (x_i - mean) / sqrt(variance_accum - epsilon)
-                    for(int bidx = 0; bidx < n_batchs; bidx++)
-                    { // via mini_batch
-                        index = in_nstride * bidx + adjIndex;
-                        // per (x-dims) channel load a block of data into LDS
-                        elemStd    = in_ptr[index] - mean_accum; // (x_i - mean)
-                        Tref inhat = elemStd * elemInvVar;
-                        // #5 Gamma and Beta adjust
-                        // y_i = gamma*x_hat + beta
-                        out_ptr[index] = scale_ptr[adjIndex] * inhat + bias_ptr[adjIndex];
-                    } // end for(n_batchs)
-                }     // for (column)
-            }         // for (row)
-        }             // for (depth)
-    }                 // for (channel)
+        // #4 apply the normalization
+        // x_hat = (x_i - mean) / sqrt(variance_accum - epsilon)
+        for(int bidx = 0; bidx < n_batchs; bidx++)
+        { // via mini_batch
+            unsigned int index = in_nstride * bidx + adjIndex;
+            Tref elemStd       = in_ptr[index] - mean_accum; // (x_i - mean)
+            Tref inhat         = elemStd * elemInvVar;
+            // #5 Gamma and Beta adjust
+            // y_i = gamma*x_hat + beta
+            out_ptr[index] = scale_ptr[adjIndex] * inhat + bias_ptr[adjIndex];
+        } // end for(n_batchs)
+    });
     return (ret);
 }
 
@@ -181,84 +141,22 @@ int miopenBNFwdTrainSpatialRunHost(
     Tref expAvgFactor)
 {
 
-    unsigned int imgIndex;
-    unsigned int index;
-    unsigned int adjIndex;
     unsigned int in_dstride = height * width;
     unsigned int in_cstride = depth * in_dstride;
     unsigned int in_nstride = channels * in_cstride;
     auto NHW                = static_cast<Tref>(in_cstride * n_batchs);
 
-    Tref elemStd        = static_cast<Tref>(0.);
-    Tref variance_accum = static_cast<Tref>(0.);
-    Tref mean_accum     = static_cast<Tref>(0.);
-
-#if(MIO_HEIRARCH_SEL == 1)
-    Tref variance_accum_arr[MIO_BN_DIST];
-    Tref mean_accum_arr[MIO_BN_DIST];
-#endif
+    // #1 calculate the mean and the variance of each channel over the mini_batch
+    // sigma^2 = (1/batch_mean) * sum( (x_i - batch_mean)^2 )
+    const auto moments = cpu_norm_moments(
+        channels, n_batchs, in_cstride, [&](std::size_t cidx, std::size_t bidx, std::size_t i) {
+            return static_cast<Tref>(in_ptr[in_nstride * bidx + in_cstride * cidx + i]);
+        });
 
     int ret = 0;
-    for(int cidx = 0; cidx < channels; cidx++)
-    { // via channel
-        mean_accum = static_cast<Tref>(0.);
-#if(MIO_HEIRARCH_SEL == 1)
-        for(int i = 0; i < MIO_BN_DIST; i++)
-        {
-            variance_accum_arr[i] = static_cast<Tref>(0.);
-            mean_accum_arr[i]     = static_cast<Tref>(0.);
-        }
-#endif
-
-#if(MIO_HEIRARCH_SEL == 0)
-        // process the batch per channel
-        for(int didx = 0; didx < depth; didx++)
-        { // depth
-            for(int row = 0; row < height; row++)
-            { // via rows
-                for(int column = 0; column < width; column++)
-                { // via columns
-                    imgIndex = width * row + column;
-                    adjIndex = in_cstride * cidx + in_dstride * didx + imgIndex;
-                    if(imgIndex < in_cstride)
-                    {
-                        for(int bidx = 0; bidx < n_batchs; bidx++)
-                        { // via mini_batch
-                            index = in_nstride * bidx + adjIndex;
-                            // #1 calculate the mean
-                            // iterating through the stack of images in the mini_batch
-                            mean_accum += in_ptr[index];
-                            // mean_accum += 1;
-                        } // end for (n)
-                    }
-                } // end for (column)
-            }     // end for (row)
-        }         // end for (depth)
-#else
-        for(int im = 0; im < in_cstride; im += MIO_BN_DIST)
-        {
-            for(int i = 0; i < MIO_BN_DIST; i++)
-            {
-                imgIndex = im + i;
-                adjIndex = in_cstride * cidx + imgIndex;
-                if(imgIndex < in_cstride)
-                {
-                    for(int bidx = 0; bidx < n_batchs; bidx++)
-                    { // via mini_batch
-                        index = in_nstride * bidx + adjIndex;
-                        // #1 calculate the mean
-                        // iterating through the stack of images in the mini_batch
-                        mean_accum_arr[i] += in_ptr[index];
-                    } // end for (n)
-                }
-            }
-        }
-        for(int i = 0; i < MIO_BN_DIST; i++)
-        {
-            mean_accum += mean_accum_arr[i];
-        }
-#endif
-        mean_accum /= static_cast<Tref>(NHW);
+    cpu_norm_for_each(channels, in_nstride * n_batchs, [&](std::size_t cidx) {
+        Tref mean_accum     = static_cast<Tref>(moments[cidx].mean);
+        Tref variance_accum = static_cast<Tref>(moments[cidx].variance());
 
         if(savemeanvar)
             saveMean[cidx] = mean_accum;
@@ -266,72 +164,7 @@ int miopenBNFwdTrainSpatialRunHost(
         {
             Tref newRunMean   = runningMean[cidx] * (static_cast<Tref>(1) - expAvgFactor);
             runningMean[cidx] = mean_accum * expAvgFactor + newRunMean; // newMean*factor + tmp
-        }
 
-        elemStd        = static_cast<Tref>(0.);
-        variance_accum = static_cast<Tref>(0.);
-#if(MIO_HEIRARCH_SEL == 0)
-        // #2 calculate the variances
-        // sigma^2 = (1/batch_mean) * sum( (x_i - batch_mean)^2 )
-        for(int didx = 0; didx < depth; didx++)
-        { // depth
-            for(int row = 0; row < height; row++)
-            { // via rows
-                for(int column = 0; column < width; column++)
-                { // via columns
-                    imgIndex = width * row + column;
-                    adjIndex = in_cstride * cidx + imgIndex;
-                    if(imgIndex < in_cstride)
-                    {
-                        for(int bidx = 0; bidx < n_batchs; bidx++)
-                        { // via mini_batch
-                            // per (x-dims) channel load a block of data into LDS
-                            index = in_nstride * bidx + adjIndex;
-
-                            // using out buffer as scratchpad
-                            out_ptr[index] = elemStd =
-                                (in_ptr[index] -
-                                 mean_accum); // (x_i - mean) //this is reused but needs recalc
-                            variance_accum += (elemStd * elemStd); // sum{ (x_i - mean)^2 }
-                        }                                          // end for(n)
-                    }
-                } // end for (column)
-            }     // end for (row)
-        }         // end for (depth)
-
-#else
-        for(int im = 0; im < in_cstride; im += MIO_BN_DIST)
-        {
-            for(int i = 0; i < MIO_BN_DIST; i++)
-            {
-                imgIndex = im + i;
-                adjIndex = in_cstride * cidx + imgIndex;
-                if(imgIndex < in_cstride)
-                {
-                    for(int bidx = 0; bidx < n_batchs; bidx++)
-                    { // via mini_batch
-                        // per (x-dims) channel load a block of data into LDS
-                        index = in_nstride * bidx + adjIndex;
-
-                        // using out buffer as scratchpad
-                        elemStd = (in_ptr[index] -
-                                   mean_accum); // (x_i - mean) //this is reused but needs recalc
-                        variance_accum_arr[i] += (elemStd * elemStd); // sum{ (x_i - mean)^2 }
-                    }
-                }
-            }
-        } // end for (row)
-        for(int i = 0; i < MIO_BN_DIST; i++)
-        {
-            variance_accum += variance_accum_arr[i];
-        }
-#endif
-
-        variance_accum /= static_cast<Tref>(NHW); // (1/N)*sum{ (x_i - mean)^2 }
-        // printf("Variance sum on host: %f\n",variance_accum);
-
-        if(runningmeanvar)
-        {
             Tref adjust =
                 (n_batchs * in_cstride == 1)
                     ? variance_accum
@@ -343,40 +176,23 @@ int miopenBNFwdTrainSpatialRunHost(
         // #3 add epsilon for numeric stability, sqr_root, and invert
         Tref invertVar = static_cast<Tref>(1.0) / sqrt(variance_accum + epsilon);
 
-        // printf("invVar on host: %lf\n",invertVar);
-
         if(savemeanvar)
             saveInvVariance[cidx] = invertVar; /*output only*/
 
         // #4 apply the normalization
         // x_hat = (x_i - mean) / sqrt(variance_accum + epsilon)
-        for(int didx = 0; didx < depth; didx++)
-        { // depth
-
-            for(int row = 0; row < height; row++)
-            { // via rows
-                for(int column = 0; column < width; column++)
-                { // via columns
-                    imgIndex = width * row + column;
-                    adjIndex = in_cstride * cidx + imgIndex;
-                    if(imgIndex < in_cstride)
-                    {
-                        for(int bidx = 0; bidx < n_batchs; bidx++)
-                        { // via mini_batch
-                            index = in_nstride * bidx + adjIndex;
-                            // per (x-dims) channel load a block of data into LDS
-                            // elemStd =(in_ptr[index] - mean_accum);
-                            // Tref inhat = elemStd*invertVar;
-                            // #5 Gamma and Beta adjust
-                            // y_i = gamma*x_hat + beta
-                            out_ptr[index] =
-                                (scale_ptr[cidx] * (invertVar * out_ptr[index])) + bias_ptr[cidx];
-                        } // end for(n_batchs)
-                    }
-                } // for (column)
-            }     // for (row)
-        }         // for (depth)
-    }             // for (channel)
+        for(int bidx = 0; bidx < n_batchs; bidx++)
+        { // via mini_batch
+            for(unsigned int i = 0; i < in_cstride; i++)
+            { // via depth, rows and columns
+                unsigned int index = in_nstride * bidx + in_cstride * cidx + i;
+                // #5 Gamma and Beta adjust
+                // y_i = gamma*x_hat + beta
+                out_ptr[index] =
+                    (scale_ptr[cidx] * (invertVar * (in_ptr[index] - mean_accum))) + bias_ptr[cidx];
+            }
+        } // end for(n_batchs)
+    });
     return (ret);
 }
 
@@ -28,6 +28,8 @@
 
 #include <miopen/tensor.hpp>
 
+#include "../test/cpu_norm.hpp"
+
 ////////////////////////////////////////////////////////////
 //
 ///////////////////////////////////////////////////////////
@@ -53,19 +55,14 @@ int32_t mloGroupNormForwardRunHost(miopenTensorDescriptor_t inputDesc,
     size_t outer_size = dims[0] * num_groups;
     size_t inner_size = numel / outer_size;
 
-    for(size_t o = 0; o < outer_size; o++)
-    {
-        Tcheck pmean = 0.0f;
-        Tcheck pvar  = 0.0f;
-        for(size_t i = 0; i < inner_size; i++)
-        {
-            Tcheck tmp = static_cast<Tcheck>(input[o * inner_size + i]);
-            pmean += tmp;
-            pvar += tmp * tmp;
-        }
+    const auto moments =
+        cpu_norm_moments(outer_size, 1, inner_size, [&](size_t o, size_t, size_t i) {
+            return static_cast<Tcheck>(input[o * inner_size + i]);
+        });
 
-        pmean        = pmean / inner_size;
-        pvar         = pvar / inner_size - pmean * pmean;
+    cpu_norm_for_each(outer_size, numel, [&](size_t o) {
+        Tcheck pmean = static_cast<Tcheck>(moments[o].mean);
+        Tcheck pvar  = static_cast<Tcheck>(moments[o].variance());
         Tcheck prstd = 1.0f / sqrt(pvar + eps);
 
         meanhost[o] = pmean;
@@ -80,7 +77,7 @@ int32_t mloGroupNormForwardRunHost(miopenTensorDescriptor_t inputDesc,
 
             outputhost[idx] = (static_cast<Tcheck>(input[idx]) - pmean) * prstd * pweight + pbias;
         }
-    }
+    });
 
     return 0;
 }
@@ -26,6 +26,7 @@
 #ifndef GUARD_MIOPEN_T5LAYERNORM_DRIVER_HPP
 #define GUARD_MIOPEN_T5LAYERNORM_DRIVER_HPP
 
+#include <../test/cpu_norm.hpp>
 #include <../test/tensor_holder.hpp>
 #include <../test/verify.hpp>
 #include "InputFlags.hpp"
@@ -61,21 +62,20 @@ int32_t mloT5LayerNormForwardRunHost(miopenTensorDescriptor_t xDesc,
 
     int32_t ret = 0;
 
-    for(int32_t o = 0; o < outer_size; o++)
-    {
-        Tcheck pvar = static_cast<Tcheck>(0);
-        for(int32_t i = 0; i < inner_size; i++)
-        {
+    // Only the mean of the squares is needed.
+    const auto moments =
+        cpu_norm_moments(outer_size, 1, inner_size, [&](size_t o, size_t, size_t i) {
             Tcheck tmp = static_cast<Tcheck>(x[o * inner_size + i]);
-            pvar += tmp * tmp;
-        }
+            return tmp * tmp;
+        });
 
-        pvar         = pvar / inner_size;
+    cpu_norm_for_each(outer_size, outer_size * inner_size, [&](size_t o) {
+        Tcheck pvar  = static_cast<Tcheck>(moments[o].mean);
         Tcheck prstd = static_cast<Tcheck>(1.0) / sqrt(pvar + eps);
 
         rstdhost[o] = prstd;
 
-        for(int32_t i = 0; i < inner_size; i++)
+        for(size_t i = 0; i < inner_size; i++)
         {
             Tcheck pweight = (mode == MIOPEN_ELEMENTWISE_AFFINE_T5)
                                  ? static_cast<Tcheck>(1)
@@ -83,7 +83,7 @@ int32_t mloT5LayerNormForwardRunHost(miopenTensorDescriptor_t xDesc,
             yhost[o * inner_size + i] =
                 (static_cast<Tcheck>(x[o * inner_size + i])) * prstd * pweight;
         }
-    }
+    });
     return ret;
 }
 
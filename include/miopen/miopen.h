@@ -266,6 +266,59 @@ MIOPEN_EXPORT miopenStatus_t miopenGetKernelTime(miopenHandle_t handle, float* t
  * @return           miopenStatus_t
  */
 MIOPEN_EXPORT miopenStatus_t miopenEnableProfiling(miopenHandle_t handle, bool enable);
+
+#ifdef MIOPEN_BETA_API
+/*! @enum miopenLookupSource_t
+ * Databases and caches whose lookups are counted.
+ */
+typedef enum
+{
+    miopenLookupFindDb            = 0, /*!< Find-db records */
+    miopenLookupPerfDb            = 1, /*!< Perf-db records (tuned performance configs) */
+    miopenLookupKernelDb          = 2, /*!< Cached kernel binaries */
+    miopenLookupInvokerCache      = 3, /*!< Invokers kept by the handle */
+    miopenLookupProgramCache      = 4, /*!< Programs loaded by the handle */
+    miopenLookupHeuristicFallback = 5, /*!< Immediate mode fallback. Hits are the rankings
+                                            done by the AI heuristic, misses by WTI */
+    miopenLookupCompileFallback   = 6, /*!< Asynchronous compilation in immediate mode. Hits are
+                                            the calls served by a fallback solution, misses the
+                                            calls which waited for the build, stores the
+                                            finished builds */
+} miopenLookupSource_t;
+
+/*! @brief Lookup counters of a database or a cache
+ */
+typedef struct
+{
+    uint64_t hits;       /*!< Lookups which found the entry */
+    uint64_t misses;     /*!< Lookups which did not find the entry */
+    uint64_t stores;     /*!< Entries stored or updated */
+    uint64_t latency_ns; /*!< Time spent in the counted lookups and stores in nanoseconds */
+} miopenLookupCounters_t;
+
+/*! @brief Get the lookup counters of a database or a cache
+ *
+ * Lookups are counted per handle and for the whole process. The counters of the process include
+ * the lookups done on behalf of all the handles as well as the ones done without a handle.
+ * Setting MIOPEN_DUMP_LOOKUP_COUNTERS prints the counters when the handles are destroyed and at
+ * exit.
+ *
+ * @param handle     MIOpen handle, or NULL for the counters of the process (input)
+ * @param source     Database or cache to get the counters of (input)
+ * @param counters   Pointer to the counters (output)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenGetLookupCounters(miopenHandle_t handle,
+                                                     miopenLookupSource_t source,
+                                                     miopenLookupCounters_t* counters);
+
+/*! @brief Reset the lookup counters of all the databases and caches to zero
+ *
+ * @param handle     MIOpen handle, or NULL to reset the counters of the process (input)
+ * @return           miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenResetLookupCounters(miopenHandle_t handle);
+#endif // MIOPEN_BETA_API
 /** @} */
 // CLOSEOUT HANDLE DOXYGEN GROUP
 
@@ -6007,6 +6060,94 @@ MIOPEN_EXPORT miopenStatus_t miopenGetSolverIdConvAlgorithm(uint64_t solverId,
 
 #ifdef MIOPEN_BETA_API
 
+/*! @brief The miopenBoundSolution object is a solution with its tensor descriptors fixed, which
+ * only takes buffers when run.
+ */
+MIOPEN_DECLARE_OBJECT(miopenBoundSolution);
+
+/*! @brief Binds the solution to the tensor descriptors for repeated execution with different
+ * buffers. Descriptors are resolved and validated and the kernels are prepared once, so running
+ * the bound solution has less host overhead than miopenRunSolution.
+ *
+ * @param handle        Handle to prepare the kernels with
+ * @param solution      Solution to bind
+ * @param nInputs       Amount of tensor arguments of the solution
+ * @param tensors       Tensor arguments. Buffers are ignored, and descriptors may be null to use
+ * the ones stored in the solution
+ * @param boundSolution Pointer to the bound solution to create
+ * @return              miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenBindSolution(miopenHandle_t handle,
+                                                miopenSolution_t solution,
+                                                size_t nInputs,
+                                                const miopenTensorArgument_t* tensors,
+                                                miopenBoundSolution_t* boundSolution);
+
+/*! @brief Runs the bound solution using the passed in buffers. The bound solution is not
+ * modified, so it may be run from several threads at once, each with its own handle.
+ *
+ * @param handle        Handle to execute the kernels
+ * @param boundSolution Bound solution to execute
+ * @param nBuffers      Amount of buffers, must be equal to nInputs passed to miopenBindSolution
+ * @param buffers       Buffers in the order of the tensors passed to miopenBindSolution
+ * @param workspace     Pointer to device buffer used as workspace. May be null when not required.
+ * Should not be less than expected
+ * @param workspaceSize Size of the workspace buffer
+ * @return              miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenRunBoundSolution(miopenHandle_t handle,
+                                                    miopenBoundSolution_t boundSolution,
+                                                    size_t nBuffers,
+                                                    void* const* buffers,
+                                                    void* workspace,
+                                                    size_t workspaceSize);
+
+/*! @brief Destroys bound solution object.
+ *
+ * @param boundSolution Bound solution to destroy
+ * @return              miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenDestroyBoundSolution(miopenBoundSolution_t boundSolution);
+
+/*! @brief Saves several solutions into a single bundle file.
+ *
+ * Code objects are stored once per distinct content, so kernels shared between the solutions do
+ * not increase the size of the bundle. Unlike miopenSaveSolution the solutions are streamed to the
+ * file without building an intermediate buffer.
+ *
+ * @param path         Path of the bundle file to write
+ * @param solutions    Solutions to save
+ * @param numSolutions Amount of solutions to save
+ * @return             miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenSaveSolutionBundle(const char* path,
+                                                      const miopenSolution_t* solutions,
+                                                      size_t numSolutions);
+
+/*! @brief Reads the amount of solutions stored in a bundle file.
+ *
+ * @param path         Path of the bundle file
+ * @param numSolutions Pointer to a location where to write the amount of solutions
+ * @return             miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenGetSolutionBundleSize(const char* path, size_t* numSolutions);
+
+/*! @brief Loads solutions from a bundle file.
+ *
+ * The code objects are loaded directly from the memory mapped file, which stays mapped while any
+ * of the loaded solutions exists.
+ *
+ * @param path         Path of the bundle file
+ * @param solutions    Pointer to the first solution to load. Must not be null
+ * @param numSolutions Pointer to the amount of loaded solutions. Ignored if null
+ * @param maxSolutions Limits the amount of loaded solutions
+ * @return             miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t miopenLoadSolutionBundle(const char* path,
+                                                      miopenSolution_t* solutions,
+                                                      size_t* numSolutions,
+                                                      size_t maxSolutions);
+
 /*! @brief Initializes a problem object describing an activation operation.
  * @note As of now there is no way to actually get any solution for this kind of problems.
  *
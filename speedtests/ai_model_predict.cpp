@@ -0,0 +1,123 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/config.h>
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK || MIOPEN_ENABLE_AI_KERNEL_TUNING
+#include <miopen/conv/heuristics/ai_model.hpp>
+#include <miopen/db_path.hpp>
+
+#include <driver.hpp>
+#include "measure.hpp"
+
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace miopen {
+namespace {
+
+/// Measures the steady state latency of the AI heuristics: a TunaNet prediction, and a
+/// KernelTuningNet encoding followed by `tokens` decoder steps, for each installed binary model.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(iterations, "iterations");
+        add(tokens, "tokens");
+    }
+
+    void run()
+    {
+        for(const auto& entry : fs::directory_iterator{GetSystemDbPath()})
+        {
+            const auto name = entry.path().filename().string();
+            if(name.size() > 7 && name.compare(name.size() - 7, 7, ".tn.bin") == 0)
+                RunTunaNet(entry.path());
+            const auto encoder = name.find("_encoder.ktn.bin");
+            if(encoder != std::string::npos)
+                RunKernelTuningNet(entry.path(), name.substr(0, encoder));
+        }
+    }
+
+private:
+    int iterations = 1000;
+    int tokens     = 10;
+
+    void RunTunaNet(const fs::path& path) const
+    {
+        const auto network = ai::Network{path};
+        auto inputs        = std::vector<std::vector<float>>{};
+        for(const auto size : network.GetInputSizes())
+            inputs.emplace_back(size, 0.5f);
+
+        const auto predict = [&]() { std::ignore = network.Predict(inputs); };
+        // The first prediction of the thread allocates its workspace.
+        predict();
+        const auto time = speedtest::Measure(iterations, predict);
+        std::cout << path.filename() << ": " << time << " us" << std::endl;
+    }
+
+    void RunKernelTuningNet(const fs::path& path, const std::string& model) const
+    {
+        const auto encoder = ai::Network{path};
+        const auto decoder = ai::Network{path.parent_path() / (model + "_decoder.ktn.bin")};
+        auto inputs        = std::vector<std::vector<float>>{};
+        for(const auto size : encoder.GetInputSizes())
+            inputs.emplace_back(size, 0.5f);
+
+        const auto predict = [&]() {
+            auto context = encoder.Predict(inputs);
+            for(auto i = 0; i < tokens; ++i)
+            {
+                auto output =
+                    decoder.Predict({{1.0f}, context[0], context[1], context[2], context[3]});
+                context.assign(output.begin() + 1, output.end());
+            }
+        };
+        predict();
+        const auto time = speedtest::Measure(iterations, predict);
+        std::cout << model << ", encoder and " << tokens << " decoder steps: " << time << " us"
+                  << std::endl;
+    }
+};
+
+} // namespace
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::SpeedTestDriver>(argc, argv);
+    return 0;
+}
+#else
+#include <iostream>
+
+int main()
+{
+    std::cout << "MIOpen is built without the AI heuristics" << std::endl;
+    return 0;
+}
+#endif
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/config.h>
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK || MIOPEN_ENABLE_AI_KERNEL_TUNING
+#include <miopen/conv/heuristics/ai_model.hpp>
+#include <miopen/db_path.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <driver.hpp>
+#include "measure.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace miopen {
+namespace {
+
+/// Measures what the first TunaNet prediction of a process costs for each architecture: the
+/// metadata, then the model mapped from its binary form and run once, against the metadata and
+/// the JSON model parsed, which is the least the frugally-deep loader did before predicting.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver() { add(iterations, "iterations"); }
+
+    void run()
+    {
+        for(const auto& arch : {"gfx908", "gfx90a", "gfx942"})
+        {
+            const auto db        = GetSystemDbPath();
+            const auto metadata  = db / (std::string{arch} + "_metadata.tn.model");
+            const auto bin_path  = db / (std::string{arch} + ".tn.bin");
+            const auto json_path = db / (std::string{arch} + ".tn.model");
+            auto num_inputs      = std::size_t{0};
+            auto num_outputs     = std::size_t{0};
+
+            const auto bin_time = speedtest::Measure<std::milli>(iterations, [&]() {
+                num_inputs         = nlohmann::json::parse(std::ifstream{metadata})["num_inputs"];
+                const auto network = ai::Network{bin_path};
+                const auto outputs = network.Predict({std::vector<float>(num_inputs, 0.5f)});
+                num_outputs        = outputs.front().size();
+            });
+
+            const auto json_time = speedtest::Measure<std::milli>(iterations, [&]() {
+                num_inputs  = nlohmann::json::parse(std::ifstream{metadata})["num_inputs"];
+                std::ignore = nlohmann::json::parse(std::ifstream{json_path});
+            });
+
+            std::cout << arch << ": " << num_inputs << " inputs, " << num_outputs << " outputs"
+                      << std::endl;
+            std::cout << "  Binary model, first prediction: " << bin_time << " ms" << std::endl;
+            std::cout << "  JSON model, parse only: " << json_time << " ms" << std::endl;
+        }
+    }
+
+private:
+    int iterations = 10;
+};
+
+} // namespace
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::SpeedTestDriver>(argc, argv);
+    return 0;
+}
+#else
+#include <iostream>
+
+int main()
+{
+    std::cout << "MIOpen is built without the AI heuristics" << std::endl;
+    return 0;
+}
+#endif
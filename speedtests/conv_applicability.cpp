@@ -0,0 +1,150 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/problem_features.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/solver_id.hpp>
+
+#include <driver.hpp>
+#include "measure.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace miopen {
+namespace conv {
+namespace {
+
+struct ProblemSet
+{
+    std::vector<ProblemDescription> problems;
+
+    ProblemSet()
+    {
+        const auto conv_1x1 = ConvolutionDescriptor{{0, 0}, {1, 1}, {1, 1}};
+        const auto conv_3x3 = ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}};
+        const auto conv_3d  = ConvolutionDescriptor{{1, 1, 1}, {1, 1, 1}, {1, 1, 1}};
+
+        for(const auto type : {miopenFloat, miopenHalf, miopenBFloat16})
+        {
+            Add(conv_1x1, type, miopenTensorNCHW, {16, 64, 56, 56}, {64, 64, 1, 1});
+            Add(conv_3x3, type, miopenTensorNCHW, {16, 64, 56, 56}, {64, 64, 3, 3});
+            Add(conv_3x3, type, miopenTensorNHWC, {16, 64, 56, 56}, {64, 64, 3, 3});
+            Add(conv_3d, type, miopenTensorNDHWC, {4, 32, 8, 28, 28}, {32, 32, 3, 3, 3});
+        }
+    }
+
+private:
+    void Add(const ConvolutionDescriptor& conv,
+             miopenDataType_t type,
+             miopenTensorLayout_t layout,
+             const std::vector<std::size_t>& in,
+             const std::vector<std::size_t>& wei)
+    {
+        const auto x = TensorDescriptor{type, layout, in};
+        const auto w = TensorDescriptor{type, layout, wei};
+        const auto y = conv.GetForwardOutputTensorWithLayout(x, w, x.GetLayout_str(), type);
+
+        problems.emplace_back(x, w, y, conv, Direction::Forward);
+        problems.emplace_back(y, w, x, conv, Direction::BackwardData);
+        problems.emplace_back(y, w, x, conv, Direction::BackwardWeights);
+    }
+};
+
+/// Measures the host-side cost of finding all applicable convolution solvers,
+/// with and without rejecting solvers by their feature masks first.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver() { add(iterations, "iterations"); }
+
+    void run()
+    {
+        auto&& handle = get_handle();
+        const ProblemSet set;
+
+        std::vector<ExecutionContext> contexts;
+        for(const auto& problem : set.problems)
+        {
+            auto ctx = ExecutionContext{&handle};
+            problem.SetupFloats(ctx);
+            contexts.emplace_back(std::move(ctx));
+        }
+
+        std::vector<solver::AnySolver> solvers;
+        for(const auto& id : solver::GetSolversByPrimitive(solver::Primitive::Convolution))
+        {
+            auto solver = id.GetSolver();
+            if(!solver.IsEmpty())
+                solvers.emplace_back(std::move(solver));
+        }
+
+        const auto sweep = [&](bool prefilter) {
+            std::size_t applicable = 0;
+            for(std::size_t i = 0; i < set.problems.size(); ++i)
+            {
+                const auto& problem = set.problems[i];
+                const auto& ctx     = contexts[i];
+                const auto features = prefilter ? GetProblemFeatures(ctx, problem) : 0;
+
+                for(const auto& solver : solvers)
+                {
+                    if(!IsFeatureMatch(features, solver.GetFeatureMask()))
+                        continue;
+                    if(solver.IsApplicable(ctx, problem))
+                        ++applicable;
+                }
+            }
+            return applicable;
+        };
+
+        const auto full     = [&]() { return sweep(false); };
+        const auto filtered = [&]() { return sweep(true); };
+        const auto if_none  = "No applicable solvers";
+
+        const auto full_time     = speedtest::Measure(iterations, full, if_none);
+        const auto filtered_time = speedtest::Measure(iterations, filtered, if_none);
+
+        std::cout << "Problems: " << set.problems.size() << ", solvers: " << solvers.size()
+                  << ", iterations: " << iterations << std::endl;
+        std::cout << "IsApplicable only: " << full_time << " us per sweep" << std::endl;
+        std::cout << "Feature pre-filter: " << filtered_time << " us per sweep" << std::endl;
+    }
+
+private:
+    int iterations = 100;
+};
+
+} // namespace
+} // namespace conv
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::conv::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/binary_db_record.hpp>
+
+#include <driver.hpp>
+#include "measure.hpp"
+
+#include <iostream>
+#include <string>
+
+namespace miopen {
+namespace {
+
+/// Measures the cost of a single find-db lookup: parsing a text record and deserializing the
+/// values of one solver, compared to the lazy access to the binary encoding of the same record.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(iterations, "iterations");
+        add(solvers, "solvers");
+    }
+
+    void run()
+    {
+        auto line = std::string{"1-16-16-3x3-64-16-16-1-1x1-1x1-1x1-0-NCHW-FP32-F="};
+        for(auto i = 0; i < solvers; ++i)
+        {
+            if(i != 0)
+                line += ';';
+            line += "Solver" + std::to_string(i) + ":0." + std::to_string(1000 + i) + "," +
+                    std::to_string(i * 4096) + ",miopenConvolutionFwdAlgoDirect";
+        }
+
+        const auto id      = "Solver" + std::to_string(solvers / 2);
+        const auto payload = BinaryDbRecord::Encode(*BinaryDbRecord::ParseText(line));
+        auto found         = 0;
+
+        const auto text_time = speedtest::Measure(iterations, [&]() {
+            const auto record = BinaryDbRecord::ParseText(line);
+            auto values       = FindDbData{};
+            if(record && record->GetValues(id, values))
+                ++found;
+        });
+
+        const auto binary_time = speedtest::Measure(iterations, [&]() {
+            const auto record = BinaryDbRecord{payload};
+            auto values       = FindDbData{};
+            if(record.GetValues(id, values))
+                ++found;
+        });
+
+        std::cout << "Record: " << line.size() << " bytes as text, " << payload.size()
+                  << " bytes as binary, found " << found << " times" << std::endl;
+        std::cout << "Text parse and lookup: " << text_time << " us" << std::endl;
+        std::cout << "Binary lazy lookup: " << binary_time << " us" << std::endl;
+    }
+
+private:
+    int iterations = 100000;
+    int solvers    = 16;
+};
+
+} // namespace
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/db_text_parser.hpp>
+#include <miopen/load_file.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <driver.hpp>
+#include "measure.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+namespace miopen {
+namespace {
+
+/// Measures loading a synthetic text perf-db the way ReadonlyRamDb did it before, line by line
+/// through std::getline, against the mapped chunked parser on one and on all hardware threads.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(iterations, "iterations");
+        add(lines, "lines");
+    }
+
+    void run()
+    {
+        const auto dir  = TmpDir{"db_text_load"};
+        const auto path = dir.path / "synthetic.db.txt";
+        {
+            auto file = std::ofstream{path};
+            for(auto i = 0; i < lines; ++i)
+            {
+                file << "64-" << i << "-28-1x1-256-28-28-" << i % 64
+                     << "-0x0-1x1-1x1-0-NCHW-FP32-F=ConvHipImplicitGemmV4R1Fwd:" << i % 16
+                     << ",128,2,16,16,4,8,1;ConvAsm1x1U:1,8,2,64,2,4,1,8\n";
+            }
+        }
+
+        const auto file   = MappedFile{path};
+        const auto chunks = GetTextDbChunkCount(file.size());
+        auto records      = std::size_t{0};
+
+        const auto getline_time = speedtest::Measure<std::milli>(iterations, [&]() {
+            auto cache  = Cache{};
+            auto input  = std::ifstream{path};
+            auto line   = std::string{};
+            auto n_line = 0;
+            while(std::getline(input, line))
+            {
+                ++n_line;
+                const auto key_size = line.find('=');
+                if(line.empty() || key_size == std::string::npos || key_size == 0)
+                    continue;
+                const auto key      = line.substr(0, key_size);
+                const auto contents = line.substr(key_size + 1);
+                cache.emplace(key, CacheItem{n_line, contents});
+            }
+            records = cache.size();
+        });
+
+        const auto single_time = speedtest::Measure<std::milli>(iterations, [&]() {
+            auto cache = Cache{};
+            ParseTextDb(MappedFile{path}.view(), path, cache, 1);
+            records = cache.size();
+        });
+
+        const auto parallel_time = speedtest::Measure<std::milli>(iterations, [&]() {
+            auto cache = Cache{};
+            ParseTextDb(MappedFile{path}.view(), path, cache, chunks);
+            records = cache.size();
+        });
+
+        std::cout << "Database: " << lines << " lines, " << file.size() << " bytes, " << records
+                  << " records" << std::endl;
+        std::cout << "getline: " << getline_time << " ms" << std::endl;
+        std::cout << "Mapped, 1 chunk: " << single_time << " ms" << std::endl;
+        std::cout << "Mapped, " << chunks << " chunks: " << parallel_time << " ms" << std::endl;
+    }
+
+private:
+    struct CacheItem
+    {
+        int line;
+        std::string content;
+    };
+
+    using Cache = std::unordered_map<std::string, CacheItem>;
+
+    int iterations = 3;
+    int lines      = 2000000;
+};
+
+} // namespace
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::SpeedTestDriver>(argc, argv);
+    return 0;
+}
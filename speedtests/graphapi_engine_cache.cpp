@@ -0,0 +1,134 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/graphapi/engine_cache.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/pointwise.hpp>
+
+#include <driver.hpp>
+#include "measure.hpp"
+
+#include <deque>
+#include <iostream>
+
+namespace miopen {
+namespace graphapi {
+namespace {
+
+class NopExecutor : public GraphPatternExecutor
+{
+public:
+    void execute(miopenHandle_t, const VariantPack&) final {}
+    size_t getWorkspaceSize() const final { return 0; }
+    bool isReusable() const final { return true; }
+};
+
+/// A chain of pointwise ReLU ops, i.e. what a framework rebuilds on every step
+struct ChainGraph
+{
+    Pointwise mRelu{MIOPEN_POINTWISE_RELU_FWD, miopenFloat};
+    std::deque<Tensor> mTensors;
+    std::deque<OperationPointwise> mOps;
+
+    ChainGraph(std::size_t length, const std::vector<std::size_t>& dims)
+    {
+        const auto strides = TensorDescriptor{miopenFloat, dims}.GetStrides();
+        for(std::size_t i = 0; i <= length; ++i)
+        {
+            const bool is_virtual = i != 0 && i != length;
+            mTensors.emplace_back(miopenFloat, dims, strides, static_cast<int64_t>(i), is_virtual);
+        }
+        for(std::size_t i = 0; i < length; ++i)
+        {
+            mOps.emplace_back(&mRelu, &mTensors[i], &mTensors[i + 1]);
+        }
+    }
+
+    OpGraph build(miopenHandle_t handle)
+    {
+        OpGraphBuilder builder;
+        builder.setHandle(handle);
+        for(auto& op : mOps)
+            builder.addNode(&op);
+        return std::move(builder).build();
+    }
+};
+
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(iterations, "iterations");
+        add(length, "length");
+    }
+
+    void run()
+    {
+        auto handle = &get_handle();
+        ChainGraph chain{static_cast<std::size_t>(length), {16, 64, 56, 56}};
+        auto& cache = EngineCache::instance();
+
+        {
+            auto graph = chain.build(handle);
+            const std::vector<Engine> engines{EngineBuilder()
+                                                  .setGraph(&graph)
+                                                  .setExecutor(std::make_shared<NopExecutor>())
+                                                  .setGlobalIndex(0)
+                                                  .build()};
+            cache.store(EngineCache::makeKey(graph), engines);
+        }
+
+        const auto build = [&]() { return chain.build(handle).numNodes(); };
+        const auto hit   = [&]() {
+            auto graph   = chain.build(handle);
+            auto engines = cache.find(EngineCache::makeKey(graph), &graph);
+            return engines ? engines->size() : 0;
+        };
+
+        const auto build_time = speedtest::Measure(iterations, build, "Nothing was built");
+        const auto hit_time   = speedtest::Measure(iterations, hit, "Nothing was built");
+
+        std::cout << "Graph length: " << length << ", iterations: " << iterations << std::endl;
+        std::cout << "Build only: " << build_time << " us per graph" << std::endl;
+        std::cout << "Build and cache hit: " << hit_time << " us per graph" << std::endl;
+        std::cout << "Cache hits: " << cache.getHits() << ", misses: " << cache.getMisses()
+                  << std::endl;
+    }
+
+private:
+    int iterations = 10000;
+    int length     = 16;
+};
+
+} // namespace
+} // namespace graphapi
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::graphapi::SpeedTestDriver>(argc, argv);
+    return 0;
+}
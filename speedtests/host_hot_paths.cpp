@@ -0,0 +1,355 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/db.hpp>
+#include <miopen/env.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/pointwise.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/solution.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/tmp_dir.hpp>
+#if MIOPEN_ENABLE_SQLITE
+#include <miopen/kern_db.hpp>
+#endif
+
+#include <driver.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DEVICE_ARCH)
+
+namespace miopen {
+namespace {
+
+constexpr std::size_t DbRecords = 2000;
+
+std::string MakeDbKey(std::size_t i)
+{
+    return std::to_string(i % 64 + 1) + "-" + std::to_string(i / 64 % 32 + 7) + "-" +
+           std::to_string(i / 2048 + 7) + "-3x3-64-" + std::to_string(i % 13 + 5) +
+           "-5-1x1-1x1-1x1-0-NCHW-FP32-F";
+}
+
+/// Writes a text db with the same key format and record sizes as the installed ones.
+void WriteDb(const fs::path& path, const std::string& values)
+{
+    std::ofstream out{path};
+    for(std::size_t i = 0; i < DbRecords; ++i)
+        out << MakeDbKey(i) << '=' << values << '\n';
+}
+
+struct BenchmarkCase
+{
+    std::string name;
+    std::size_t ops; // per repetition
+    std::function<std::size_t()> body;
+};
+
+struct BenchmarkResult
+{
+    std::string name;
+    double ns_per_op;
+    double min_ns_per_op;
+};
+
+/// Host-side benchmark suite of the library hot paths, i.e. the work done on every call
+/// regardless of the GPU. Every case runs a fixed number of operations on fixed inputs, the
+/// result is the median time of the repetitions, so runs are comparable with each other.
+///
+/// With the HIPNOGPU backend, the device is defined by the `arch` argument.
+/// `output` writes the results as tab-separated "name ns_per_op min_ns_per_op" lines, which
+/// is also the format of `baseline`. Cases slower than the baseline by more than `tolerance`
+/// percent are reported and fail the run.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(repeats, "repeats");
+        add(scale, "scale");
+        add(arch, "arch");
+        add(output, "output");
+        add(baseline, "baseline");
+        add(tolerance, "tolerance");
+    }
+
+    void run()
+    {
+#if MIOPEN_MODE_NOGPU
+        if(env::value(MIOPEN_DEVICE_ARCH).empty())
+            env::update(MIOPEN_DEVICE_ARCH, arch);
+#endif
+        auto&& handle = get_handle();
+        const TmpDir dir{"host_hot_paths"};
+
+        // Inputs
+        const auto in_lengths  = std::vector<std::size_t>{16, 64, 56, 56};
+        const auto wei_lengths = std::vector<std::size_t>{64, 64, 3, 3};
+        const auto conv        = ConvolutionDescriptor{{1, 1}, {1, 1}, {1, 1}};
+        const auto x           = TensorDescriptor{miopenHalf, miopenTensorNHWC, in_lengths};
+        const auto w           = TensorDescriptor{miopenHalf, miopenTensorNHWC, wei_lengths};
+        const auto y           = conv.GetForwardOutputTensorWithLayout(x, w, "NHWC", miopenHalf);
+        const auto problem     = conv::ProblemDescription{x, w, y, conv, conv::Direction::Forward};
+
+        auto ctx = ExecutionContext{&handle};
+        problem.SetupFloats(ctx);
+
+        std::vector<solver::AnySolver> solvers;
+        for(const auto& id : solver::GetSolversByPrimitive(solver::Primitive::Convolution))
+        {
+            auto solver = id.GetSolver();
+            if(!solver.IsEmpty())
+                solvers.emplace_back(std::move(solver));
+        }
+
+        WriteDb(dir / "find.fdb.txt", "ConvDirectNaiveConvFwd:0.5,0,miopenConvolutionFwdAlgoDirect;"
+                                      "ConvBinWinograd3x3U:0.1,0,miopenConvolutionFwdAlgoWinograd");
+        WriteDb(dir / "perf.db.txt", "ConvAsm1x1U:2,8,4,16,1,4,1,4;ConvOclDirectFwd:1,8,8,4,2,1");
+        auto& find_db = ReadonlyRamDb::GetCached(DbKinds::FindDb, dir / "find.fdb.txt", true);
+        auto perf_db  = PlainTextDb{DbKinds::PerfDb, dir / "perf.db.txt"};
+
+#if MIOPEN_ENABLE_SQLITE
+        auto kern_db = KernDb{DbKinds::KernelDb, dir / "kern.kdb", false};
+        for(std::size_t i = 0; i < DbRecords / 10; ++i)
+        {
+            auto config        = KernelConfig{};
+            config.kernel_name = "kernel_" + std::to_string(i) + ".s.o";
+            config.kernel_args = " -mcpu=gfx90a -DMIOPEN_N=" + std::to_string(i);
+            config.kernel_blob = std::vector<char>(16 * 1024, static_cast<char>(i));
+            kern_db.StoreRecordUnsafe(config);
+        }
+#endif
+
+        const auto network_config = problem.MakeNetworkConfig();
+        const auto invoker_solver = solver::Id{"ConvDirectNaiveConvFwd"};
+        handle.RegisterInvoker([](const Handle&, const AnyInvokeParams&) {},
+                               network_config,
+                               invoker_solver.ToString());
+
+        graphapi::Pointwise relu{MIOPEN_POINTWISE_RELU_FWD, miopenFloat};
+        std::deque<graphapi::Tensor> graph_tensors;
+        std::deque<graphapi::OperationPointwise> graph_ops;
+        {
+            const auto dims    = std::vector<std::size_t>{16, 64, 56, 56};
+            const auto strides = TensorDescriptor{miopenFloat, dims}.GetStrides();
+            for(std::int64_t i = 0; i <= 8; ++i)
+                graph_tensors.emplace_back(miopenFloat, dims, strides, i, i != 0 && i != 8);
+            for(std::size_t i = 0; i < 8; ++i)
+                graph_ops.emplace_back(&relu, &graph_tensors[i], &graph_tensors[i + 1]);
+        }
+
+        auto solution = Solution{solver::Id{"ConvDirectNaiveConvFwd"}, 0.5f, 0};
+        {
+            auto solution_problem = Problem{};
+            solution_problem.SetOperatorDescriptor(conv);
+            solution_problem.SetDirection(miopenProblemDirectionForward);
+            solution_problem.RegisterTensorDescriptor(miopenTensorConvolutionX, x);
+            solution_problem.RegisterTensorDescriptor(miopenTensorConvolutionW, w);
+            solution_problem.RegisterTensorDescriptor(miopenTensorConvolutionY, y);
+            solution.SetProblem(ProblemContainer{solution_problem});
+            solution.SetPerfConfig("1,2,3");
+        }
+
+        // Cases
+        std::size_t key     = 0;
+        const auto next_key = [&]() { return MakeDbKey((key += 7) % DbRecords); };
+
+        const std::vector<BenchmarkCase> cases = {
+            {"tensor_descriptor", 10000, [&]() {
+                 return TensorDescriptor{miopenHalf, miopenTensorNHWC, in_lengths}.GetElementSize();
+             }},
+            {"conv_problem_description", 10000, [&]() {
+                 return conv::ProblemDescription{x, w, y, conv, conv::Direction::Forward}
+                     .GetInChannels();
+             }},
+            {"make_network_config", 10000,
+             [&]() { return problem.MakeNetworkConfig().ToString().size(); }},
+            {"find_db_lookup", 10000,
+             [&]() { return find_db.FindRecord(next_key()) ? std::size_t{1} : 0; }},
+            {"perf_db_lookup", 100,
+             [&]() { return perf_db.FindRecord(next_key()) ? std::size_t{1} : 0; }},
+#if MIOPEN_ENABLE_SQLITE
+            {"kern_db_lookup", 1000, [&]() {
+                 auto config        = KernelConfig{};
+                 const auto i       = (key += 7) % (DbRecords / 10);
+                 config.kernel_name = "kernel_" + std::to_string(i) + ".s.o";
+                 config.kernel_args = " -mcpu=gfx90a -DMIOPEN_N=" + std::to_string(i);
+                 return kern_db.FindRecordUnsafe(config)->size();
+             }},
+#endif
+            {"solver_applicability", 100, [&]() {
+                 std::size_t applicable = 0;
+                 for(const auto& solver : solvers)
+                     applicable += solver.IsApplicable(ctx, problem) ? 1 : 0;
+                 return applicable + 1;
+             }},
+            {"get_solutions_fallback", 100,
+             [&]() { return conv.GetSolutionsFallback(ctx, problem, 16).size() + 1; }},
+            {"invoker_cache_hit", 100000, [&]() {
+                 return handle.GetInvoker(network_config, invoker_solver) ? std::size_t{1} : 0;
+             }},
+            {"graphapi_finalize", 1000, [&]() {
+                 graphapi::OpGraphBuilder builder;
+                 builder.setHandle(&handle);
+                 for(auto& op : graph_ops)
+                     builder.addNode(&op);
+                 return std::move(builder).build().numNodes();
+             }},
+            {"solution_save_load", 1000, [&]() {
+                 auto size = std::size_t{0};
+                 miopenGetSolutionSize(&solution, &size);
+                 auto data = std::vector<char>(size);
+                 miopenSaveSolution(&solution, data.data());
+                 miopenSolution_t loaded = nullptr;
+                 miopenLoadSolution(&loaded, data.data(), data.size());
+                 miopenDestroySolution(loaded);
+                 return size;
+             }},
+        };
+
+        std::vector<BenchmarkResult> results;
+        for(const auto& benchmark : cases)
+            results.emplace_back(Measure(benchmark));
+
+        Report(results);
+    }
+
+private:
+    int repeats      = 7;
+    double scale     = 1.0;
+    double tolerance = 10.0;
+    std::string arch = "gfx90a:sramecc+:xnack-";
+    std::string output;
+    std::string baseline;
+
+    BenchmarkResult Measure(const BenchmarkCase& benchmark) const
+    {
+        const auto ops = std::max<std::size_t>(1, static_cast<std::size_t>(benchmark.ops * scale));
+
+        std::size_t dead_code_saver = 0;
+        const auto repeat           = [&]() {
+            const auto start = std::chrono::steady_clock::now();
+            for(std::size_t i = 0; i < ops; ++i)
+                dead_code_saver += benchmark.body();
+            const auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  std::chrono::steady_clock::now() - start)
+                                  .count();
+            return static_cast<double>(time) / ops;
+        };
+
+        // Warms up the caches which are filled on the first call.
+        repeat();
+
+        std::vector<double> times;
+        for(auto i = 0; i < std::max(repeats, 1); ++i)
+            times.push_back(repeat());
+        std::sort(times.begin(), times.end());
+
+        if(dead_code_saver == 0)
+            std::cout << benchmark.name << ": nothing was done" << std::endl;
+
+        return {benchmark.name, times[times.size() / 2], times.front()};
+    }
+
+    void Report(const std::vector<BenchmarkResult>& results) const
+    {
+        std::map<std::string, double> expected;
+        if(!baseline.empty())
+        {
+            std::ifstream in{baseline};
+            if(!in)
+            {
+                std::cerr << "Cannot read the baseline: " << baseline << std::endl;
+                std::exit(EXIT_FAILURE); // NOLINT (concurrency-mt-unsafe)
+            }
+            std::string name;
+            double ns_per_op     = 0;
+            double min_ns_per_op = 0;
+            while(in >> name >> ns_per_op >> min_ns_per_op)
+                expected[name] = ns_per_op;
+        }
+
+        std::size_t regressions = 0;
+        std::cout << std::fixed << std::setprecision(1);
+        for(const auto& result : results)
+        {
+            std::cout << std::left << std::setw(28) << result.name << std::right << std::setw(14)
+                      << result.ns_per_op << " ns/op (min " << result.min_ns_per_op << ")";
+
+            const auto it = expected.find(result.name);
+            if(it != expected.end())
+            {
+                const auto change = (result.ns_per_op / it->second - 1.0) * 100.0;
+                std::cout << ", " << std::showpos << change << std::noshowpos << "% vs baseline";
+                if(change > tolerance)
+                {
+                    std::cout << " REGRESSION";
+                    ++regressions;
+                }
+            }
+            std::cout << std::endl;
+        }
+
+        if(!output.empty())
+        {
+            std::ofstream out{output};
+            out << std::fixed << std::setprecision(1);
+            for(const auto& result : results)
+                out << result.name << '\t' << result.ns_per_op << '\t' << result.min_ns_per_op
+                    << '\n';
+        }
+
+        if(regressions != 0)
+        {
+            std::cerr << regressions << " case(s) are more than " << tolerance
+                      << "% slower than the baseline" << std::endl;
+            std::exit(EXIT_FAILURE); // NOLINT (concurrency-mt-unsafe)
+        }
+    }
+};
+
+} // namespace
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,241 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <cpu_kthvalue.hpp>
+#include <cpu_multimarginloss.hpp>
+#include <cpu_prelu.hpp>
+#include <cpu_softmarginloss.hpp>
+
+#include <driver.hpp>
+#include "measure.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace miopen {
+namespace {
+
+/// Compares the host references ported onto tensor_walk with the per-element indexing they
+/// used before, where every element rebuilt its coordinates with tensor_layout_t. The tensors
+/// are padded along the innermost dimension so that they are not packed.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(iterations, "iterations");
+        add(lengths, "lengths");
+    }
+
+    void run()
+    {
+        auto strides = std::vector<std::size_t>(lengths.size());
+        auto space   = std::size_t{1};
+        for(auto i = lengths.size(); i-- > 0;)
+        {
+            strides[i] = space;
+            space *= lengths[i] + (i + 1 == lengths.size() ? 3 : 0);
+        }
+
+        auto input  = tensor<float>{lengths, strides};
+        auto target = tensor<float>{lengths, strides};
+        auto grad   = tensor<float>{lengths, strides};
+        auto result = tensor<float>{lengths, strides};
+        for(std::size_t i = 0; i < input.data.size(); ++i)
+        {
+            input.data[i]  = static_cast<float>(i % 17) * 0.25f - 2.0f;
+            target.data[i] = i % 3 == 0 ? -1.0f : 1.0f;
+            grad.data[i]   = static_cast<float>(i % 5) * 0.5f;
+        }
+
+        ComparePrelu(input, grad, result);
+        CompareSoftMarginLoss(input, target, grad, result);
+        CompareKthvalue(input);
+        CompareMultiMarginLoss();
+    }
+
+private:
+    int iterations                   = 5;
+    std::vector<std::size_t> lengths = {16, 32, 56, 56};
+
+    void ComparePrelu(const tensor<float>& input, const tensor<float>& grad, tensor<float>& result)
+    {
+        const auto weight = tensor<float>{std::vector<std::size_t>{lengths[1]}}.generate(
+            [](auto i) { return static_cast<float>(i % 3) * 0.1f; });
+        auto weight_grad = tensor<float>{std::vector<std::size_t>{lengths[1]}};
+
+        const auto layout_time = speedtest::Measure<std::milli>(iterations, [&]() {
+            auto tv   = get_inner_expanded_tv<5>(input.desc);
+            auto w_tv = get_inner_expanded_tv<1>(weight.desc);
+            par_ford(input.desc.GetElementSize())([&](int gid) {
+                auto layout         = tensor_layout_t<5>(tv, gid);
+                const auto offset   = tv.get_tensor_view_idx(layout);
+                const float input_v = input[offset];
+                const float weight_v = weight[w_tv.get_tensor_view_idx({layout.layout[1]})];
+                result[offset] = input_v > 0 ? grad[offset] : weight_v * grad[offset];
+            });
+        });
+
+        const auto walk_time = speedtest::Measure<std::milli>(iterations, [&]() {
+            cpu_prelu_backward(input, weight, grad, result, weight_grad, true, false);
+        });
+
+        Report("PReLU backward", layout_time, walk_time);
+    }
+
+    void CompareSoftMarginLoss(const tensor<float>& input,
+                               const tensor<float>& target,
+                               const tensor<float>& grad,
+                               tensor<float>& result)
+    {
+        const auto tv = get_inner_expanded_tv<5>(input.desc);
+        auto loss     = tensor<float>{std::vector<std::size_t>{1}};
+
+        const auto fwd_layout_time = speedtest::Measure<std::milli>(iterations, [&]() {
+            auto layout_tv = tv;
+            double sum     = 0;
+            for(std::size_t gid = 0; gid < input.desc.GetElementSize(); ++gid)
+            {
+                const auto offset = layout_tv.get_tensor_view_idx(tensor_layout_t<5>(tv, gid));
+                sum += std::log1p(std::exp(-static_cast<double>(input[offset]) * target[offset]));
+            }
+            loss[0] = sum;
+        });
+
+        const auto fwd_walk_time = speedtest::Measure<std::milli>(iterations, [&]() {
+            cpu_softmarginloss_forward(input, target, loss, MIOPEN_LOSS_REDUCTION_SUM);
+        });
+
+        const auto bwd_layout_time = speedtest::Measure<std::milli>(iterations, [&]() {
+            par_ford(input.desc.GetElementSize())([&](std::size_t gid) {
+                auto layout_tv    = tv;
+                const auto offset = layout_tv.get_tensor_view_idx(tensor_layout_t<5>(tv, gid));
+                const double i    = input[offset];
+                const double t    = target[offset];
+                result[offset]    = -t / (std::exp(i * t) + 1) * grad[offset];
+            });
+        });
+
+        const auto bwd_walk_time = speedtest::Measure<std::milli>(iterations, [&]() {
+            cpu_softmarginloss_backward(input, target, grad, result, MIOPEN_LOSS_REDUCTION_NONE);
+        });
+
+        Report("SoftMarginLoss forward", fwd_layout_time, fwd_walk_time);
+        Report("SoftMarginLoss backward", bwd_layout_time, bwd_walk_time);
+    }
+
+    void CompareKthvalue(const tensor<float>& input)
+    {
+        const auto dim   = static_cast<int>(lengths.size()) - 1;
+        auto out_lengths = lengths;
+        out_lengths.erase(out_lengths.begin() + dim);
+
+        auto output        = tensor<float>{out_lengths};
+        const auto desc    = TensorDescriptor{miopenDouble, out_lengths};
+        auto indices       = std::vector<std::size_t>(output.data.size());
+        const auto k       = std::size_t{3};
+        const auto dim_len = lengths[dim];
+
+        const auto layout_time = speedtest::Measure<std::milli>(iterations, [&]() {
+            auto tv          = get_tv_without_dim<5>(get_inner_expanded_tv<5>(input.desc), dim);
+            auto out_tv      = get_inner_expanded_tv<5>(output.desc);
+            auto elements    = std::vector<float>(dim_len);
+            auto ids         = std::vector<std::size_t>(dim_len);
+            const auto count = output.data.size();
+            for(std::size_t slice = 0; slice < count; ++slice)
+            {
+                const auto offset = tv.get_tensor_view_idx(tensor_layout_t<4>(tv, slice));
+                for(std::size_t j = 0; j < dim_len; ++j)
+                    elements[j] = input[offset + j * input.desc.GetStrides()[dim]];
+                std::iota(ids.begin(), ids.end(), 0);
+                std::sort(ids.begin(), ids.end(), [&](auto x, auto y) {
+                    return elements[x] < elements[y];
+                });
+                output[out_tv.get_tensor_view_idx(tensor_layout_t<5>(out_tv, slice))] =
+                    elements[ids[k - 1]];
+            }
+        });
+
+        const auto walk_time = speedtest::Measure<std::milli>(
+            iterations, [&]() { cpu_kthvalue(input, output, indices, desc, k, dim); });
+
+        Report("Kthvalue", layout_time, walk_time);
+    }
+
+    void CompareMultiMarginLoss()
+    {
+        const auto n = lengths[0] * lengths[1] * lengths[2];
+        const auto c = lengths.back();
+        const auto input =
+            tensor<float>{std::vector<std::size_t>{n, c}, std::vector<std::size_t>{c + 3, 1}}
+                .generate([](auto i, auto j) { return static_cast<float>((i + j) % 7) * 0.3f; });
+        auto target = tensor<uint64_t>{std::vector<std::size_t>{n}};
+        for(std::size_t i = 0; i < n; ++i)
+            target.data[i] = i % c;
+        const auto weight = tensor<float>{std::vector<std::size_t>{c}}.generate(
+            [](auto i) { return 1.0f + static_cast<float>(i % 2); });
+        auto loss = tensor<float>{std::vector<std::size_t>{1}};
+
+        const auto layout_time = speedtest::Measure<std::milli>(iterations, [&]() {
+            auto tv    = get_inner_expanded_tv<2>(input.desc);
+            double sum = 0;
+            for(std::size_t i = 0; i < n; i++)
+            {
+                const auto y = target[i];
+                for(std::size_t j = 0; j < c; j++)
+                {
+                    const double t = 1.0 - input[tv.get_tensor_view_idx({i, y})] +
+                                     input[tv.get_tensor_view_idx({i, j})];
+                    if(y != j && t > 0)
+                        sum += weight[y] * t / c;
+                }
+            }
+            loss[0] = sum;
+        });
+
+        const auto walk_time = speedtest::Measure<std::milli>(iterations, [&]() {
+            cpu_multimarginloss_forward(
+                input, target, weight, loss, 1, 1.0f, MIOPEN_LOSS_REDUCTION_SUM);
+        });
+
+        Report("MultiMarginLoss forward", layout_time, walk_time);
+    }
+
+    static void Report(const char* name, double layout_time, double walk_time)
+    {
+        std::cout << name << ": tensor_layout_t " << layout_time << " ms, tensor_walk "
+                  << walk_time << " ms, speedup " << layout_time / walk_time << std::endl;
+    }
+};
+
+} // namespace
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::SpeedTestDriver>(argc, argv);
+    return 0;
+}
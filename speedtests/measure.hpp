@@ -0,0 +1,69 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_SPEEDTESTS_MEASURE_HPP
+#define GUARD_MIOPEN_SPEEDTESTS_MEASURE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <ratio>
+#include <type_traits>
+
+namespace miopen {
+namespace speedtest {
+
+/// Calls `body` `iterations` times and returns the average time of a call in units of Period,
+/// microseconds by default. A body may return a count of what it produced. The counts are summed
+/// so that the work is not optimized away, and `if_none` is printed when they are all zero.
+template <class Period = std::micro, class TBody>
+double Measure(int iterations, const TBody& body, const char* if_none = "Nothing was measured")
+{
+    constexpr auto counted = !std::is_void_v<decltype(body())>;
+
+    std::size_t dead_code_saver = 0;
+    const auto start            = std::chrono::steady_clock::now();
+
+    for(auto i = 0; i < iterations; i++)
+    {
+        if constexpr(counted)
+            dead_code_saver += static_cast<std::size_t>(body());
+        else
+            body();
+    }
+
+    const auto time =
+        std::chrono::duration<double, Period>(std::chrono::steady_clock::now() - start).count();
+
+    if(counted && dead_code_saver == 0)
+        std::cout << if_none << std::endl;
+
+    return time / iterations;
+}
+
+} // namespace speedtest
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_SPEEDTESTS_MEASURE_HPP
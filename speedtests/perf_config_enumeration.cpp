@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/solvers.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/generic_search.hpp>
+#include <miopen/perf_config_catalog.hpp>
+
+#include <driver.hpp>
+#include "measure.hpp"
+
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+namespace miopen {
+namespace conv {
+namespace {
+
+/// Compares enumerating the perf configs of tunable solvers, as every tuning run did before
+/// the perf config catalog, with reading them from the catalog in a process which has not
+/// enumerated them yet.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver() { add(iterations, "iterations"); }
+
+    void run()
+    {
+        auto* const catalog = solver::GetPerfConfigCatalog();
+        if(catalog == nullptr)
+        {
+            std::cout << "The perf config catalog is disabled" << std::endl;
+            return;
+        }
+
+        auto&& handle = get_handle();
+
+        for(const auto type : {miopenFloat, miopenHalf})
+        {
+            for(const std::size_t k : {1, 3})
+            {
+                const auto pad     = static_cast<int>(k / 2);
+                const auto conv    = ConvolutionDescriptor{{pad, pad}, {1, 1}, {1, 1}};
+                const auto x       = TensorDescriptor{type, miopenTensorNCHW, {16, 256, 28, 28}};
+                const auto w       = TensorDescriptor{type, miopenTensorNCHW, {256, 256, k, k}};
+                const auto y       = conv.GetForwardOutputTensor(x, w, type);
+                const auto problem = ProblemDescription{x, w, y, conv, Direction::Forward};
+
+                auto ctx = ExecutionContext{&handle};
+                problem.SetupFloats(ctx);
+                ctx.is_for_generic_search = true;
+
+                Compare(*catalog, solver::conv::ConvAsm1x1U{}, ctx, problem);
+                Compare(
+                    *catalog, solver::conv::ConvHipImplicitGemmForwardV4R4Xdlops{}, ctx, problem);
+                Compare(*catalog, solver::conv::ConvHipImplicitGemmFwdXdlops{}, ctx, problem);
+            }
+        }
+    }
+
+private:
+    int iterations = 3;
+
+    template <class Solver>
+    void Compare(solver::PerfConfigCatalog& catalog,
+                 const Solver& s,
+                 const ExecutionContext& ctx,
+                 const ProblemDescription& problem) const
+    {
+        if(!s.IsApplicable(ctx, problem))
+            return;
+
+        using PerformanceConfig = decltype(s.GetDefaultPerformanceConfig(ctx, problem));
+        using Container =
+            solver::ComputedContainer<PerformanceConfig, ExecutionContext, ProblemDescription>;
+
+        const auto enumerate = [&]() {
+            const Container primary(ctx, problem);
+            const Container spare(ctx, problem, true);
+            return std::distance(primary.begin(), primary.end()) +
+                   std::distance(spare.begin(), spare.end());
+        };
+        const auto enumeration_time =
+            speedtest::Measure<std::milli>(iterations, enumerate, "No valid configs");
+
+        // Fills the catalog unless an earlier run has done that.
+        const auto n_configs = solver::GetAllConfigs(s, ctx, problem).size();
+        const auto key       = solver::GetSearchKey(s, ctx, problem);
+
+        const auto read_catalog = [&]() {
+            const auto entry = catalog.Path().empty()
+                                   ? catalog.Find(key)
+                                   : solver::PerfConfigCatalog{catalog.Path()}.Find(key);
+            auto n_valid = 0;
+            for(const auto& serialized : entry->Configs())
+            {
+                PerformanceConfig config;
+                n_valid += config.Deserialize(serialized) ? 1 : 0;
+            }
+            return n_valid;
+        };
+        const auto catalog_time =
+            speedtest::Measure<std::milli>(iterations, read_catalog, "No valid configs");
+
+        std::cout << s.SolverDbId() << ' ' << problem.MakeNetworkConfig().ToString() << ": "
+                  << n_configs << " configs, enumeration " << enumeration_time
+                  << " ms, catalog " << catalog_time << " ms" << std::endl;
+    }
+};
+
+} // namespace
+} // namespace conv
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::conv::SpeedTestDriver>(argc, argv);
+    return 0;
+}
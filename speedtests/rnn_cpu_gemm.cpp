@@ -0,0 +1,135 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <rnn_util.hpp>
+
+#include <driver.hpp>
+#include "measure.hpp"
+
+#include <iostream>
+#include <vector>
+
+namespace miopen {
+namespace {
+
+/// Compares the host reference GEMM used by the RNN verification code with the naive loops it
+/// replaced. The shapes follow what an LSTM reference issues per time step: a large input
+/// projection over the whole sequence and a small hidden-state update per step.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver()
+    {
+        add(iterations, "iterations");
+        add(batch_size, "batch-size");
+        add(hidden_size, "hidden-size");
+        add(seq_len, "seq-len");
+    }
+
+    void run()
+    {
+        const auto gates = 4 * hidden_size;
+
+        // Input projection over the whole sequence: [seq_len * batch, hidden] x [4 * hidden,
+        // hidden]^T.
+        Compare("input projection", seq_len * batch_size, gates, hidden_size, false, true);
+        // Hidden-state update of a single step: [batch, hidden] x [4 * hidden, hidden]^T.
+        Compare("hidden update", batch_size, gates, hidden_size, false, true);
+        // Weight gradient: [seq_len * batch, 4 * hidden]^T x [seq_len * batch, hidden].
+        Compare("weight gradient", gates, hidden_size, seq_len * batch_size, true, false);
+    }
+
+private:
+    int iterations          = 10;
+    std::size_t batch_size  = 64;
+    std::size_t hidden_size = 512;
+    std::size_t seq_len     = 16;
+
+    void Compare(const char* name,
+                 std::size_t m,
+                 std::size_t n,
+                 std::size_t k,
+                 bool trans_a,
+                 bool trans_b) const
+    {
+        const auto a_rows = trans_a ? k : m;
+        const auto a_cols = trans_a ? m : k;
+        const auto b_rows = trans_b ? n : k;
+        const auto b_cols = trans_b ? k : n;
+
+        const auto a = std::vector<float>(a_rows * a_cols, 0.5f);
+        const auto b = std::vector<float>(b_rows * b_cols, 0.25f);
+        auto c       = std::vector<float>(m * n, 1.0f);
+
+        const auto naive_time = speedtest::Measure(iterations, [&]() {
+            for(std::size_t i = 0; i < m; ++i)
+            {
+                for(std::size_t j = 0; j < n; ++j)
+                {
+                    double acc = 0;
+                    for(std::size_t p = 0; p < k; ++p)
+                    {
+                        const auto av = trans_a ? a[p * a_cols + i] : a[i * a_cols + p];
+                        const auto bv = trans_b ? b[j * b_cols + p] : b[p * b_cols + j];
+                        acc += static_cast<double>(av) * static_cast<double>(bv);
+                    }
+                    c[i * n + j] = static_cast<float>(acc);
+                }
+            }
+        });
+
+        const auto blocked_time = speedtest::Measure(iterations, [&]() {
+            RNN_mm_cpu(a.data(),
+                       a_cols,
+                       a_rows,
+                       a_cols,
+                       trans_a ? RNN_MM_TRANSPOSE : 0,
+                       b.data(),
+                       b_cols,
+                       b_rows,
+                       b_cols,
+                       trans_b ? RNN_MM_TRANSPOSE : 0,
+                       c.data(),
+                       n,
+                       m,
+                       n,
+                       0,
+                       1.0,
+                       0.0);
+        });
+
+        std::cout << name << " (" << m << "x" << n << "x" << k << "): naive " << naive_time
+                  << " us, RNN_mm_cpu " << blocked_time << " us, speedup "
+                  << naive_time / blocked_time << std::endl;
+    }
+};
+
+} // namespace
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::SpeedTestDriver>(argc, argv);
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/config.h> // WORKAROUND_BOOST_ISSUE_392
+#include <miopen/convolution.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/solution.hpp>
+
+#include <driver.hpp>
+#include "measure.hpp"
+
+#include <array>
+#include <iostream>
+#include <unordered_map>
+
+namespace miopen {
+namespace {
+
+/// Measures the host overhead of running a solution per call, with and without binding it to
+/// the tensor descriptors first. The invoker does nothing, so that only the host side is timed,
+/// which makes the results comparable between the HIP and HIPNOGPU backends.
+struct SpeedTestDriver : public test_driver
+{
+    SpeedTestDriver() { add(iterations, "iterations"); }
+
+    void run()
+    {
+#if MIOPEN_BACKEND_HIP
+        auto&& handle = get_handle();
+
+        auto problem = Problem{};
+        problem.SetOperatorDescriptor(ConvolutionDescriptor{{1, 1}});
+        problem.SetDirection(miopenProblemDirectionForward);
+        problem.RegisterTensorDescriptor(miopenTensorConvolutionX,
+                                         TensorDescriptor{miopenFloat, {1, 64, 7, 7}});
+        problem.RegisterTensorDescriptor(miopenTensorConvolutionW,
+                                         TensorDescriptor{miopenFloat, {64, 64, 3, 3}});
+        problem.RegisterTensorDescriptor(miopenTensorConvolutionY,
+                                         TensorDescriptor{miopenFloat, {1, 64, 7, 7}});
+
+        std::size_t invoked = 0;
+        auto solution       = Solution{solver::Id{}, 0.0f, 0};
+        solution.SetProblem(ProblemContainer{problem});
+        solution.SetInvoker([&](const Handle&, const AnyInvokeParams&) { ++invoked; });
+
+        std::array<char, 3> storage{};
+        const auto x = DataCast(&storage[0]);
+        const auto w = DataCast(&storage[1]);
+        const auto y = DataCast(&storage[2]);
+
+        const auto run_time = speedtest::Measure(iterations, [&]() {
+            const auto inputs = std::unordered_map<miopenTensorArgumentId_t, Solution::RunInput>{
+                {miopenTensorConvolutionX, x},
+                {miopenTensorConvolutionW, w},
+                {miopenTensorConvolutionY, y}};
+            solution.Run(handle, inputs, nullptr, 0);
+        });
+
+        auto bound = solution.Bind(
+            handle,
+            {miopenTensorConvolutionX, miopenTensorConvolutionW, miopenTensorConvolutionY},
+            {{miopenTensorConvolutionX, {}},
+             {miopenTensorConvolutionW, {}},
+             {miopenTensorConvolutionY, {}}});
+        const auto buffers    = std::array<Data_t, 3>{x, w, y};
+        const auto bound_time = speedtest::Measure(
+            iterations, [&]() { bound.Run(handle, buffers.data(), buffers.size(), nullptr, 0); });
+
+        std::cout << "Iterations: " << iterations << ", invoked: " << invoked << std::endl;
+        std::cout << "Solution::Run: " << run_time << " us per call" << std::endl;
+        std::cout << "BoundSolution::Run: " << bound_time << " us per call" << std::endl;
+#else
+        std::cout << "Invokers can only be attached to solutions with the HIP backend"
+                  << std::endl;
+#endif
+    }
+
+private:
+    int iterations = 100000;
+};
+
+} // namespace
+} // namespace miopen
+
+int main(int argc, const char* argv[])
+{
+    test_drive<miopen::SpeedTestDriver>(argc, argv);
+    return 0;
+}
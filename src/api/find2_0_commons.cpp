@@ -428,6 +428,63 @@ miopenStatus_t miopenDestroySolution(miopenSolution_t solution)
     return miopen::try_([&] { miopen_destroy_object(solution); });
 }
 
+miopenStatus_t miopenBindSolution(miopenHandle_t handle,
+                                  miopenSolution_t solution,
+                                  size_t nInputs,
+                                  const miopenTensorArgument_t* tensors,
+                                  miopenBoundSolution_t* boundSolution)
+{
+    const auto tensors_vector = std::vector<miopenTensorArgument_t>{tensors, tensors + nInputs};
+    MIOPEN_LOG_FUNCTION(handle, solution, nInputs, tensors_vector, boundSolution);
+
+    return miopen::try_([&] {
+        auto& handle_deref   = miopen::deref(handle);
+        auto& solution_deref = miopen::deref(solution);
+
+        auto arguments = std::vector<miopenTensorArgumentId_t>{};
+        auto inputs    = std::unordered_map<miopenTensorArgumentId_t, miopen::Solution::RunInput>{};
+
+        arguments.reserve(tensors_vector.size());
+        inputs.reserve(tensors_vector.size());
+        for(auto&& tensor : tensors_vector)
+        {
+            arguments.emplace_back(tensor.id);
+            inputs.emplace(std::make_pair(tensor.id, miopen::Solution::RunInput{tensor}));
+        }
+
+        miopen::deref(boundSolution) =
+            new miopen::BoundSolution{solution_deref.Bind(handle_deref, arguments, inputs)};
+    });
+}
+
+miopenStatus_t miopenRunBoundSolution(miopenHandle_t handle,
+                                      miopenBoundSolution_t boundSolution,
+                                      size_t nBuffers,
+                                      void* const* buffers,
+                                      void* workspace,
+                                      size_t workspaceSize)
+{
+    MIOPEN_LOG_FUNCTION(handle, boundSolution, nBuffers, workspace, workspaceSize);
+
+    return miopen::try_([&] {
+        auto& handle_deref = miopen::deref(handle);
+        auto& bound_deref  = miopen::deref(boundSolution);
+
+        static_assert(sizeof(void*) == sizeof(Data_t));
+        bound_deref.Run(handle_deref,
+                        reinterpret_cast<const Data_t*>(buffers),
+                        nBuffers,
+                        DataCast(workspace),
+                        workspaceSize);
+    });
+}
+
+miopenStatus_t miopenDestroyBoundSolution(miopenBoundSolution_t boundSolution)
+{
+    MIOPEN_LOG_FUNCTION(boundSolution);
+    return miopen::try_([&] { miopen_destroy_object(boundSolution); });
+}
+
 miopenStatus_t miopenLoadSolution(miopenSolution_t* solution, const char* data, size_t size)
 {
     MIOPEN_LOG_FUNCTION(solution, data, size);
@@ -466,6 +523,67 @@ miopenStatus_t miopenSaveSolution(miopenSolution_t solution, char* data)
     });
 }
 
+miopenStatus_t
+miopenSaveSolutionBundle(const char* path, const miopenSolution_t* solutions, size_t numSolutions)
+{
+    MIOPEN_LOG_FUNCTION(path, solutions, numSolutions);
+
+    return miopen::try_([&] {
+        if(path == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Path parameter should not be a nullptr.");
+        if(solutions == nullptr && numSolutions != 0)
+            MIOPEN_THROW(miopenStatusBadParm, "Solutions parameter should not be a nullptr.");
+
+        auto solutions_deref = std::vector<const miopen::Solution*>{};
+        solutions_deref.reserve(numSolutions);
+        for(auto i = 0; i < numSolutions; ++i)
+            solutions_deref.push_back(&miopen::deref(solutions[i]));
+
+        miopen::SolutionBundle::Save(path, solutions_deref);
+    });
+}
+
+miopenStatus_t miopenGetSolutionBundleSize(const char* path, size_t* numSolutions)
+{
+    MIOPEN_LOG_FUNCTION(path);
+
+    return miopen::try_([&] {
+        if(path == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Path parameter should not be a nullptr.");
+        if(numSolutions == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "NumSolutions parameter should not be a nullptr.");
+
+        *numSolutions = miopen::SolutionBundle::GetSize(path);
+    });
+}
+
+miopenStatus_t miopenLoadSolutionBundle(const char* path,
+                                        miopenSolution_t* solutions,
+                                        size_t* numSolutions,
+                                        size_t maxSolutions)
+{
+    MIOPEN_LOG_FUNCTION(path, solutions, numSolutions, maxSolutions);
+
+    return miopen::try_([&] {
+        if(path == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Path parameter should not be a nullptr.");
+        if(solutions == nullptr)
+            MIOPEN_THROW(miopenStatusBadParm, "Solutions parameter should not be a nullptr.");
+
+        auto solutions_deref = miopen::SolutionBundle::Load(path);
+        const auto count     = std::min(solutions_deref.size(), maxSolutions);
+
+        for(auto i = 0; i < count; ++i)
+        {
+            auto& theSolution = miopen::deref(solutions + i);
+            theSolution       = new miopen::Solution{std::move(solutions_deref[i])};
+        }
+
+        if(numSolutions != nullptr)
+            *numSolutions = count;
+    });
+}
+
 miopenStatus_t miopenGetSolutionSize(miopenSolution_t solution, size_t* size)
 {
     MIOPEN_LOG_FUNCTION(solution);
@@ -37,10 +37,15 @@
 #include <miopen/sqlite_db.hpp>
 #endif
 #include <miopen/kern_db.hpp>
+#include <miopen/lookup_counters.hpp>
 #include <miopen/db.hpp>
 #include <miopen/db_path.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/filesystem.hpp>
+#if !WORKAROUND_ISSUE_3001
+#include <miopen/hip_build_utils.hpp>
+#endif
+#include <chrono>
 #include <fstream>
 #include <iostream>
 
@@ -125,24 +130,51 @@ bool IsCacheDisabled()
 
 #if MIOPEN_ENABLE_SQLITE_KERN_CACHE
 using KDb = DbTimer<MultiFileDb<KernDb, KernDb, false>>;
-KDb GetDb(const TargetProperties& target, size_t num_cu)
+fs::path GetSystemKernelDbPath(const TargetProperties& target, std::size_t num_cu)
 {
-    static const auto user_dir = ComputeUserCachePath();
-    static const auto sys_dir  = ComputeSysCachePath();
-    fs::path user_path         = user_dir / (Handle::GetDbBasename(target, num_cu) + ".ukdb");
-    fs::path sys_path          = sys_dir / (Handle::GetDbBasename(target, num_cu) + ".kdb");
-    if(user_dir.empty())
-        user_path = user_dir;
+    static const auto sys_dir = ComputeSysCachePath();
+    fs::path sys_path         = sys_dir / (Handle::GetDbBasename(target, num_cu) + ".kdb");
     if(!fs::exists(sys_path))
         sys_path = sys_dir / (target.DbId() + ".kdb");
 #if !MIOPEN_EMBED_DB
     if(!fs::exists(sys_path))
         sys_path = fs::path{};
 #endif
-    return {DbKinds::KernelDb, sys_path, user_path};
+    return sys_path;
+}
+
+KDb GetDb(const TargetProperties& target, size_t num_cu, LookupCounters* counters)
+{
+    static const auto user_dir = ComputeUserCachePath();
+    fs::path user_path         = user_dir / (Handle::GetDbBasename(target, num_cu) + ".ukdb");
+    if(user_dir.empty())
+        user_path = user_dir;
+    return {counters, DbKinds::KernelDb, GetSystemKernelDbPath(target, num_cu), user_path};
 }
 #endif
 
+std::string
+GetKernelCacheArgs(const TargetProperties& target, const fs::path& program_name, std::string params)
+{
+#if WORKAROUND_ISSUE_3001
+    if(program_name.extension() != ".mlir")
+        params += " -mcpu=" + target.Name();
+#else
+    if(program_name.extension() == ".mlir")
+    { // no -mcpu
+    }
+    else if(program_name.extension() == ".s")
+    {
+        params += " -mcpu=" + LcOptionTargetStrings{target}.targetId;
+    }
+    else
+    {
+        params += " -mcpu=" + target.Name();
+    }
+#endif
+    return params;
+}
+
 fs::path GetCacheFile(const std::string& device, const fs::path& name, const std::string& args)
 {
     const auto filename = make_object_file_name(name);
@@ -153,12 +185,13 @@ fs::path GetCacheFile(const std::string& device, const fs::path& name, const std
 std::vector<char> LoadBinary(const TargetProperties& target,
                              const size_t num_cu,
                              const fs::path& name,
-                             const std::string& args)
+                             const std::string& args,
+                             LookupCounters* counters)
 {
     if(miopen::IsCacheDisabled())
         return {};
 
-    auto db = GetDb(target, num_cu);
+    auto db = GetDb(target, num_cu, counters);
 
     const auto filename = make_object_file_name(name);
     const KernelConfig cfg{filename, args, {}};
@@ -181,12 +214,13 @@ void SaveBinary(const std::vector<char>& hsaco,
                 const TargetProperties& target,
                 const std::size_t num_cu,
                 const fs::path& name,
-                const std::string& args)
+                const std::string& args,
+                LookupCounters* counters)
 {
     if(miopen::IsCacheDisabled())
         return;
 
-    auto db = GetDb(target, num_cu);
+    auto db = GetDb(target, num_cu, counters);
 
     const auto filename = make_object_file_name(name);
     KernelConfig cfg{filename, args, hsaco};
@@ -198,14 +232,21 @@ void SaveBinary(const std::vector<char>& hsaco,
 fs::path LoadBinary(const TargetProperties& target,
                     const size_t num_cu,
                     const fs::path& name,
-                    const std::string& args)
+                    const std::string& args,
+                    LookupCounters* counters)
 {
     if(miopen::IsCacheDisabled())
         return {};
 
     (void)num_cu;
-    auto f = GetCacheFile(target.DbId(), name, args);
-    if(fs::exists(f))
+    const auto start = std::chrono::steady_clock::now();
+    auto f           = GetCacheFile(target.DbId(), name, args);
+    const auto found = fs::exists(f);
+    RecordLookup(counters,
+                 LookupSource::KernelDb,
+                 found ? LookupEvent::Hit : LookupEvent::Miss,
+                 std::chrono::steady_clock::now() - start);
+    if(found)
     {
         return f;
     }
@@ -218,7 +259,8 @@ fs::path LoadBinary(const TargetProperties& target,
 fs::path SaveBinary(const fs::path& binary_path,
                     const TargetProperties& target,
                     const fs::path& name,
-                    const std::string& args)
+                    const std::string& args,
+                    LookupCounters* counters)
 {
     if(miopen::IsCacheDisabled())
     {
@@ -227,9 +269,14 @@ fs::path SaveBinary(const fs::path& binary_path,
     }
     else
     {
-        auto p = GetCacheFile(target.DbId(), name, args);
+        const auto start = std::chrono::steady_clock::now();
+        auto p           = GetCacheFile(target.DbId(), name, args);
         fs::create_directories(p.parent_path());
         fs::rename(binary_path, p);
+        RecordLookup(counters,
+                     LookupSource::KernelDb,
+                     LookupEvent::Store,
+                     std::chrono::steady_clock::now() - start);
         return p;
     }
 }
@@ -0,0 +1,480 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/binary_db_record.hpp>
+
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+namespace miopen {
+
+namespace {
+
+constexpr std::string_view BinaryDbMagic = "MIOPBFDB";
+constexpr std::size_t HeaderSize         = 3;
+constexpr std::uint8_t CustomAlgorithm   = 0xFF;
+
+// Indices are stored in the payloads, so entries can only be appended.
+constexpr std::string_view KnownAlgorithms[] = {
+    "miopenConvolutionFwdAlgoGEMM",
+    "miopenConvolutionFwdAlgoDirect",
+    "miopenConvolutionFwdAlgoFFT",
+    "miopenConvolutionFwdAlgoWinograd",
+    "miopenConvolutionFwdAlgoImplicitGEMM",
+    "miopenConvolutionBwdDataAlgoGEMM",
+    "miopenConvolutionBwdDataAlgoDirect",
+    "miopenConvolutionBwdDataAlgoFFT",
+    "miopenConvolutionBwdDataAlgoWinograd",
+    "miopenConvolutionBwdDataAlgoImplicitGEMM",
+    "miopenTransposeBwdDataAlgoGEMM",
+    "miopenConvolutionBwdWeightsAlgoGEMM",
+    "miopenConvolutionBwdWeightsAlgoDirect",
+    "miopenConvolutionBwdWeightsAlgoFFT",
+    "miopenConvolutionBwdWeightsAlgoWinograd",
+    "miopenConvolutionBwdWeightsAlgoImplicitGEMM",
+};
+
+template <class T>
+void Put(std::string& out, T value)
+{
+    for(std::size_t i = 0; i < sizeof(T); ++i)
+        out.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+}
+
+template <class T>
+bool Get(std::string_view data, std::size_t& pos, T& value)
+{
+    if(data.size() < pos + sizeof(T))
+        return false;
+
+    value = 0;
+    for(std::size_t i = 0; i < sizeof(T); ++i)
+        value |= static_cast<T>(static_cast<unsigned char>(data[pos + i])) << (8 * i);
+    pos += sizeof(T);
+    return true;
+}
+
+void PutVarint(std::string& out, std::uint64_t value)
+{
+    while(value >= 0x80)
+    {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+bool GetVarint(std::string_view data, std::size_t& pos, std::uint64_t& value)
+{
+    value = 0;
+    for(auto shift = 0; shift < 64; shift += 7)
+    {
+        if(pos >= data.size())
+            return false;
+        const auto byte = static_cast<unsigned char>(data[pos++]);
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if((byte & 0x80) == 0)
+            return true;
+    }
+    return false;
+}
+
+bool GetString(std::string_view data, std::size_t& pos, std::size_t size, std::string_view& str)
+{
+    if(data.size() < pos + size)
+        return false;
+    str = data.substr(pos, size);
+    pos += size;
+    return true;
+}
+
+std::string ToString(const FindDbData& values)
+{
+    auto ss = std::ostringstream{};
+    values.Serialize(ss);
+    return ss.str();
+}
+
+// Encodes VALUES as FindDbData only if that does not change their text.
+bool TryParseFindDbData(const std::string& text, FindDbData& values)
+{
+    return values.Deserialize(text) && values.algorithm.size() <= UINT16_MAX &&
+           ToString(values) == text;
+}
+
+} // namespace
+
+BinaryDbRecord::BinaryDbRecord(std::string_view payload_) : payload(payload_)
+{
+    auto pos     = std::size_t{0};
+    auto version = std::uint8_t{};
+    auto size    = std::uint16_t{};
+
+    if(!Get(payload, pos, version) || version != Version || !Get(payload, pos, size))
+        return;
+
+    if(payload.size() < HeaderSize + size * sizeof(std::uint32_t))
+        return;
+
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        auto offset  = std::uint32_t{};
+        auto id_size = std::uint16_t{};
+        Get(payload, pos, offset);
+
+        auto item_pos = std::size_t{offset};
+        if(!Get(payload, item_pos, id_size) || payload.size() < item_pos + id_size)
+            return;
+    }
+
+    count = size;
+    valid = true;
+}
+
+std::string_view BinaryDbRecord::GetId(std::size_t index) const
+{
+    if(index >= count)
+        return {};
+
+    auto pos     = HeaderSize + index * sizeof(std::uint32_t);
+    auto offset  = std::uint32_t{};
+    auto id_size = std::uint16_t{};
+    auto id      = std::string_view{};
+    Get(payload, pos, offset);
+    pos = offset;
+    Get(payload, pos, id_size);
+    GetString(payload, pos, id_size, id);
+    return id;
+}
+
+const char* BinaryDbRecord::Find(std::string_view id) const
+{
+    // IDs are sorted, so a lookup only touches log(count) items.
+    auto first = std::size_t{0};
+    auto last  = count;
+
+    while(first < last)
+    {
+        const auto middle  = first + (last - first) / 2;
+        const auto current = GetId(middle);
+
+        if(current == id)
+            return current.data() + current.size();
+        if(current < id)
+            first = middle + 1;
+        else
+            last = middle;
+    }
+
+    return nullptr;
+}
+
+bool BinaryDbRecord::GetValues(std::string_view id, FindDbData& values) const
+{
+    const auto item = Find(id);
+    if(item == nullptr)
+        return false;
+
+    auto pos  = static_cast<std::size_t>(item - payload.data());
+    auto type = std::uint8_t{};
+    if(!Get(payload, pos, type))
+        return false;
+
+    if(type == static_cast<std::uint8_t>(ValueType::Text))
+    {
+        auto text = std::string{};
+        return GetValues(id, text) && values.Deserialize(text);
+    }
+
+    if(type != static_cast<std::uint8_t>(ValueType::FindDbData))
+        return false;
+
+    auto time_bits  = std::uint32_t{};
+    auto workspace  = std::uint64_t{};
+    auto algo_index = std::uint8_t{};
+    auto algo_size  = std::uint16_t{};
+    auto algorithm  = std::string_view{};
+
+    if(!Get(payload, pos, time_bits) || !GetVarint(payload, pos, workspace) ||
+       !Get(payload, pos, algo_index))
+        return false;
+
+    if(algo_index < std::size(KnownAlgorithms))
+        algorithm = KnownAlgorithms[algo_index];
+    else if(algo_index != CustomAlgorithm || !Get(payload, pos, algo_size) ||
+            !GetString(payload, pos, algo_size, algorithm))
+        return false;
+
+    std::memcpy(&values.time, &time_bits, sizeof(values.time));
+    values.workspace = workspace;
+    values.algorithm = std::string{algorithm};
+    return true;
+}
+
+bool BinaryDbRecord::GetValues(std::string_view id, std::string& values) const
+{
+    const auto item = Find(id);
+    if(item == nullptr)
+        return false;
+
+    auto pos  = static_cast<std::size_t>(item - payload.data());
+    auto type = std::uint8_t{};
+    if(!Get(payload, pos, type))
+        return false;
+
+    if(type == static_cast<std::uint8_t>(ValueType::FindDbData))
+    {
+        auto data = FindDbData{};
+        if(!GetValues(id, data))
+            return false;
+        values = ToString(data);
+        return true;
+    }
+
+    auto size = std::uint32_t{};
+    auto text = std::string_view{};
+
+    if(type != static_cast<std::uint8_t>(ValueType::Text) || !Get(payload, pos, size) ||
+       !GetString(payload, pos, size, text))
+        return false;
+
+    values = std::string{text};
+    return true;
+}
+
+std::string BinaryDbRecord::Encode(const DbRecord& record)
+{
+    auto items = std::vector<std::pair<std::string, std::string>>{record.map.begin(),
+                                                                    record.map.end()};
+    std::sort(items.begin(), items.end());
+
+    if(items.size() > UINT16_MAX)
+        MIOPEN_THROW("Too many IDs in a db record to encode: " + record.key);
+
+    auto out = std::string{};
+    Put(out, Version);
+    Put(out, static_cast<std::uint16_t>(items.size()));
+    out.resize(HeaderSize + items.size() * sizeof(std::uint32_t));
+
+    for(std::size_t i = 0; i < items.size(); ++i)
+    {
+        const auto& [id, text] = items[i];
+
+        if(id.size() > UINT16_MAX)
+            MIOPEN_THROW("Too long ID in a db record to encode: " + id);
+
+        auto offset = std::string{};
+        Put(offset, static_cast<std::uint32_t>(out.size()));
+        out.replace(HeaderSize + i * sizeof(std::uint32_t), offset.size(), offset);
+
+        Put(out, static_cast<std::uint16_t>(id.size()));
+        out += id;
+
+        auto data = FindDbData{};
+        if(TryParseFindDbData(text, data))
+        {
+            auto time_bits = std::uint32_t{};
+            std::memcpy(&time_bits, &data.time, sizeof(time_bits));
+
+            const auto known = std::find(
+                std::begin(KnownAlgorithms), std::end(KnownAlgorithms), data.algorithm);
+
+            Put(out, static_cast<std::uint8_t>(ValueType::FindDbData));
+            Put(out, time_bits);
+            PutVarint(out, data.workspace);
+
+            if(known != std::end(KnownAlgorithms))
+            {
+                Put(out, static_cast<std::uint8_t>(known - std::begin(KnownAlgorithms)));
+            }
+            else
+            {
+                Put(out, CustomAlgorithm);
+                Put(out, static_cast<std::uint16_t>(data.algorithm.size()));
+                out += data.algorithm;
+            }
+        }
+        else
+        {
+            Put(out, static_cast<std::uint8_t>(ValueType::Text));
+            Put(out, static_cast<std::uint32_t>(text.size()));
+            out += text;
+        }
+    }
+
+    return out;
+}
+
+boost::optional<DbRecord> BinaryDbRecord::Decode(const std::string& key, std::string_view payload)
+{
+    const auto binary = BinaryDbRecord{payload};
+    if(!binary.IsValid())
+        return boost::none;
+
+    auto record = DbRecord{key};
+
+    for(std::size_t i = 0; i < binary.GetSize(); ++i)
+    {
+        const auto id = binary.GetId(i);
+        auto values   = std::string{};
+        if(!binary.GetValues(id, values))
+            return boost::none;
+        record.map.emplace(std::string{id}, std::move(values));
+    }
+
+    return record;
+}
+
+boost::optional<DbRecord> BinaryDbRecord::ParseText(const std::string& line)
+{
+    const auto key_size = line.find('=');
+    if(key_size == std::string::npos || key_size == 0)
+        return boost::none;
+
+    auto record = DbRecord{line.substr(0, key_size)};
+    if(!record.ParseContents(line.substr(key_size + 1)))
+        return boost::none;
+    return record;
+}
+
+std::string BinaryDbRecord::ToText(const DbRecord& record)
+{
+    auto ss = std::ostringstream{};
+    record.WriteContents(ss);
+    auto text = ss.str();
+    if(!text.empty() && text.back() == '\n')
+        text.pop_back();
+    return text;
+}
+
+bool BinaryDbRecord::ConvertTextToBinary(const fs::path& from, const fs::path& to)
+{
+    auto in = std::ifstream{from, std::ios::binary};
+    if(!in)
+    {
+        MIOPEN_LOG_E("File is unreadable: " << from);
+        return false;
+    }
+
+    auto out = std::ofstream{to, std::ios::binary};
+    if(!out)
+    {
+        MIOPEN_LOG_E("File is unwritable: " << to);
+        return false;
+    }
+
+    out.write(BinaryDbMagic.data(), BinaryDbMagic.size());
+
+    auto line   = std::string{};
+    auto n_line = 0;
+
+    while(std::getline(in, line))
+    {
+        ++n_line;
+        if(line.empty())
+            continue;
+
+        const auto record = ParseText(line);
+        if(!record)
+        {
+            MIOPEN_LOG_E("Ill-formed record: " << from << "#" << n_line);
+            continue;
+        }
+
+        const auto payload = Encode(*record);
+        auto header        = std::string{};
+        Put(header, static_cast<std::uint32_t>(record->key.size()));
+        out << header << record->key;
+        header.clear();
+        Put(header, static_cast<std::uint32_t>(payload.size()));
+        out << header << payload;
+    }
+
+    return static_cast<bool>(out);
+}
+
+bool BinaryDbRecord::ConvertBinaryToText(const fs::path& from, const fs::path& to)
+{
+    auto in = std::ifstream{from, std::ios::binary};
+    if(!in)
+    {
+        MIOPEN_LOG_E("File is unreadable: " << from);
+        return false;
+    }
+
+    const auto data = std::string{std::istreambuf_iterator<char>{in}, {}};
+    const auto view = std::string_view{data};
+
+    if(view.substr(0, BinaryDbMagic.size()) != BinaryDbMagic)
+    {
+        MIOPEN_LOG_E("Not a binary db file: " << from);
+        return false;
+    }
+
+    auto out = std::ofstream{to, std::ios::binary};
+    if(!out)
+    {
+        MIOPEN_LOG_E("File is unwritable: " << to);
+        return false;
+    }
+
+    auto pos = BinaryDbMagic.size();
+
+    while(pos < view.size())
+    {
+        auto key_size     = std::uint32_t{};
+        auto payload_size = std::uint32_t{};
+        auto key          = std::string_view{};
+        auto payload      = std::string_view{};
+
+        if(!Get(view, pos, key_size) || !GetString(view, pos, key_size, key) ||
+           !Get(view, pos, payload_size) || !GetString(view, pos, payload_size, payload))
+        {
+            MIOPEN_LOG_E("Truncated binary db file: " << from);
+            return false;
+        }
+
+        const auto record = Decode(std::string{key}, payload);
+        if(!record)
+        {
+            MIOPEN_LOG_E("Ill-formed binary record under the key " << key << " in " << from);
+            continue;
+        }
+
+        if(record->GetSize() != 0)
+            out << ToText(*record) << '\n';
+    }
+
+    return static_cast<bool>(out);
+}
+
+} // namespace miopen
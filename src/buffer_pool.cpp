@@ -0,0 +1,190 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/buffer_pool.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+
+// Idle memory held by a handle is hidden from the allocators of the application, so the pool is
+// opt-in.
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_BUFFER_POOL_CAPACITY, 0)
+
+namespace miopen {
+
+namespace {
+constexpr std::size_t MinSizeClass = 256;
+} // namespace
+
+BufferPool::BufferPool() : BufferPool(env::value(MIOPEN_BUFFER_POOL_CAPACITY)) {}
+
+BufferPool::BufferPool(std::size_t capacity_) : capacity(capacity_) {}
+
+BufferPool::~BufferPool()
+{
+    if(!in_use.empty())
+        MIOPEN_LOG_W("Buffer pool is destroyed with " << in_use.size() << " buffers in use");
+    TrimImpl(0);
+}
+
+std::size_t BufferPool::GetSizeClass(std::size_t size)
+{
+    if(size <= MinSizeClass)
+        return MinSizeClass;
+
+    // Four classes per power of two keep the overhead within 25% for buffers above 1 KiB.
+    auto top = std::size_t{1};
+    while(top <= size / 2)
+        top <<= 1;
+    const auto step = std::max(MinSizeClass, top / 4);
+    return (size + step - 1) / step * step;
+}
+
+Allocator::ManageDataPtr BufferPool::Get(const Allocator& allocator, std::size_t size)
+{
+    if(size == 0)
+        return allocator(size);
+
+    const auto size_class = GetSizeClass(size);
+    auto buffer           = Allocator::ManageDataPtr{nullptr, AllocatorDeleter{}};
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    const auto found = idle.find(size_class);
+    if(found != idle.end())
+    {
+        buffer = std::move(found->second.back());
+        found->second.pop_back();
+        if(found->second.empty())
+            idle.erase(found);
+        counters.idle_bytes -= size_class;
+        ++counters.hits;
+    }
+    else
+    {
+        ++counters.misses;
+        lock.unlock();
+
+        try
+        {
+            buffer = allocator(size_class);
+        }
+        catch(const Exception&)
+        {
+            // Memory held by the idle buffers may be what is missing.
+            MIOPEN_LOG_I2("Allocation of " << size_class << " bytes failed, trimming buffer pool");
+            Trim();
+            buffer = allocator(size_class);
+        }
+
+        lock.lock();
+        ++counters.allocations;
+    }
+
+    const auto ptr = buffer.get();
+    counters.in_use_bytes += size_class;
+    in_use.emplace(ptr, InUse{std::move(buffer), size_class});
+
+    return Allocator::ManageDataPtr{ptr, AllocatorDeleter{&BufferPool::Release, this}};
+}
+
+void BufferPool::Release(void* context, void* ptr)
+{
+    static_cast<BufferPool*>(context)->Release(ptr);
+}
+
+void BufferPool::Release(void* ptr)
+{
+    // Freed after the lock is released.
+    auto freed = Allocator::ManageDataPtr{nullptr, AllocatorDeleter{}};
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto found = in_use.find(ptr);
+    if(found == in_use.end())
+    {
+        MIOPEN_LOG_E("Buffer " << ptr << " does not belong to the buffer pool");
+        return;
+    }
+
+    const auto size_class = found->second.size_class;
+    auto buffer           = std::move(found->second.buffer);
+    in_use.erase(found);
+    counters.in_use_bytes -= size_class;
+
+    if(counters.idle_bytes + size_class <= capacity)
+    {
+        idle[size_class].emplace_back(std::move(buffer));
+        counters.idle_bytes += size_class;
+    }
+    else
+    {
+        ++counters.deallocations;
+        freed = std::move(buffer);
+    }
+}
+
+void BufferPool::Trim(std::size_t target)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    TrimImpl(target);
+}
+
+void BufferPool::TrimImpl(std::size_t target)
+{
+    while(counters.idle_bytes > target && !idle.empty())
+    {
+        const auto largest = std::prev(idle.end());
+        largest->second.pop_back();
+        counters.idle_bytes -= largest->first;
+        ++counters.deallocations;
+        if(largest->second.empty())
+            idle.erase(largest);
+    }
+}
+
+void BufferPool::SetCapacity(std::size_t value)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    capacity = value;
+    TrimImpl(capacity);
+}
+
+std::size_t BufferPool::GetCapacity() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return capacity;
+}
+
+BufferPool::Counters BufferPool::GetCounters() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return counters;
+}
+
+} // namespace miopen
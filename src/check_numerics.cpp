@@ -75,8 +75,7 @@ bool checkNumericsImpl(
 {
     int numElements = dDesc.GetElementSize();
     CheckNumericsResult abnormal_h;
-    auto abnormal_d =
-        handle.Create(sizeof(CheckNumericsResult)); // TODO - someday avoid slow malloc/free here
+    auto abnormal_d = handle.CreateCached(sizeof(CheckNumericsResult));
     handle.WriteTo(&abnormal_h, abnormal_d, sizeof(CheckNumericsResult));
     const size_t threadsPerBlock = 256;
     const size_t numBlocks       = handle.GetMaxComputeUnits() * 6;
@@ -27,6 +27,7 @@
 #include <miopen/conv/heuristics/ai_heuristics.hpp>
 #if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK || MIOPEN_ENABLE_AI_KERNEL_TUNING
 #include <fdeep/fdeep.hpp>
+#include <miopen/conv/heuristics/ai_model.hpp>
 #include <miopen/filesystem.hpp>
 
 namespace miopen {
@@ -59,6 +60,65 @@ std::vector<V> LookupValues(const std::vector<U>& keys, const std::unordered_map
     });
     return values;
 }
+
+/** `Predictor` runs a model from its binary form when it is installed and from JSON otherwise
+ *
+ * The binary models are written by aimodel2bin at build time. They are memory mapped and need
+ * no parsing, so they are preferred. The JSON models are the fallback for the installations
+ * which only have those.
+ *
+ * @param path Path to the model without the extension, e.g. `<db>/gfx90a.tn`
+ */
+class Predictor
+{
+public:
+    Predictor(const fs::path& path)
+    {
+        auto bin_path = path;
+        bin_path += ".bin";
+        if(fs::exists(bin_path))
+        {
+            network = std::make_unique<Network>(bin_path);
+            return;
+        }
+
+        auto json_path = path;
+        json_path += ".model";
+        if(!fs::exists(json_path))
+            MIOPEN_THROW(miopenStatusInternalError, "Unable to load AI model file: " + json_path);
+        MIOPEN_LOG_I2("Binary AI model is not available, loading " << json_path);
+        model = std::make_unique<fdeep::model>(
+            fdeep::load_model(json_path.string(), true, fdeep::dev_null_logger));
+    }
+
+    /**
+     * Run inference
+     *
+     * @param inputs Input tensors, row-major
+     * @param first_shape Shape of the first input for the JSON model, the others are vectors
+     */
+    std::vector<std::vector<float>> Predict(const std::vector<std::vector<float>>& inputs,
+                                            const fdeep::tensor_shape& first_shape) const
+    {
+        if(network)
+            return network->Predict(inputs);
+
+        fdeep::tensors tensors;
+        for(const auto& input : inputs)
+        {
+            tensors.emplace_back(tensors.empty() ? first_shape : fdeep::tensor_shape(input.size()),
+                                 input);
+        }
+        std::vector<std::vector<float>> outputs;
+        for(const auto& output : model->predict(tensors))
+            outputs.push_back(output.to_vector());
+        return outputs;
+    }
+
+private:
+    std::unique_ptr<Network> network;
+    std::unique_ptr<fdeep::model> model;
+};
 } // namespace common
 
 #if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK
@@ -126,7 +186,7 @@ public:
     Metadata metadata;
     Model(const std::string& arch)
         : metadata(Metadata(arch)),
-          model(fdeep::load_model(ModelPath(arch), true, fdeep::dev_null_logger)),
+          model(GetSystemDbPath() / (arch + ".tn")),
           input_shape(fdeep::tensor_shape(metadata.num_inputs)),
           offset(metadata.num_outputs - metadata.num_solvers)
     {
@@ -157,33 +217,18 @@ public:
      */
     std::vector<float> Forward(const conv::ProblemDescription& problem) const
     {
-        std::vector<float> features       = ToFeatures(problem);
-        std::vector<fdeep::tensor> output = model.predict({fdeep::tensor(input_shape, features)});
-        std::vector<float> output_vector  = output.front().to_vector();
-        std::vector<float> res(output_vector.begin() + offset, output_vector.end());
+        std::vector<float> features = ToFeatures(problem);
+        std::vector<float> output   = model.Predict({features}, input_shape).front();
+        std::vector<float> res(output.begin() + offset, output.end());
         return res;
     }
 
 protected:
-    const fdeep::model model;              // TunaNet model
+    const common::Predictor model;         // TunaNet model
     const fdeep::tensor_shape input_shape; // Shape of input tensor required by TunaNet
     const size_t offset; // Some TunaNet models output some "fluff" before they output kernel
                          // probabilites. This offset tells how many indexes of fluff need to
                          // be skipped in order to get to kernel probabilities.
-    /** Path to model file for given GPU
-     *
-     * The model files for each GPU are identified by the GPU architecture. This function takes
-     * in a GPU architecture and returns the path to its TunaNet model.
-     *
-     * @param arch Architecture
-     */
-    static std::string ModelPath(const std::string& arch)
-    {
-        const auto file_path = GetSystemDbPath() / (arch + ".tn.model");
-        if(!fs::exists(file_path))
-            MIOPEN_THROW(miopenStatusInternalError, "Unable to load AI model file:" + file_path);
-        return file_path.string();
-    }
     /** Convert given problem to a numeric vector
      *
      * TunaNet takes in a numeric vector representing the given problem. The exact details
@@ -595,8 +640,8 @@ public:
     Metadata metadata;
     Model(const std::string& arch, const std::string& solver)
         : metadata(Metadata(arch, solver)),
-          encoder(fdeep::load_model(EncoderPath(arch, solver), true, fdeep::dev_null_logger)),
-          decoder(fdeep::load_model(DecoderPath(arch, solver), true, fdeep::dev_null_logger))
+          encoder(GetSystemDbPath() / (arch + "_" + solver + "_encoder.ktn")),
+          decoder(GetSystemDbPath() / (arch + "_" + solver + "_decoder.ktn"))
     {
     }
     virtual ~Model() = default;
@@ -608,15 +653,13 @@ public:
      *            is True and sqrt(len(features)) otherwise)
      * @param transform Reshape input features into a square matrix?
      */
-    fdeep::tensors Encode(const std::vector<float>& features, std::size_t dim, bool transform) const
+    std::vector<std::vector<float>>
+    Encode(const std::vector<float>& features, std::size_t dim, bool transform) const
     {
         // if transform==True, reshape input features into a matrix of `dim x dim` dimensions.
         // otherwise, have them as a vector of size `dim`.
         const auto tensor_shape_depth = transform ? dim : 1;
-        fdeep::tensor input_tensor =
-            fdeep::tensor(fdeep::tensor_shape(dim, tensor_shape_depth), features);
-
-        return encoder.predict({input_tensor});
+        return encoder.Predict({features}, fdeep::tensor_shape(dim, tensor_shape_depth));
     }
     /**
      * Decode the next token based on the previous token and the encoded context.
@@ -630,33 +673,16 @@ public:
      * @param prev_token Previous token
      * @param context Context vector obtained from encoder
      */
-    fdeep::tensors Decode(const float prev_token, const fdeep::tensors& context) const
+    std::vector<std::vector<float>> Decode(const float prev_token,
+                                           const std::vector<std::vector<float>>& context) const
     {
-        return decoder.predict(
-            {{fdeep::tensor(fdeep::tensor_shape(1), std::vector<float>(1, prev_token)),
-              context[0],
-              context[1],
-              context[2],
-              context[3]}});
+        return decoder.Predict({{prev_token}, context[0], context[1], context[2], context[3]},
+                               fdeep::tensor_shape(1));
     }
 
 private:
-    const fdeep::model encoder;
-    const fdeep::model decoder;
-    static std::string EncoderPath(const std::string& arch, const std::string& solver)
-    {
-        const auto path = GetSystemDbPath() / (arch + "_" + solver + "_encoder.ktn.model");
-        if(!fs::exists(path))
-            MIOPEN_THROW(miopenStatusInternalError, "Unable to load file: " + path);
-        return path.string();
-    }
-    static std::string DecoderPath(const std::string& arch, const std::string& solver)
-    {
-        const auto path = GetSystemDbPath() / (arch + "_" + solver + "_decoder.ktn.model");
-        if(!fs::exists(path))
-            MIOPEN_THROW(miopenStatusInternalError, "Unable to load file: " + path);
-        return path.string();
-    }
+    const common::Predictor encoder;
+    const common::Predictor decoder;
 };
 
 /**
@@ -714,8 +740,8 @@ bool ModelSetParams(const std::string& arch,
     else
         dim = features.size();
     auto start             = std::chrono::high_resolution_clock::now();
-    fdeep::tensors context = model->Encode(features, dim, transform_features);
-    float decoder_input    = 0.0;
+    auto context        = model->Encode(features, dim, transform_features);
+    float decoder_input = 0.0;
 
     // set direction string
     std::string dir;
@@ -734,9 +760,9 @@ bool ModelSetParams(const std::string& arch,
         if(i == 0 && (model->metadata.predict_type == 0u))
             num_tuning_params = model->metadata.num_tuning_params[dir];
 
-        fdeep::tensors decoder_output = model->Decode(decoder_input, context);
-        auto token_scores             = decoder_output[0].to_vector(); // token_scores[k] gives the
-                                                                       // score of the k-th token
+        auto decoder_output = model->Decode(decoder_input, context);
+        auto token_scores   = decoder_output[0]; // token_scores[k] gives the
+                                                 // score of the k-th token
         // order tokens according to their scores
         std::priority_queue<std::pair<float, int>> pq;
         for(int j = 0; j < token_scores.size(); j++)
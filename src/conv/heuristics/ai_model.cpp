@@ -0,0 +1,415 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/heuristics/ai_model.hpp>
+#include <miopen/conv/heuristics/ai_model_format.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/load_file.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace miopen {
+namespace ai {
+
+namespace format = model_format;
+
+namespace {
+
+struct Shape
+{
+    std::size_t rows;
+    std::size_t cols;
+
+    std::size_t Size() const { return rows * cols; }
+    bool operator==(const Shape& other) const { return rows == other.rows && cols == other.cols; }
+};
+
+const format::Header& GetHeader(const MappedFile& file)
+{
+    return *reinterpret_cast<const format::Header*>(file.data());
+}
+
+const format::Node* GetNodes(const MappedFile& file)
+{
+    return reinterpret_cast<const format::Node*>(file.data() + sizeof(format::Header));
+}
+
+const format::NodeOutput* GetOutputs(const MappedFile& file)
+{
+    return reinterpret_cast<const format::NodeOutput*>(GetNodes(file) +
+                                                       GetHeader(file).num_nodes);
+}
+
+/// exp(x) to a few ulp, written without calls or branches so that the loops over the LSTM
+/// gates vectorize. It follows the polynomial of the Cephes expf.
+float Exp(float x)
+{
+    x = std::min(std::max(x, -87.0f), 88.0f);
+
+    // x = n ln2 + r, |r| <= ln2 / 2, with ln2 split in two parts to keep r exact.
+    const auto n  = static_cast<std::int32_t>(x * 1.44269504f + (x < 0.0f ? -0.5f : 0.5f));
+    const auto fn = static_cast<float>(n);
+    const auto r  = x - fn * 0.693359375f + fn * 2.12194440e-4f;
+
+    auto p = 1.9875691500e-4f;
+    p      = p * r + 1.3981999507e-3f;
+    p      = p * r + 8.3334519073e-3f;
+    p      = p * r + 4.1665795894e-2f;
+    p      = p * r + 1.6666665459e-1f;
+    p      = p * r + 5.0000001201e-1f;
+    p      = p * r * r + r + 1.0f;
+
+    const auto scale_bits = static_cast<std::uint32_t>(n + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &scale_bits, sizeof(scale));
+    return p * scale;
+}
+
+float Sigmoid(float x) { return 1.0f / (1.0f + Exp(-x)); }
+
+float Tanh(float x) { return 1.0f - 2.0f / (Exp(2.0f * x) + 1.0f); }
+
+/// y += x * w, where x is a row of n elements and w is a row-major n x m matrix.
+///
+/// The columns are processed in tiles kept in registers across the whole reduction, so w is
+/// streamed once with contiguous loads the compiler turns into vector FMAs.
+void Gemv(const float* x, const float* w, std::size_t n, std::size_t m, float* y)
+{
+    constexpr std::size_t tile = 32;
+
+    auto col = std::size_t{0};
+    for(; col + tile <= m; col += tile)
+    {
+        float acc[tile];
+        std::copy_n(y + col, tile, acc);
+        for(auto k = std::size_t{0}; k < n; ++k)
+        {
+            const auto xk  = x[k];
+            const auto* wk = w + k * m + col;
+            for(auto j = std::size_t{0}; j < tile; ++j)
+                acc[j] += xk * wk[j];
+        }
+        std::copy_n(acc, tile, y + col);
+    }
+
+    if(col == m)
+        return;
+    for(auto k = std::size_t{0}; k < n; ++k)
+    {
+        const auto xk  = x[k];
+        const auto* wk = w + k * m;
+        for(auto j = col; j < m; ++j)
+            y[j] += xk * wk[j];
+    }
+}
+
+} // namespace
+
+struct Network::Layer
+{
+    const format::Node* node;
+    const float* weights[std::extent_v<decltype(format::Node::weights)>];
+    std::vector<Shape> shapes;
+    /// Where each output lives in the workspace, followed by the scratch space of the layer.
+    std::vector<std::size_t> offsets;
+};
+
+Network::Network(const fs::path& path_) : path(path_), file(std::make_unique<MappedFile>(path))
+{
+    const auto throw_invalid = [&](const std::string& reason) {
+        MIOPEN_THROW(miopenStatusInternalError, "Invalid AI model " + path + ": " + reason);
+    };
+
+    if(file->size() < sizeof(format::Header))
+        throw_invalid("too small");
+    const auto& header = GetHeader(*file);
+    if(!std::equal(std::begin(format::Magic), std::end(format::Magic), header.magic))
+        throw_invalid("not a model");
+    if(header.version != format::Version)
+        throw_invalid("unsupported version " + std::to_string(header.version));
+    const auto graph_size = sizeof(format::Header) + header.num_nodes * sizeof(format::Node) +
+                            header.num_outputs * sizeof(format::NodeOutput);
+    if(header.data_offset < graph_size || header.data_offset % format::DataAlignment != 0 ||
+       header.data_offset > file->size() ||
+       header.data_size > (file->size() - header.data_offset) / sizeof(float))
+        throw_invalid("truncated");
+    MIOPEN_LOG_I2("Mapped AI model " << path << ", " << header.num_nodes << " layers");
+}
+
+Network::~Network() = default;
+
+void Network::InitLayers() const
+{
+    const auto& header = GetHeader(*file);
+    const auto* nodes  = GetNodes(*file);
+    const auto* data   = reinterpret_cast<const float*>(file->data() + header.data_offset);
+
+    const auto throw_invalid = [&](std::size_t node, const std::string& reason) {
+        MIOPEN_THROW(miopenStatusInternalError,
+                     "Invalid AI model " + path + ", layer " + std::to_string(node) + ": " +
+                         reason);
+    };
+
+    // std::call_once retries after a throw, so nothing is kept until every layer is valid.
+    auto built   = std::vector<Layer>{};
+    auto ws_size = std::size_t{0};
+    built.reserve(header.num_nodes);
+    for(auto i = std::size_t{0}; i < header.num_nodes; ++i)
+    {
+        const auto& node = nodes[i];
+        auto layer       = Layer{&node, {}, {}, {}};
+
+        auto inputs = std::vector<Shape>{};
+        if(node.num_inputs > format::MaxInputs)
+            throw_invalid(i, "too many inputs");
+        for(auto j = std::size_t{0}; j < node.num_inputs; ++j)
+        {
+            const auto& input = node.inputs[j];
+            if(input.node >= i || input.output >= built[input.node].shapes.size())
+                throw_invalid(i, "invalid input");
+            inputs.push_back(built[input.node].shapes[input.output]);
+        }
+
+        const auto set_weights = [&](std::size_t index, std::size_t size) {
+            const auto offset = node.weights[index];
+            if(offset > header.data_size || size > header.data_size - offset)
+                throw_invalid(i, "weights out of bounds");
+            layer.weights[index] = data + offset;
+        };
+        const auto check_inputs = [&](std::size_t min, std::size_t max) {
+            if(inputs.size() < min || inputs.size() > max)
+                throw_invalid(i, "unexpected number of inputs");
+        };
+
+        const auto p = node.params;
+        switch(node.type)
+        {
+        case format::LayerType::Input:
+            check_inputs(0, 0);
+            layer.shapes = {{p[0], p[1]}};
+            break;
+        case format::LayerType::Dense:
+            check_inputs(1, 1);
+            if(inputs[0].cols != p[0])
+                throw_invalid(i, "unexpected input shape");
+            set_weights(0, std::size_t{p[0]} * p[1]);
+            if(node.weights[1] != format::NoWeights)
+                set_weights(1, p[1]);
+            layer.shapes = {{inputs[0].rows, p[1]}};
+            break;
+        case format::LayerType::ReLU:
+            check_inputs(1, 1);
+            layer.shapes = {inputs[0]};
+            break;
+        case format::LayerType::Add:
+            check_inputs(2, 2);
+            if(!(inputs[0] == inputs[1]))
+                throw_invalid(i, "unexpected input shape");
+            layer.shapes = {inputs[0]};
+            break;
+        case format::LayerType::Embedding:
+            check_inputs(1, 1);
+            set_weights(0, std::size_t{p[0]} * p[1]);
+            layer.shapes = {{inputs[0].Size(), p[1]}};
+            break;
+        case format::LayerType::LSTM:
+            check_inputs(1, 3);
+            if(inputs[0].cols != p[0] || inputs.size() == 2 ||
+               (inputs.size() == 3 && !(inputs[1] == Shape{1, p[1]} && inputs[2] == inputs[1])))
+                throw_invalid(i, "unexpected input shape");
+            set_weights(0, std::size_t{p[0]} * 4 * p[1]);
+            set_weights(1, std::size_t{p[1]} * 4 * p[1]);
+            set_weights(2, std::size_t{4} * p[1]);
+            layer.shapes = {{p[2] != 0 ? inputs[0].rows : 1, p[1]}, {1, p[1]}, {1, p[1]}};
+            break;
+        default: throw_invalid(i, "unknown type");
+        }
+        for(const auto& shape : layer.shapes)
+        {
+            layer.offsets.push_back(ws_size);
+            ws_size += shape.Size();
+        }
+        if(node.type == format::LayerType::LSTM)
+        {
+            // The gate pre-activations of one step.
+            layer.offsets.push_back(ws_size);
+            ws_size += std::size_t{4} * p[1];
+        }
+        built.push_back(layer);
+    }
+
+    const auto* outputs = GetOutputs(*file);
+    for(auto i = std::size_t{0}; i < header.num_outputs; ++i)
+    {
+        if(outputs[i].node >= built.size() ||
+           outputs[i].output >= built[outputs[i].node].shapes.size())
+            throw_invalid(outputs[i].node, "invalid output");
+    }
+
+    layers.swap(built);
+    workspace_size = ws_size;
+}
+
+std::vector<std::vector<float>>
+Network::Predict(const std::vector<std::vector<float>>& inputs) const
+{
+    std::call_once(layers_init, [this]() { InitLayers(); });
+
+    // All activations of a prediction live in one buffer, which is reused by the later
+    // predictions of the thread, so that the layers do not allocate.
+    thread_local auto workspace = std::vector<float>{};
+    if(workspace.size() < workspace_size)
+        workspace.resize(workspace_size);
+    float* const ws = workspace.data();
+
+    auto next_input = std::size_t{0};
+
+    for(const auto& layer : layers)
+    {
+        const auto& node = *layer.node;
+        const auto p     = node.params;
+        const auto in    = [&](std::size_t j) -> const float* {
+            return ws + layers[node.inputs[j].node].offsets[node.inputs[j].output];
+        };
+        const auto in_size = [&](std::size_t j) {
+            return layers[node.inputs[j].node].shapes[node.inputs[j].output].Size();
+        };
+        float* const out = ws + layer.offsets[0];
+
+        switch(node.type)
+        {
+        case format::LayerType::Input:
+            if(next_input >= inputs.size() || inputs[next_input].size() != layer.shapes[0].Size())
+                MIOPEN_THROW(miopenStatusBadParm,
+                             "Unexpected input " + std::to_string(next_input) + " of AI model " +
+                                 path);
+            std::copy(inputs[next_input].begin(), inputs[next_input].end(), out);
+            ++next_input;
+            break;
+        case format::LayerType::Dense:
+            for(auto r = std::size_t{0}; r < layer.shapes[0].rows; ++r)
+            {
+                auto* y = out + r * p[1];
+                if(layer.weights[1] != nullptr)
+                    std::copy_n(layer.weights[1], p[1], y);
+                else
+                    std::fill_n(y, p[1], 0.0f);
+                Gemv(in(0) + r * p[0], layer.weights[0], p[0], p[1], y);
+            }
+            break;
+        case format::LayerType::ReLU:
+            std::transform(
+                in(0), in(0) + in_size(0), out, [](auto x) { return std::max(x, 0.0f); });
+            break;
+        case format::LayerType::Add:
+            std::transform(
+                in(0), in(0) + in_size(0), in(1), out, [](auto x, auto y) { return x + y; });
+            break;
+        case format::LayerType::Embedding:
+            for(auto t = std::size_t{0}; t < in_size(0); ++t)
+            {
+                const auto token = static_cast<long>(in(0)[t]);
+                if(token < 0 || token >= static_cast<long>(p[0]))
+                    MIOPEN_THROW(miopenStatusBadParm,
+                                 "Token out of range of AI model " + path + ": " +
+                                     std::to_string(token));
+                std::copy_n(layer.weights[0] + token * p[1], p[1], out + t * p[1]);
+            }
+            break;
+        case format::LayerType::LSTM: {
+            const auto units = std::size_t{p[1]};
+            const auto steps = in_size(0) / p[0];
+            float* const h   = ws + layer.offsets[1];
+            float* const c   = ws + layer.offsets[2];
+            float* const z   = ws + layer.offsets[3];
+            if(node.num_inputs == 3)
+            {
+                std::copy_n(in(1), units, h);
+                std::copy_n(in(2), units, c);
+            }
+            else
+            {
+                std::fill_n(h, units, 0.0f);
+                std::fill_n(c, units, 0.0f);
+            }
+
+            for(auto t = std::size_t{0}; t < steps; ++t)
+            {
+                std::copy_n(layer.weights[2], 4 * units, z);
+                Gemv(in(0) + t * p[0], layer.weights[0], p[0], 4 * units, z);
+                Gemv(h, layer.weights[1], units, 4 * units, z);
+
+                // The gates are i, f, g and o.
+                std::transform(z, z + 2 * units, z, Sigmoid);
+                std::transform(z + 2 * units, z + 3 * units, z + 2 * units, Tanh);
+                std::transform(z + 3 * units, z + 4 * units, z + 3 * units, Sigmoid);
+                for(auto u = std::size_t{0}; u < units; ++u)
+                {
+                    c[u] = z[units + u] * c[u] + z[u] * z[2 * units + u];
+                    h[u] = z[3 * units + u] * Tanh(c[u]);
+                }
+                if(p[2] != 0)
+                    std::copy_n(h, units, out + t * units);
+            }
+            if(p[2] == 0)
+                std::copy_n(h, units, out);
+            break;
+        }
+        }
+    }
+
+    const auto& header  = GetHeader(*file);
+    const auto* outputs = GetOutputs(*file);
+    auto result         = std::vector<std::vector<float>>{};
+    result.reserve(header.num_outputs);
+    for(auto i = std::size_t{0}; i < header.num_outputs; ++i)
+    {
+        const auto& layer = layers[outputs[i].node];
+        const auto* data  = ws + layer.offsets[outputs[i].output];
+        result.emplace_back(data, data + layer.shapes[outputs[i].output].Size());
+    }
+    return result;
+}
+
+std::vector<std::size_t> Network::GetInputSizes() const
+{
+    const auto& header = GetHeader(*file);
+    const auto* nodes  = GetNodes(*file);
+    auto sizes         = std::vector<std::size_t>{};
+    for(auto i = std::size_t{0}; i < header.num_nodes; ++i)
+    {
+        if(nodes[i].type == format::LayerType::Input)
+            sizes.push_back(std::size_t{nodes[i].params[0]} * nodes[i].params[1]);
+    }
+    return sizes;
+}
+
+} // namespace ai
+} // namespace miopen
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/problem_features.hpp>
+
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/stringutils.hpp>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_FEATURE_FILTER)
+
+namespace miopen {
+namespace conv {
+
+namespace {
+
+ProblemFeature GetTypeFeature(miopenDataType_t type)
+{
+    switch(type)
+    {
+    case miopenFloat: return ProblemFeature::TypeFp32;
+    case miopenHalf: return ProblemFeature::TypeFp16;
+    case miopenBFloat16: return ProblemFeature::TypeBfp16;
+    case miopenInt8: return ProblemFeature::TypeInt8;
+    case miopenInt32: return ProblemFeature::TypeInt32;
+    case miopenFloat8:
+    case miopenBFloat8: return ProblemFeature::TypeFp8;
+    case miopenInt64:
+    case miopenDouble: break;
+    }
+    return ProblemFeature::TypeOther;
+}
+
+ProblemFeature GetTargetFeature(const std::string& name)
+{
+    if(StartsWith(name, "gfx8"))
+        return ProblemFeature::TargetGfx8;
+    if(name == "gfx900")
+        return ProblemFeature::TargetGfx900;
+    if(name == "gfx906")
+        return ProblemFeature::TargetGfx906;
+    if(name == "gfx908")
+        return ProblemFeature::TargetGfx908;
+    if(name == "gfx90a")
+        return ProblemFeature::TargetGfx90a;
+    if(StartsWith(name, "gfx94"))
+        return ProblemFeature::TargetGfx94x;
+    if(StartsWith(name, "gfx9"))
+        return ProblemFeature::TargetGfx9Other;
+    if(StartsWith(name, "gfx10"))
+        return ProblemFeature::TargetGfx10;
+    if(StartsWith(name, "gfx11"))
+        return ProblemFeature::TargetGfx11;
+    if(StartsWith(name, "gfx12"))
+        return ProblemFeature::TargetGfx12;
+    return ProblemFeature::TargetOther;
+}
+
+bool AllOnes(const ProblemDescription& problem, int d, int h, int w)
+{
+    return (!problem.Is3d() || d == 1) && h == 1 && w == 1;
+}
+
+ProblemFeature GetFilterFeature(const ProblemDescription& problem)
+{
+    const auto is = [&](std::size_t size) {
+        return (!problem.Is3d() || problem.GetWeightsDepth() == size) &&
+               problem.GetWeightsHeight() == size && problem.GetWeightsWidth() == size;
+    };
+    if(is(1))
+        return ProblemFeature::Filter1x1;
+    if(is(3))
+        return ProblemFeature::Filter3x3;
+    return ProblemFeature::FilterOther;
+}
+
+} // namespace
+
+ProblemFeatures GetProblemFeatures(const ProblemDescription& problem,
+                                   const std::string& device_name)
+{
+    const auto layout = problem.IsLayoutDefault() ? ProblemFeature::LayoutDefault
+                        : problem.IsLayoutNHWC()  ? ProblemFeature::LayoutNHWC
+                                                  : ProblemFeature::LayoutOther;
+
+    const auto direction = problem.IsDirectionForward() ? ProblemFeature::DirectionForward
+                           : problem.IsDirectionBackwardData()
+                               ? ProblemFeature::DirectionBackwardData
+                               : ProblemFeature::DirectionBackwardWrW;
+
+    const auto stride = AllOnes(problem,
+                                problem.GetKernelStrideD(),
+                                problem.GetKernelStrideH(),
+                                problem.GetKernelStrideW())
+                            ? ProblemFeature::StrideOne
+                            : ProblemFeature::StrideOther;
+
+    const auto dilation =
+        AllOnes(problem, problem.GetDilationD(), problem.GetDilationH(), problem.GetDilationW())
+            ? ProblemFeature::DilationOne
+            : ProblemFeature::DilationOther;
+
+    // Only the classes which solvers are able to reject are computed. Problems with other
+    // spatial dims than 2 or 3 get no spatial feature and are never rejected on it.
+    auto features = FeatureBits({layout,
+                                 direction,
+                                 stride,
+                                 dilation,
+                                 GetFilterFeature(problem),
+                                 GetTypeFeature(problem.GetInDataType()),
+                                 GetTypeFeature(problem.GetWeightsDataType()),
+                                 GetTypeFeature(problem.GetOutDataType()),
+                                 problem.GetGroupCount() == 1 ? ProblemFeature::GroupsOne
+                                                              : ProblemFeature::GroupsMany,
+                                 GetTargetFeature(device_name)});
+
+    if(problem.Is2d())
+        features |= FeatureBits({ProblemFeature::Spatial2d});
+    else if(problem.Is3d())
+        features |= FeatureBits({ProblemFeature::Spatial3d});
+
+    return features;
+}
+
+ProblemFeatures GetProblemFeatures(const ExecutionContext& ctx, const ProblemDescription& problem)
+{
+    if(env::disabled(MIOPEN_DEBUG_CONV_FEATURE_FILTER))
+        return 0;
+    return GetProblemFeatures(problem, ctx.GetStream().GetDeviceName());
+}
+
+} // namespace conv
+} // namespace miopen
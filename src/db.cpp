@@ -41,6 +41,7 @@
 #include <fstream>
 #include <ios>
 #include <mutex>
+#include <set>
 #include <shared_mutex>
 #include <string>
 #include <vector>
@@ -48,6 +49,13 @@
 namespace miopen {
 
 PlainTextDb::PlainTextDb(DbKinds db_kind_, const fs::path& filename_, bool is_system)
+    : PlainTextDb(db_kind_, filename_, is_system, NoJournal{})
+{
+    if(!DisableUserDbFileIO)
+        journal = DbJournal::Get(db_kind, filename);
+}
+
+PlainTextDb::PlainTextDb(DbKinds db_kind_, const fs::path& filename_, bool is_system, NoJournal)
     : db_kind(db_kind_),
       filename(filename_),
       lock_file(LockFile::Get(LockFilePath(filename_))),
@@ -90,13 +98,21 @@ boost::optional<DbRecord> PlainTextDb::FindRecord(const std::string& key)
         return {};
     const auto lock = shared_lock(lock_file, GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
-    return FindRecordUnsafe(key, nullptr);
+    auto record = FindRecordUnsafe(key, nullptr);
+    if(journal != nullptr)
+        return journal->Apply(key, std::move(record));
+    return record;
 }
 
 bool PlainTextDb::StoreRecord(const DbRecord& record)
 {
     if(DisableUserDbFileIO)
         return true;
+    if(journal != nullptr)
+    {
+        journal->Store(record);
+        return true;
+    }
     const auto lock = exclusive_lock(lock_file, GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
     return StoreRecordUnsafe(record);
@@ -106,6 +122,14 @@ bool PlainTextDb::UpdateRecord(DbRecord& record)
 {
     if(DisableUserDbFileIO)
         return true;
+    if(journal != nullptr)
+    {
+        const auto old_record = FindRecord(record.key);
+        journal->Update(record);
+        if(old_record)
+            record.Merge(*old_record);
+        return true;
+    }
     const auto lock = exclusive_lock(lock_file, GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
     return UpdateRecordUnsafe(record);
@@ -115,6 +139,11 @@ bool PlainTextDb::RemoveRecord(const std::string& key)
 {
     if(DisableUserDbFileIO)
         return true;
+    if(journal != nullptr)
+    {
+        journal->Remove(key);
+        return true;
+    }
     const auto lock = exclusive_lock(lock_file, GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
     return RemoveRecordUnsafe(key);
@@ -124,6 +153,14 @@ bool PlainTextDb::Remove(const std::string& key, const std::string& id)
 {
     if(DisableUserDbFileIO)
         return true;
+    if(journal != nullptr)
+    {
+        auto record = FindRecord(key);
+        if(!record || !record->EraseValues(id))
+            return false;
+        journal->Store(*record);
+        return true;
+    }
     const auto lock = exclusive_lock(lock_file, GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
     auto record = FindRecordUnsafe(key, nullptr);
@@ -330,4 +367,72 @@ bool PlainTextDb::RemoveRecordUnsafe(const std::string& key)
     return FlushUnsafe(empty_record, &pos);
 }
 
+bool PlainTextDb::FoldJournalUnsafe(const DbJournalEntries& entries)
+{
+    // Folds all the changes in a single pass: records with pending changes are rewritten in
+    // place and the remaining ones are appended.
+    MIOPEN_LOG_I2("Folding " << entries.size() << " records into " << filename);
+
+    auto from            = std::ifstream{filename, std::ios::binary};
+    const auto temp_name = filename + ".temp";
+    auto to              = std::ofstream{temp_name, std::ios::binary};
+
+    if(!to)
+    {
+        MIOPEN_LOG_E("Temp file is unwritable: " << temp_name);
+        return false;
+    }
+
+    auto folded = std::set<std::string>{};
+    auto line   = std::string{};
+
+    while(from && std::getline(from, line))
+    {
+        const auto key_size = line.find('=');
+        const auto it       = key_size == std::string::npos || key_size == 0
+                                  ? entries.end()
+                                  : entries.find(line.substr(0, key_size));
+
+        if(it == entries.end())
+        {
+            to << line << '\n';
+            continue;
+        }
+
+        // Only the first record under a key is ever read, drop the rest.
+        if(!folded.insert(it->first).second)
+            continue;
+
+        auto record = it->second.record;
+        if(!it->second.replace)
+        {
+            auto old_record = DbRecord{it->first};
+            if(old_record.ParseContents(line.substr(key_size + 1)))
+                record.Merge(old_record);
+        }
+        record.WriteContents(to);
+    }
+
+    for(const auto& entry : entries)
+    {
+        if(folded.find(entry.first) == folded.end())
+            entry.second.record.WriteContents(to);
+    }
+
+    from.close();
+    to.close();
+
+    if(!to)
+    {
+        MIOPEN_LOG_E("Error writing temp file: " << temp_name);
+        return false;
+    }
+
+    if(fs::exists(filename))
+        fs::remove(filename);
+    fs::rename(temp_name, filename);
+    fs::permissions(filename, FS_ENUM_PERMS_ALL);
+    return true;
+}
+
 } // namespace miopen
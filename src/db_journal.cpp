@@ -0,0 +1,371 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/db_journal.hpp>
+
+#include <miopen/db.hpp>
+#include <miopen/env.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/ramdb.hpp>
+
+#include <cerrno>
+#include <chrono>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DB_JOURNAL)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DB_JOURNAL_THRESHOLD, 256)
+
+namespace miopen {
+
+namespace {
+
+long GetProcessId()
+{
+#ifdef _WIN32
+    return _getpid();
+#else
+    return ::getpid();
+#endif
+}
+
+std::string GetHostName()
+{
+#ifdef _WIN32
+    return "localhost";
+#else
+    char name[256] = {};
+    if(::gethostname(name, sizeof(name) - 1) != 0)
+        return "localhost";
+    return name;
+#endif
+}
+
+std::chrono::seconds GetLockTimeout() { return std::chrono::seconds{60}; }
+
+bool IsProcessAlive(long pid)
+{
+#ifdef _WIN32
+    // Without a reliable check journals of other processes are never recovered.
+    std::ignore = pid;
+    return true;
+#else
+    return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+#endif
+}
+
+std::string GetJournalPrefix(const fs::path& db_path)
+{
+    return db_path.filename().string() + ".journal." + GetHostName() + ".";
+}
+
+void AddChange(DbJournalEntries& entries, char op, const DbRecord& record)
+{
+    const auto& key = record.GetKey();
+    const auto it   = entries.find(key);
+
+    if(op != 'U' || it == entries.end())
+    {
+        entries.insert_or_assign(key, DbJournalEntry{op != 'U', record});
+        return;
+    }
+
+    auto merged = record;
+    merged.Merge(it->second.record);
+    it->second.record = std::move(merged);
+}
+
+} // namespace
+
+DbJournal::DbJournal(DbKinds db_kind_, const fs::path& db_path_)
+    : db_kind(db_kind_),
+      db_path(db_path_),
+      path(db_path_.parent_path() /
+           (GetJournalPrefix(db_path_) + std::to_string(GetProcessId())))
+{
+    RecoverOrphans();
+}
+
+DbJournal::~DbJournal()
+{
+    const std::lock_guard<std::mutex> lock{mutex};
+    FlushUnsafe();
+}
+
+bool DbJournal::IsEnabled() { return env::enabled(MIOPEN_DB_JOURNAL); }
+
+DbJournal* DbJournal::Get(DbKinds db_kind, const fs::path& db_path)
+{
+    if(!IsEnabled())
+        return nullptr;
+
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::mutex mutex;
+    const std::lock_guard<std::mutex> lock{mutex};
+
+    // Destroying the journals flushes them at exit.
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static auto instances = std::map<fs::path, std::unique_ptr<DbJournal>>{};
+    const auto it         = instances.find(db_path);
+
+    if(it != instances.end())
+        return it->second.get();
+
+    return instances.emplace(db_path, std::make_unique<DbJournal>(db_kind, db_path))
+        .first->second.get();
+}
+
+void DbJournal::Store(const DbRecord& record)
+{
+    MIOPEN_LOG_I2("Journaling store of " << record.GetKey() << " for file " << db_path);
+    const std::lock_guard<std::mutex> lock{mutex};
+    AppendUnsafe('S', record);
+    AddChange(pending, 'S', record);
+    FlushIfNeededUnsafe();
+}
+
+void DbJournal::Update(const DbRecord& record)
+{
+    MIOPEN_LOG_I2("Journaling update of " << record.GetKey() << " for file " << db_path);
+    const std::lock_guard<std::mutex> lock{mutex};
+    AppendUnsafe('U', record);
+    AddChange(pending, 'U', record);
+    FlushIfNeededUnsafe();
+}
+
+void DbJournal::Remove(const std::string& key)
+{
+    MIOPEN_LOG_I2("Journaling removal of " << key << " for file " << db_path);
+    const auto record = DbRecord{key};
+    const std::lock_guard<std::mutex> lock{mutex};
+    AppendUnsafe('R', record);
+    AddChange(pending, 'R', record);
+    FlushIfNeededUnsafe();
+}
+
+boost::optional<DbRecord> DbJournal::Apply(const std::string& key,
+                                           boost::optional<DbRecord> record) const
+{
+    const std::lock_guard<std::mutex> lock{mutex};
+    const auto it = pending.find(key);
+
+    if(it == pending.end())
+        return record;
+
+    const auto& entry = it->second;
+
+    if(entry.replace)
+    {
+        if(entry.record.GetSize() == 0)
+            return boost::none;
+        return entry.record;
+    }
+
+    auto merged = entry.record;
+    if(record)
+        merged.Merge(*record);
+    if(merged.GetSize() == 0)
+        return boost::none;
+    return merged;
+}
+
+bool DbJournal::Flush()
+{
+    const std::lock_guard<std::mutex> lock{mutex};
+    return FlushUnsafe();
+}
+
+std::size_t DbJournal::GetPendingCount() const
+{
+    const std::lock_guard<std::mutex> lock{mutex};
+    return pending.size();
+}
+
+bool DbJournal::Read(const fs::path& journal_path, DbJournalEntries& entries)
+{
+    auto file = std::ifstream{journal_path, std::ios::binary};
+
+    if(!file)
+        return false;
+
+    auto line   = std::string{};
+    auto n_line = 0;
+
+    while(std::getline(file, line))
+    {
+        ++n_line;
+
+        const auto key_size = line.find('=');
+        const auto op       = line.empty() ? '\0' : line[0];
+
+        if(line.size() < 3 || line[1] != ' ' || key_size == std::string::npos || key_size < 3 ||
+           (op != 'S' && op != 'U' && op != 'R'))
+        {
+            // The last line may have been cut short by a crash.
+            MIOPEN_LOG_W("Ill-formed journal entry: " << journal_path << "#" << n_line);
+            continue;
+        }
+
+        auto record = DbRecord{line.substr(2, key_size - 2)};
+        if(op != 'R' && !record.ParseContents(line.substr(key_size + 1)))
+        {
+            MIOPEN_LOG_W("Error parsing journal entry: " << journal_path << "#" << n_line);
+            continue;
+        }
+
+        AddChange(entries, op, record);
+    }
+
+    return true;
+}
+
+void DbJournal::AppendUnsafe(char op, const DbRecord& record)
+{
+    if(!file.is_open())
+    {
+        file.open(path, std::ios::app | std::ios::binary);
+
+        if(!file)
+        {
+            // Pending changes are still folded from memory, they only would not survive a crash.
+            MIOPEN_LOG_W("Journal is unwritable: " << path);
+            file = std::ofstream{};
+            return;
+        }
+    }
+
+    file << op << ' ' << record.GetKey() << '=';
+    if(record.GetSize() == 0)
+        file << std::endl;
+    else
+        record.WriteIdsAndValues(file);
+}
+
+void DbJournal::FlushIfNeededUnsafe()
+{
+    if(pending.size() >= env::value(MIOPEN_DB_JOURNAL_THRESHOLD))
+        FlushUnsafe();
+}
+
+bool DbJournal::FlushUnsafe()
+{
+    if(pending.empty())
+        return true;
+
+    MIOPEN_LOG_I2("Folding " << pending.size() << " journaled records into " << db_path);
+
+    auto db = PlainTextDb{db_kind, db_path, false, PlainTextDb::NoJournal{}};
+    {
+        const auto lock = std::unique_lock<LockFile>(db.GetLockFile(), GetLockTimeout());
+
+        if(!lock)
+        {
+            // Pending changes are kept and folded on a later attempt.
+            MIOPEN_LOG_W("Unable to lock " << db_path << " to fold the journal");
+            return false;
+        }
+
+        if(!db.FoldJournalUnsafe(pending))
+            return false;
+
+        // RamDb instances of other processes notice the change through the time file.
+        RamDb::UpdateModificationTime(db_path);
+    }
+
+    pending.clear();
+    file.close();
+    file = std::ofstream{};
+
+    auto ec = std::error_code{};
+    fs::remove(path, ec);
+    return true;
+}
+
+void DbJournal::RecoverOrphans()
+{
+    const auto directory = db_path.parent_path();
+    const auto prefix    = GetJournalPrefix(db_path);
+    auto ec              = std::error_code{};
+    auto orphans         = std::vector<fs::path>{};
+
+    if(!fs::exists(directory, ec))
+        return;
+
+    for(const auto& item : fs::directory_iterator{directory, ec})
+    {
+        const auto name = item.path().filename().string();
+        if(name.compare(0, prefix.size(), prefix) != 0)
+            continue;
+
+        const auto pid_str = name.substr(prefix.size());
+        if(pid_str.empty() || pid_str.find_first_not_of("0123456789") != std::string::npos)
+            continue;
+
+        const auto pid = std::stol(pid_str);
+        if(pid != GetProcessId() && !IsProcessAlive(pid))
+            orphans.push_back(item.path());
+    }
+
+    if(orphans.empty())
+        return;
+
+    auto db         = PlainTextDb{db_kind, db_path, false, PlainTextDb::NoJournal{}};
+    auto entries    = DbJournalEntries{};
+    const auto lock = std::unique_lock<LockFile>(db.GetLockFile(), GetLockTimeout());
+
+    if(!lock)
+    {
+        MIOPEN_LOG_W("Unable to lock " << db_path << " to fold journals of finished processes");
+        return;
+    }
+
+    for(const auto& orphan : orphans)
+    {
+        // Another process may have folded it meanwhile.
+        if(Read(orphan, entries))
+            MIOPEN_LOG_I("Folding journal of a finished process: " << orphan);
+    }
+
+    if(!entries.empty())
+    {
+        if(!db.FoldJournalUnsafe(entries))
+            return;
+        RamDb::UpdateModificationTime(db_path);
+    }
+
+    for(const auto& orphan : orphans)
+        fs::remove(orphan, ec);
+}
+
+} // namespace miopen
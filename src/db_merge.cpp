@@ -0,0 +1,599 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/db_merge.hpp>
+#include <miopen/db_text_parser.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/kernel.hpp>
+#include <miopen/load_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/par_for.hpp>
+#include <miopen/perf_field.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/stringutils.hpp>
+
+#if MIOPEN_ENABLE_SQLITE
+#include <miopen/kern_db.hpp>
+#include <miopen/sqlite_db.hpp>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+namespace miopen {
+
+namespace {
+
+struct Entry
+{
+    std::string values;
+    std::size_t input;
+};
+
+/// key -> id -> entry, ordered to write the output sorted.
+using Records = std::map<std::string, std::map<std::string, Entry>>;
+
+struct Kernel
+{
+    std::vector<char> blob; // As stored, i.e. compressed unless uncompressed_size is 0
+    std::string hash;
+    std::int64_t uncompressed_size = 0;
+};
+
+/// (kernel_name, kernel_args) -> kernel
+using Kernels = std::map<std::pair<std::string, std::string>, Kernel>;
+
+struct Input
+{
+    bool readable = false;
+    Records records;
+    Kernels kernels;
+    /// Columns of the problem config table of a SQLite perf-db, sorted. The keys of the records
+    /// are the values of these columns separated by tabs.
+    std::vector<std::string> config_columns;
+    /// Statements creating the tables and indices of a SQLite perf-db.
+    std::vector<std::string> schema;
+    DbMergeStats stats;
+};
+
+struct TextLine
+{
+    int line;
+    std::string content;
+};
+
+constexpr char ConfigValueSeparator = '\t';
+
+bool IsSQLite(const fs::path& path)
+{
+    const auto ext = path.extension();
+    return ext == ".db" || ext == ".udb" || ext == ".kdb" || ext == ".ukdb";
+}
+
+bool IsSolverIdAccepted(const DbMergeOptions& options, const std::string& id, Input& input)
+{
+    if(!options.validate_solvers || solver::Id{id}.IsValid())
+        return true;
+    ++input.stats.unknown_solvers;
+    return false;
+}
+
+void AddEntry(Input& input, const std::string& key, const std::string& id, std::string values)
+{
+    ++input.stats.read;
+    auto& entry = input.records[key][id];
+    // Ids are unique within a record, the last one is kept as when the db is updated.
+    entry.values = std::move(values);
+}
+
+void ReadTextDb(const DbMergeOptions& options, const fs::path& path, Input& input)
+{
+    if(!std::ifstream{path})
+    {
+        MIOPEN_LOG_E("File is unreadable: " << path);
+        return;
+    }
+
+    const auto file = MappedFile{path};
+    auto lines      = std::unordered_map<std::string, TextLine>{};
+    // Inputs are read in parallel already unless there is only one.
+    ParseTextDb(file.view(), path, lines, options.inputs.size() > 1 ? 1 : 0);
+
+    for(auto& [key, line] : lines)
+    {
+        for(const auto& pair : SplitDelim(line.content, ';'))
+        {
+            const auto colon = pair.find(':');
+            if(colon == std::string::npos || colon == 0)
+            {
+                MIOPEN_LOG_E("Ill-formed record: " << path << "#" << line.line);
+                ++input.stats.ill_formed;
+                continue;
+            }
+
+            const auto id = pair.substr(0, colon);
+            if(IsSolverIdAccepted(options, id, input))
+                AddEntry(input, key, id, pair.substr(colon + 1));
+        }
+    }
+
+    input.readable = true;
+}
+
+#if MIOPEN_ENABLE_SQLITE
+void ReadSQLitePerfDb(const DbMergeOptions& options, const fs::path& path, Input& input)
+{
+    const auto sql = SQLite{path, true};
+    if(!sql.Valid())
+    {
+        MIOPEN_LOG_E("Unable to open: " << path);
+        return;
+    }
+
+    for(const auto& column : sql.Exec("PRAGMA table_info(config);"))
+    {
+        if(column.at("name") != "id")
+            input.config_columns.push_back(column.at("name"));
+    }
+    std::sort(input.config_columns.begin(), input.config_columns.end());
+
+    if(input.config_columns.empty())
+    {
+        MIOPEN_LOG_E("No problem config table in " << path);
+        return;
+    }
+
+    for(const auto& statement : sql.Exec("SELECT sql FROM sqlite_master WHERE sql IS NOT NULL "
+                                         "AND name NOT LIKE 'sqlite_%' ORDER BY rowid;"))
+        input.schema.push_back(statement.at("sql"));
+
+    const auto rows = sql.Exec("SELECT config.*, perf_db.solver, perf_db.params FROM perf_db "
+                               "INNER JOIN config ON perf_db.config = config.id;");
+
+    for(const auto& row : rows)
+    {
+        auto values = std::vector<std::string>{};
+        values.reserve(input.config_columns.size());
+        for(const auto& column : input.config_columns)
+            values.push_back(row.at(column));
+
+        const auto& id = row.at("solver");
+        if(IsSolverIdAccepted(options, id, input))
+            AddEntry(input, JoinStrings(values, {ConfigValueSeparator}), id, row.at("params"));
+    }
+
+    input.readable = true;
+}
+
+bool IsKnownProgram(const fs::path& object_name)
+{
+    auto program = object_name;
+    if(program.extension() == object_file_postfix)
+        program.replace_extension();
+
+    // MLIR kernels are generated by the solvers, not built from a source of MIOpen.
+    if(program.extension() == ".mlir")
+        return true;
+
+    try
+    {
+        std::ignore = GetKernelSrc(program);
+        return true;
+    }
+    catch(const Exception&)
+    {
+        return false;
+    }
+}
+
+void ReadKernelDb(const DbMergeOptions& options, const fs::path& path, Input& input)
+{
+    const auto sql = SQLite{path, true};
+    if(!sql.Valid())
+    {
+        MIOPEN_LOG_E("Unable to open: " << path);
+        return;
+    }
+
+    auto stmt = SQLite::Statement{sql,
+                                  "SELECT kernel_name, kernel_args, kernel_blob, kernel_hash, "
+                                  "uncompressed_size FROM kern_db;"};
+
+    auto known_programs = std::unordered_map<std::string, bool>{};
+
+    for(auto rc = stmt.Step(sql); rc != SQLITE_DONE; rc = stmt.Step(sql))
+    {
+        if(rc != SQLITE_ROW)
+            MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+
+        ++input.stats.read;
+        auto name = stmt.ColumnText(0);
+
+        if(options.drop_orphaned_kernels)
+        {
+            auto known = known_programs.find(name);
+            if(known == known_programs.end())
+                known = known_programs.emplace(name, IsKnownProgram(name)).first;
+            if(!known->second)
+            {
+                ++input.stats.orphaned_kernels;
+                continue;
+            }
+        }
+
+        auto& kernel             = input.kernels[{std::move(name), stmt.ColumnText(1)}];
+        kernel.blob              = stmt.ColumnBlob(2);
+        kernel.hash              = stmt.ColumnText(3);
+        kernel.uncompressed_size = stmt.ColumnInt64(4);
+    }
+
+    input.readable = true;
+}
+#endif
+
+Input ReadInput(const DbMergeOptions& options, const fs::path& path)
+{
+    auto input = Input{};
+
+    try
+    {
+        if(!IsSQLite(path))
+            ReadTextDb(options, path, input);
+#if MIOPEN_ENABLE_SQLITE
+        else if(options.kind == DbKinds::KernelDb)
+            ReadKernelDb(options, path, input);
+        else
+            ReadSQLitePerfDb(options, path, input);
+#endif
+    }
+    catch(const std::exception& ex)
+    {
+        MIOPEN_LOG_E("Unable to read " << path << ": " << ex.what());
+        input.readable = false;
+    }
+
+    if(!input.readable)
+    {
+        input.records.clear();
+        input.kernels.clear();
+    }
+
+    return input;
+}
+
+float GetFindDbTime(const std::string& values)
+{
+    auto data = FindDbData{};
+    if(!data.Deserialize(values) || data.time < 0)
+        return std::numeric_limits<float>::max();
+    return data.time;
+}
+
+class Merger
+{
+public:
+    Merger(const DbMergeOptions& options_) : options(options_) {}
+
+    void Add(Input& input, std::size_t index)
+    {
+        ++stats.inputs;
+        stats.ill_formed += input.stats.ill_formed;
+        stats.read += input.stats.read;
+        stats.unknown_solvers += input.stats.unknown_solvers;
+        stats.orphaned_kernels += input.stats.orphaned_kernels;
+
+        if(!input.readable || !IsConfigMatching(input, index))
+        {
+            ++stats.unreadable_inputs;
+            return;
+        }
+
+        for(auto& [key, ids] : input.records)
+        {
+            auto& merged_ids = records[key];
+            for(auto& [id, entry] : ids)
+            {
+                entry.input         = index;
+                const auto inserted = merged_ids.emplace(id, entry);
+                if(!inserted.second)
+                    Resolve(inserted.first->second, std::move(entry));
+            }
+        }
+
+        for(auto& [key, kernel] : input.kernels)
+        {
+            const auto inserted = kernels.emplace(key, kernel);
+            if(inserted.second)
+                continue;
+
+            auto& merged = inserted.first->second;
+            if(merged.hash == kernel.hash)
+            {
+                ++stats.duplicates;
+                continue;
+            }
+            ++stats.conflicts;
+            merged = std::move(kernel);
+        }
+    }
+
+    void Write(const fs::path& path)
+    {
+        if(options.kind == DbKinds::KernelDb)
+            WriteKernelDb(path);
+        else if(IsSQLite(options.output))
+            WriteSQLitePerfDb(path);
+        else
+            WriteTextDb(path);
+    }
+
+    DbMergeStats stats;
+
+private:
+    const DbMergeOptions& options;
+    Records records;
+    Kernels kernels;
+    std::vector<std::string> config_columns;
+    std::vector<std::string> schema;
+    fs::path config_source;
+
+    bool IsConfigMatching(Input& input, std::size_t index)
+    {
+        if(input.config_columns.empty())
+            return true;
+
+        if(config_columns.empty())
+        {
+            config_columns = std::move(input.config_columns);
+            schema         = std::move(input.schema);
+            config_source  = options.inputs[index];
+            return true;
+        }
+
+        if(input.config_columns == config_columns)
+            return true;
+
+        MIOPEN_LOG_E("Problem config columns of " << options.inputs[index] << " differ from "
+                                                  << config_source << ", skipping it");
+        return false;
+    }
+
+    void Resolve(Entry& merged, Entry&& entry)
+    {
+        if(merged.values == entry.values)
+        {
+            ++stats.duplicates;
+            return;
+        }
+
+        ++stats.conflicts;
+
+        // Only find-db entries have a time, the latest input wins otherwise.
+        if(options.kind == DbKinds::FindDb &&
+           GetFindDbTime(merged.values) <= GetFindDbTime(entry.values))
+            return;
+
+        merged = std::move(entry);
+    }
+
+    void WriteTextDb(const fs::path& path)
+    {
+        auto file = std::ofstream{path};
+        if(!file)
+            MIOPEN_THROW("Unable to create " + path);
+
+        for(const auto& [key, ids] : records)
+        {
+            file << key << '=';
+            auto first = true;
+            for(const auto& [id, entry] : ids)
+            {
+                file << (first ? "" : ";") << id << ':' << entry.values;
+                first = false;
+                ++stats.written;
+            }
+            file << '\n';
+            ++stats.records;
+        }
+
+        if(!file.flush())
+            MIOPEN_THROW("Unable to write " + path);
+    }
+
+#if MIOPEN_ENABLE_SQLITE
+    static void Step(const SQLite& sql, SQLite::Statement& stmt)
+    {
+        if(stmt.Step(sql) != SQLITE_DONE)
+            MIOPEN_THROW(miopenStatusInternalError, sql.ErrorMessage());
+    }
+
+    void WriteSQLitePerfDb(const fs::path& path)
+    {
+        if(schema.empty())
+            MIOPEN_THROW("No readable SQLite perf-db to take the schema from");
+
+        const auto sql = SQLite{path, false};
+        if(!sql.Valid())
+            MIOPEN_THROW("Unable to create " + path);
+
+        sql.Exec("BEGIN;");
+        for(const auto& statement : schema)
+            sql.Exec(statement + ";");
+
+        const auto config_query =
+            "INSERT INTO config(id, " + JoinStrings(config_columns, ", ") + ") VALUES(" +
+            JoinStrings(std::vector<std::string>(config_columns.size() + 1, "?"), ", ") + ");";
+
+        auto config_id = std::int64_t{0};
+        for(const auto& [key, ids] : records)
+        {
+            auto values = SplitDelim(key, ConfigValueSeparator);
+            values.resize(config_columns.size()); // getline() drops the empty last value
+            values.insert(values.begin(), std::to_string(++config_id));
+            auto config = SQLite::Statement{sql, config_query, values};
+            Step(sql, config);
+            ++stats.records;
+
+            for(const auto& [id, entry] : ids)
+            {
+                auto perf = SQLite::Statement{
+                    sql,
+                    "INSERT INTO perf_db(config, solver, params) VALUES(?, ?, ?);",
+                    {std::to_string(config_id), id, entry.values}};
+                Step(sql, perf);
+                ++stats.written;
+            }
+        }
+        sql.Exec("COMMIT;");
+    }
+
+    void WriteKernelDb(const fs::path& path)
+    {
+        const auto sql = SQLite{path, false};
+        if(!sql.Valid())
+            MIOPEN_THROW("Unable to create " + path);
+
+        sql.Exec("BEGIN;");
+        sql.Exec(KernelConfig::CreateQuery());
+
+        for(const auto& [key, kernel] : kernels)
+        {
+            auto stmt = SQLite::Statement{sql,
+                                          "INSERT INTO kern_db(kernel_name, kernel_args, "
+                                          "kernel_blob, kernel_hash, uncompressed_size) "
+                                          "VALUES(?, ?, ?, ?, ?);"};
+            stmt.BindText(1, key.first);
+            stmt.BindText(2, key.second);
+            stmt.BindBlob(3, kernel.blob);
+            stmt.BindText(4, kernel.hash);
+            stmt.BindInt64(5, kernel.uncompressed_size);
+            Step(sql, stmt);
+            ++stats.records;
+            ++stats.written;
+        }
+        sql.Exec("COMMIT;");
+    }
+#else
+    [[noreturn]] static void ThrowNoSQLite()
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented, "MIOpen is built without SQLite");
+    }
+    void WriteSQLitePerfDb(const fs::path&) { ThrowNoSQLite(); }
+    void WriteKernelDb(const fs::path&) { ThrowNoSQLite(); }
+#endif
+};
+
+void CheckFormats(const DbMergeOptions& options)
+{
+    if(options.inputs.empty() || options.output.empty())
+        MIOPEN_THROW(miopenStatusBadParm, "No inputs or output to merge");
+
+    const auto is_sqlite = IsSQLite(options.output);
+    if(options.kind == DbKinds::FindDb && is_sqlite)
+        MIOPEN_THROW(miopenStatusBadParm, "Find-db is a text database");
+    if(options.kind == DbKinds::KernelDb && !is_sqlite)
+        MIOPEN_THROW(miopenStatusBadParm, "Kernel db is a SQLite database");
+#if !MIOPEN_ENABLE_SQLITE
+    if(is_sqlite)
+        MIOPEN_THROW(miopenStatusNotImplemented, "MIOpen is built without SQLite");
+#endif
+
+    for(const auto& input : options.inputs)
+    {
+        if(IsSQLite(input) != is_sqlite)
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "Format of " + input + " differs from the one of " + options.output);
+    }
+}
+
+} // namespace
+
+DbMergeStats MergeDbs(const DbMergeOptions& options)
+{
+    CheckFormats(options);
+
+    const auto jobs =
+        options.jobs != 0 ? options.jobs : std::max(std::thread::hardware_concurrency(), 1U);
+    auto merger = Merger{options};
+
+    // Inputs are read in batches of jobs and merged in the order given, which keeps the result
+    // deterministic and the memory bound to a batch of inputs.
+    for(auto first = std::size_t{0}; first < options.inputs.size(); first += jobs)
+    {
+        const auto n = std::min<std::size_t>(jobs, options.inputs.size() - first);
+        auto batch   = std::vector<Input>(n);
+
+        par_for_impl(n, n, [&](std::size_t i) {
+            batch[i] = ReadInput(options, options.inputs[first + i]);
+        });
+
+        for(auto i = std::size_t{0}; i < n; ++i)
+            merger.Add(batch[i], first + i);
+    }
+
+    // Written next to the output and renamed, so the output is either the old or the new db.
+    const auto tmp_path = options.output.parent_path() / (options.output.filename() + ".tmp");
+    fs::remove(tmp_path);
+
+    try
+    {
+        merger.Write(tmp_path);
+    }
+    catch(...)
+    {
+        fs::remove(tmp_path);
+        throw;
+    }
+
+    fs::rename(tmp_path, options.output);
+    return merger.stats;
+}
+
+std::ostream& operator<<(std::ostream& os, const DbMergeStats& stats)
+{
+    os << "Inputs: " << stats.inputs << std::endl;
+    os << "Unreadable inputs: " << stats.unreadable_inputs << std::endl;
+    os << "Ill-formed entries: " << stats.ill_formed << std::endl;
+    os << "Entries read: " << stats.read << std::endl;
+    os << "Duplicates: " << stats.duplicates << std::endl;
+    os << "Conflicts: " << stats.conflicts << std::endl;
+    os << "Unknown solvers: " << stats.unknown_solvers << std::endl;
+    os << "Orphaned kernels: " << stats.orphaned_kernels << std::endl;
+    os << "Records written: " << stats.records << std::endl;
+    os << "Entries written: " << stats.written << std::endl;
+    return os;
+}
+
+} // namespace miopen
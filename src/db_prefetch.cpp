@@ -0,0 +1,117 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/db_prefetch.hpp>
+
+#include <miopen/binary_cache.hpp>
+#include <miopen/db_record.hpp>
+#include <miopen/env.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/find_db.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/readonlyramdb.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <map>
+#include <mutex>
+#include <vector>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DB_PREFETCH)
+
+namespace miopen {
+
+namespace {
+
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+/// The kernel database is an SQLite file queried by each connection on demand, there is no
+/// in-memory image to build ahead of time. Reading it through once pulls its pages into the
+/// OS page cache, which is what the first blocking lookups would otherwise wait for.
+void WarmUpKernelDb(const fs::path& path)
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static std::mutex mutex;
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static auto pending = std::map<fs::path, std::future<void>>{};
+
+    const std::lock_guard<std::mutex> lock{mutex};
+    if(pending.find(path) != pending.end())
+        return;
+
+    pending.emplace(path, std::async(std::launch::async, [path]() {
+                        const auto start = std::chrono::steady_clock::now();
+                        auto file        = std::ifstream{path, std::ios::binary};
+                        auto buffer      = std::vector<char>(1 << 20);
+                        while(file.read(buffer.data(), buffer.size()) || file.gcount() > 0) {}
+                        const auto time = std::chrono::duration<double, std::milli>{
+                            std::chrono::steady_clock::now() - start};
+                        MIOPEN_LOG_I("Background read of " << path << " took " << time.count()
+                                                           << " ms");
+                    }));
+}
+#endif
+
+} // namespace
+
+void PrefetchSystemDbs(Handle& handle)
+{
+    if(MIOPEN_DISABLE_SYSDB || !env::enabled(MIOPEN_DB_PREFETCH))
+        return;
+
+    MIOPEN_LOG_I2("Starting background load of the installed databases");
+
+#if MIOPEN_DEBUG_FIND_DB_CACHING
+    if(debug::testing_find_db_enabled && !env::enabled(MIOPEN_DEBUG_DISABLE_FIND_DB))
+    {
+        // Only the convolution find-db is prefetched: the installed path is resolved once per
+        // process, so resolving the fusion one here would change which file convolutions use.
+        const auto find_db_path = debug::testing_find_db_path_override()
+                                      ? *debug::testing_find_db_path_override()
+                                      : FindDbRecord::GetInstalledPath(handle, "");
+        if(!find_db_path.empty())
+            ReadonlyRamDb::PrefetchAsync(DbKinds::FindDb, find_db_path, true);
+    }
+#endif
+
+#if !(MIOPEN_ENABLE_SQLITE && MIOPEN_USE_SQLITE_PERFDB)
+    const auto perf_db_path = ExecutionContext{&handle}.GetPerfDbPath();
+    if(!perf_db_path.empty())
+        ReadonlyRamDb::PrefetchAsync(DbKinds::PerfDb, perf_db_path, true);
+#endif
+
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+    if(!IsCacheDisabled())
+    {
+        const auto kern_db_path =
+            GetSystemKernelDbPath(handle.GetTargetProperties(), handle.GetMaxComputeUnits());
+        if(!kern_db_path.empty() && fs::exists(kern_db_path))
+            WarmUpKernelDb(kern_db_path);
+    }
+#endif
+}
+
+} // namespace miopen
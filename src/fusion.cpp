@@ -144,7 +144,7 @@ AllocateBuffersAndMakeFusionInvokeParams(Handle& handle,
                                          const FusionPlanDescriptor& plan)
 {
     const auto allocate_buffer = [&](std::size_t size) {
-        auto ptr = handle.Create(size);
+        auto ptr = handle.CreateCached(size);
         auto ret = ptr.get();
         invoke_bufs.push_back(std::move(ptr));
         return ret;
@@ -26,6 +26,7 @@
 
 #include <miopen/generic_search.hpp>
 #include <miopen/generic_search_controls.hpp>
+#include <miopen/errors.hpp>
 
 #include <cstddef>
 #include <chrono>
@@ -63,5 +64,27 @@ std::chrono::milliseconds GetTuningTimeMax()
 
 std::size_t GetTuningThreadsMax() { return env::value(MIOPEN_COMPILE_PARALLEL_LEVEL); }
 
+TuningRole GetTuningRole()
+{
+    const auto& role = env::value(MIOPEN_TUNING_QUEUE_ROLE);
+    if(role.empty() || role == "worker")
+        return TuningRole::Worker;
+    if(role == "coordinator")
+        return TuningRole::Coordinator;
+    if(role == "merge")
+        return TuningRole::Merge;
+    MIOPEN_THROW(miopenStatusBadParm, "Unknown MIOPEN_TUNING_QUEUE_ROLE: " + role);
+}
+
+std::optional<TuningQueue> GetTuningQueue()
+{
+    const auto& path = env::value(MIOPEN_TUNING_QUEUE);
+    if(path.empty())
+        return std::nullopt;
+    return TuningQueue{path, std::chrono::seconds{env::value(MIOPEN_TUNING_UNIT_TIMEOUT)}};
+}
+
+std::size_t GetTuningUnitSize() { return env::value(MIOPEN_TUNING_UNIT_SIZE); }
+
 } // namespace solver
 } // namespace miopen
@@ -0,0 +1,131 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/graphapi/engine_cache.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+
+#include <algorithm>
+
+namespace miopen {
+namespace graphapi {
+
+EngineCache& EngineCache::instance()
+{
+    static EngineCache cache;
+    return cache;
+}
+
+std::string EngineCache::makeKey(const OpGraph& graph)
+{
+    // Solutions found for one device are not valid for another one, the handle
+    // itself does not matter.
+    std::string key;
+    if(graph.getHandle() != nullptr)
+    {
+        key = deref(graph.getHandle()).GetDbBasename();
+    }
+    key += '|';
+    key += graph.getSignature();
+    return key;
+}
+
+std::optional<std::vector<Engine>> EngineCache::find(const std::string& key, OpGraph* graph)
+{
+    assert(graph);
+
+    std::vector<Record> records;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        const auto it = mRecords.find(key);
+        if(it == mRecords.end())
+        {
+            mMisses.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+        records = it->second;
+    }
+    mHits.fetch_add(1, std::memory_order_relaxed);
+
+    std::vector<Engine> engines;
+    engines.reserve(records.size());
+
+    for(const auto& record : records)
+    {
+        EngineBuilder builder;
+        builder.setGraph(graph).setExecutor(record.mExecutor).setGlobalIndex(record.mGlobalIndex);
+        if(record.mSmCount > 0)
+        {
+            builder.setSmCount(record.mSmCount);
+        }
+        engines.emplace_back(builder.build());
+    }
+
+    return engines;
+}
+
+bool EngineCache::store(const std::string& key, const std::vector<Engine>& engines)
+{
+    const auto reusable = std::all_of(engines.cbegin(), engines.cend(), [](const Engine& e) {
+        return e.getExecutor() && e.getExecutor()->isReusable();
+    });
+
+    if(!reusable)
+    {
+        MIOPEN_LOG_I2("Graph engines are not reusable, not caching them");
+        return false;
+    }
+
+    std::vector<Record> records;
+    records.reserve(engines.size());
+    for(const auto& e : engines)
+    {
+        records.push_back({e.getExecutor(), e.getGlobalIndex(), e.getSmCount()});
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    mRecords.insert_or_assign(key, std::move(records));
+    return true;
+}
+
+void EngineCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mRecords.clear();
+    mHits   = 0;
+    mMisses = 0;
+}
+
+std::size_t EngineCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mRecords.size();
+}
+
+} // end namespace graphapi
+} // end namespace miopen
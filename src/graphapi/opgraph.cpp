@@ -24,18 +24,24 @@
  *
  *******************************************************************************/
 
+#include <miopen/env.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/graphapi/opgraph.hpp>
 #include <miopen/graphapi/engine.hpp>
+#include <miopen/graphapi/engine_cache.hpp>
 
 #include <deque>
 #include <unordered_map>
 
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_GRAPHAPI_ENGINE_CACHE)
+
 namespace miopen {
 namespace graphapi {
 
 OpNode::~OpNode() = default;
 
+void OpNode::serializeAttributes(std::ostream&) const {}
+
 OpGraph OpGraphBuilder::build() &&
 {
     if(mNodes.empty())
@@ -114,7 +120,86 @@ void OpGraph::initEngines()
     // engines. This pointer  may become invalid when the graph object is moved. Fix
     // by using shared_ptr or not storing graph inside engine
     // --amberhassaan May, 2024
+    if(env::disabled(MIOPEN_DEBUG_GRAPHAPI_ENGINE_CACHE))
+    {
+        mEngines = findEngines(this);
+        return;
+    }
+
+    auto& cache    = EngineCache::instance();
+    const auto key = EngineCache::makeKey(*this);
+    auto cached    = cache.find(key, this);
+    if(cached)
+    {
+        MIOPEN_LOG_I2("Graph engines found in the cache");
+        mEngines = std::move(*cached);
+        return;
+    }
+
     mEngines = findEngines(this);
+    if(!mEngines.empty())
+    {
+        cache.store(key, mEngines);
+    }
+}
+
+namespace {
+
+void serializeTensor(std::ostream& stream, const Tensor* tensor)
+{
+    if(tensor == nullptr)
+    {
+        stream << "null";
+        return;
+    }
+
+    stream << tensor->getId() << ':' << tensor->GetType() << (tensor->isVirtual() ? "v" : "")
+           << '[';
+    LogRange(stream, tensor->GetLengths(), ",") << "][";
+    LogRange(stream, tensor->GetStrides(), ",") << ']';
+}
+
+} // namespace
+
+std::string OpGraph::getSignature() const
+{
+    // Edges are fully defined by the tensor ids, so the sorted list of node
+    // descriptions is a canonical form of the graph.
+    std::vector<std::string> nodes;
+    nodes.reserve(mNodes.size());
+
+    for(const OpNode* n : mNodes)
+    {
+        std::ostringstream ss;
+        // exact representation of the floating point attributes
+        ss << std::hexfloat;
+        ss << n->signName() << '{';
+        n->serializeAttributes(ss);
+        ss << "}(";
+        for(const Tensor* t : n->getInTensors())
+        {
+            serializeTensor(ss, t);
+            ss << ';';
+        }
+        ss << ")->(";
+        for(const Tensor* t : n->getOutTensors())
+        {
+            serializeTensor(ss, t);
+            ss << ';';
+        }
+        ss << ')';
+        nodes.emplace_back(ss.str());
+    }
+
+    std::sort(nodes.begin(), nodes.end());
+
+    std::string signature;
+    for(const auto& n : nodes)
+    {
+        signature += n;
+        signature += '\n';
+    }
+    return signature;
 }
 
 VecOfPaths OpGraph::getAllPaths() const
@@ -628,6 +628,21 @@ std::vector<Tensor*> OperationPointwise::getOutTensors() const
     }
 }
 
+void OperationPointwise::serializeAttributes(std::ostream& stream) const
+{
+    auto toFloat  = [](auto&& arg) { return static_cast<float>(arg); };
+    auto toDouble = [](auto&& arg) { return static_cast<double>(arg); };
+
+    stream << mPointwise->getMathPrecision() << ',' << mPointwise->getNanPropagation() << ','
+           << std::visit(toDouble, mPointwise->getReluLowerClip()) << ','
+           << std::visit(toDouble, mPointwise->getReluUpperClip()) << ','
+           << std::visit(toDouble, mPointwise->getReluLowerClipSlope()) << ','
+           << std::visit(toDouble, mPointwise->getEluAlpha()) << ','
+           << std::visit(toDouble, mPointwise->getSoftPlusBeta()) << ','
+           << std::visit(toDouble, mPointwise->getSwishBeta()) << ',' << mPointwise->getAxis()
+           << ',' << std::visit(toFloat, mAlpha1) << ',' << std::visit(toFloat, mAlpha2);
+}
+
 OperationPointwiseBuilder& OperationPointwiseBuilder::setPointwise(Pointwise* pointwise)
 {
     mOperationPointwise.mPointwise = checkPtr(pointwise);
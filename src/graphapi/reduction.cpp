@@ -180,6 +180,11 @@ std::vector<Tensor*> OperationReduction::getInTensors() const { return {mX}; }
 
 std::vector<Tensor*> OperationReduction::getOutTensors() const { return {mY}; }
 
+void OperationReduction::serializeAttributes(std::ostream& stream) const
+{
+    stream << mReduction->getCompType();
+}
+
 OperationReductionBuilder& OperationReductionBuilder::setReduction(Reduction* reduction)
 {
     mOperationReduction.mReduction = checkPtr(reduction);
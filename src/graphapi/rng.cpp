@@ -214,6 +214,18 @@ std::vector<Tensor*> OperationRng::getInTensors() const
 
 std::vector<Tensor*> OperationRng::getOutTensors() const { return {mOutput}; }
 
+void OperationRng::serializeAttributes(std::ostream& stream) const
+{
+    stream << mRng->getDistribution() << ',' << mRng->getNormalMean() << ','
+           << mRng->getNormalStdev() << ',' << mRng->getUniformMin() << ','
+           << mRng->getUniformMax() << ',' << mRng->getBernoulliProb();
+    // a seed tensor is one of the in tensors
+    if(mSeed.index() == 0)
+    {
+        stream << ',' << std::get<int64_t>(mSeed);
+    }
+}
+
 OperationRngBuilder& OperationRngBuilder::setRng(Rng* rng)
 {
     mOperationRng.mRng = checkPtr(rng);
@@ -120,3 +120,33 @@ extern "C" miopenStatus_t miopenEnableProfiling(miopenHandle_t handle, bool enab
 {
     return miopen::try_([&] { miopen::deref(handle).EnableProfiling(enable); });
 }
+
+static miopen::LookupCounters& LookupCountersOf(miopenHandle_t handle)
+{
+    if(handle == nullptr)
+        return miopen::LookupCounters::Process();
+    return miopen::deref(handle).GetLookupCounters();
+}
+
+extern "C" miopenStatus_t miopenGetLookupCounters(miopenHandle_t handle,
+                                                  miopenLookupSource_t source,
+                                                  miopenLookupCounters_t* counters)
+{
+    return miopen::try_([&] {
+        if(source < miopenLookupFindDb || source > miopenLookupCompileFallback)
+            MIOPEN_THROW(miopenStatusBadParm, "Unknown lookup source");
+
+        const auto lookup_source = static_cast<miopen::LookupSource>(source);
+        const auto values        = LookupCountersOf(handle).Get(lookup_source);
+        auto& result             = miopen::deref(counters);
+        result.hits              = values.hits;
+        result.misses            = values.misses;
+        result.stores            = values.stores;
+        result.latency_ns        = values.latency_ns;
+    });
+}
+
+extern "C" miopenStatus_t miopenResetLookupCounters(miopenHandle_t handle)
+{
+    return miopen::try_([&] { LookupCountersOf(handle).Reset(); });
+}
@@ -28,11 +28,14 @@
 #include <miopen/handle.hpp>
 
 #include <miopen/binary_cache.hpp>
+#include <miopen/buffer_pool.hpp>
+#include <miopen/db_prefetch.hpp>
 #include <miopen/env.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/handle_lock.hpp>
 #include <miopen/invoker.hpp>
 #include <miopen/kernel_cache.hpp>
+#include <miopen/launch_recording.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/stringutils.hpp>
 #include <miopen/target_properties.hpp>
@@ -288,6 +291,9 @@ struct HandleImpl
     Allocator allocator{};
     KernelCache cache;
     TargetProperties target_properties;
+    std::shared_ptr<LaunchRecording> recording;
+    BufferPool buffer_pool;
+    LookupCounters lookup_counters;
 };
 
 Handle::Handle(miopenAcceleratorQueue_t stream) : impl(std::make_unique<HandleImpl>())
@@ -314,6 +320,7 @@ Handle::Handle(miopenAcceleratorQueue_t stream) : impl(std::make_unique<HandleIm
 #endif
     this->impl->target_properties.Init(this);
     MIOPEN_LOG_NQI(*this);
+    PrefetchSystemDbs(*this);
 }
 
 Handle::Handle() : impl(std::make_unique<HandleImpl>())
@@ -341,9 +348,10 @@ Handle::Handle() : impl(std::make_unique<HandleImpl>())
 #endif
     this->impl->target_properties.Init(this);
     MIOPEN_LOG_NQI(*this);
+    PrefetchSystemDbs(*this);
 }
 
-Handle::~Handle() {}
+Handle::~Handle() { DumpLookupCounters(*this); }
 
 // not MT safe
 void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
@@ -411,6 +419,9 @@ void Handle::SetAllocator(miopenAllocatorFunction allocator,
     this->impl->allocator.deallocator = deallocator == nullptr ? default_deallocator : deallocator;
 
     this->impl->allocator.context = allocatorContext;
+
+    // Cached buffers belong to the previous allocator.
+    this->impl->buffer_pool.Trim();
 }
 
 void Handle::EnableProfiling(bool enable) const { this->impl->enable_profiling = enable; }
@@ -424,6 +435,15 @@ Allocator::ManageDataPtr Handle::Create(std::size_t sz) const
     return this->impl->allocator(sz);
 }
 
+Allocator::ManageDataPtr Handle::CreateCached(std::size_t sz) const
+{
+    return this->impl->buffer_pool.Get(this->impl->allocator, sz);
+}
+
+BufferPool& Handle::GetBufferPool() const { return this->impl->buffer_pool; }
+
+LookupCounters& Handle::GetLookupCounters() const { return this->impl->lookup_counters; }
+
 Allocator::ManageDataPtr&
 Handle::WriteTo(const void* data, Allocator::ManageDataPtr& ddata, std::size_t sz) const
 {
@@ -530,9 +550,31 @@ KernelInvoke Handle::Run(Kernel k, bool coop_launch) const
     auto callback = (this->impl->enable_profiling || MIOPEN_GPU_SYNC)
                         ? this->impl->elapsed_time_handler()
                         : nullptr;
-    return k.Invoke(this->GetStream(), callback, coop_launch);
+    auto invoke = k.Invoke(this->GetStream(), callback, coop_launch);
+    if(this->impl->recording)
+        invoke.SetRecording(this->impl->recording, k.program);
+    return invoke;
+}
+
+void Handle::BeginCapture(std::vector<std::pair<ConstData_t, std::size_t>> buffers,
+                          bool launch) const
+{
+    if(this->impl->recording)
+        MIOPEN_THROW(miopenStatusInvalidValue, "Launch capture is already in progress");
+    this->impl->recording = std::make_shared<LaunchRecording>(std::move(buffers), launch);
+}
+
+LaunchRecording Handle::EndCapture() const
+{
+    if(!this->impl->recording)
+        MIOPEN_THROW(miopenStatusInvalidValue, "Launch capture has not been started");
+    auto recording = std::move(*this->impl->recording);
+    this->impl->recording.reset();
+    return recording;
 }
 
+bool Handle::IsCapturing() const { return this->impl->recording != nullptr; }
+
 Program Handle::LoadProgram(const fs::path& program_name,
                             std::string params,
                             const std::string& kernel_src,
@@ -543,25 +585,13 @@ Program Handle::LoadProgram(const fs::path& program_name,
 
     std::string orig_params = params; // make a copy for target ID fallback
 
-#if WORKAROUND_ISSUE_3001
-    if(program_name.extension() != ".mlir")
-        params = params + " -mcpu=" + this->GetTargetProperties().Name();
-#else
-    if(program_name.extension() == ".mlir")
-    { // no -mcpu
-    }
-    else if(program_name.extension() == ".s")
-    {
-        params += " -mcpu=" + LcOptionTargetStrings{this->GetTargetProperties()}.targetId;
-    }
-    else
-    {
-        params += " -mcpu=" + this->GetTargetProperties().Name();
-    }
-#endif
+    params = GetKernelCacheArgs(this->GetTargetProperties(), program_name, std::move(params));
 
-    auto hsaco = miopen::LoadBinary(
-        this->GetTargetProperties(), this->GetMaxComputeUnits(), program_name, params);
+    auto hsaco = miopen::LoadBinary(this->GetTargetProperties(),
+                                    this->GetMaxComputeUnits(),
+                                    program_name,
+                                    params,
+                                    &this->impl->lookup_counters);
     if(hsaco.empty())
     {
         const auto arch_target_id = miopen::SplitDelim(arch_name, ':');
@@ -572,7 +602,8 @@ Program Handle::LoadProgram(const fs::path& program_name,
             hsaco                = miopen::LoadBinary(this->GetTargetProperties(),
                                        this->GetMaxComputeUnits(),
                                        program_name,
-                                       orig_params + " -mcpu=" + base_arch);
+                                       orig_params + " -mcpu=" + base_arch,
+                                       &this->impl->lookup_counters);
         }
     }
 
@@ -595,7 +626,8 @@ Program Handle::LoadProgram(const fs::path& program_name,
                            this->GetTargetProperties(),
                            this->GetMaxComputeUnits(),
                            program_name,
-                           params);
+                           params,
+                           &this->impl->lookup_counters);
 
         if(force_attach_binary && p.IsCodeObjectInTempFile())
         {
@@ -653,17 +685,25 @@ Program Handle::LoadProgram(const fs::path& program_name,
 
 bool Handle::HasProgram(const fs::path& program_name, const std::string& params) const
 {
-    return this->impl->cache.HasProgram(program_name, params);
+    return this->impl->cache.HasProgram(*this, program_name, params);
 }
 
 void Handle::AddProgram(Program prog, const fs::path& program_name, const std::string& params) const
 {
-    this->impl->cache.AddProgram(prog, program_name, params);
+    this->impl->cache.AddProgram(*this, prog, program_name, params);
 }
 
 void Handle::ClearProgram(const fs::path& program_name, const std::string& params) const
 {
-    this->impl->cache.ClearProgram(program_name, params);
+    this->impl->cache.ClearProgram(*this, program_name, params);
+}
+
+std::string Handle::GetProgramCacheScope() const
+{
+    // Modules are loaded into the primary context of the device, which all the streams on it
+    // share.
+    return std::to_string(this->impl->device) + ':' + this->GetDeviceName() + ':' +
+           std::to_string(this->GetMaxComputeUnits());
 }
 
 void Handle::Finish() const
@@ -30,6 +30,8 @@
 #include <miopen/exec_utils.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/env.hpp>
+#include <miopen/process.hpp>
+#include <miopen/timer.hpp>
 #include <miopen/solver/implicitgemm_util.hpp>
 #include <miopen/target_properties.hpp>
 #include <boost/optional.hpp>
@@ -38,6 +40,7 @@
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_HIP_VERBOSE)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_HIP_DUMP)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_HIP_BUILD_IN_MEMORY)
 
 #if MIOPEN_OFFLINE_COMPILER_PATHS_V2
 
@@ -107,29 +110,15 @@ const char* getOffloadBundlerBinPath()
 
 namespace miopen {
 
-static fs::path HipBuildImpl(const TmpDir& tmp_dir,
-                             const fs::path& filename,
-                             std::string src,
-                             std::string params,
-                             const TargetProperties& target,
-                             const bool testing_mode)
+static void WriteKernelIncludes(const fs::path& dir)
 {
-    // Write out the include files
-    // Let's assume includes are overkill for feature tests & optimize'em out.
-    if(!testing_mode)
-    {
-        auto inc_list = GetKernelIncList();
-        fs::create_directories(tmp_dir);
-        for(const auto& inc_file : inc_list)
-        {
-            auto inc_src = GetKernelInc(inc_file);
-            WriteFile(inc_src, tmp_dir / inc_file);
-        }
-    }
-
-    src += "\nint main() {}\n";
-    WriteFile(src, tmp_dir / filename);
+    fs::create_directories(dir);
+    for(const auto& inc_file : GetKernelIncList())
+        WriteFile(GetKernelInc(inc_file), dir / inc_file);
+}
 
+static std::string MakeHipBuildParams(std::string params, const TargetProperties& target)
+{
     const LcOptionTargetStrings lots(target);
 
     if(params.find("-std=") == std::string::npos)
@@ -170,6 +159,31 @@ static fs::path HipBuildImpl(const TmpDir& tmp_dir,
 
     // hip version
     params += " -DHIP_PACKAGE_VERSION_FLAT=" + std::to_string(HIP_PACKAGE_VERSION_FLAT) + " ";
+    return params;
+}
+
+static fs::path HipBuildImpl(const TmpDir& tmp_dir,
+                             const fs::path& filename,
+                             std::string src,
+                             std::string params,
+                             const TargetProperties& target,
+                             const bool testing_mode)
+{
+    Timer timer;
+    timer.start();
+
+    // Write out the include files
+    // Let's assume includes are overkill for feature tests & optimize'em out.
+    if(!testing_mode)
+        WriteKernelIncludes(tmp_dir);
+
+    src += "\nint main() {}\n";
+    WriteFile(src, tmp_dir / filename);
+
+    const auto write_ms = timer.elapsed_ms();
+    timer.start();
+
+    params        = MakeHipBuildParams(std::move(params), target);
     auto bin_file = make_object_file_name(tmp_dir / filename);
 
     // compile
@@ -186,13 +200,19 @@ static fs::path HipBuildImpl(const TmpDir& tmp_dir,
                          '\'');
     }
 
+    const auto compile_ms = timer.elapsed_ms();
+    MIOPEN_LOG_I2(filename << " write files, ms: " << write_ms << ", compile, ms: " << compile_ms);
+
 #if defined(MIOPEN_OFFLOADBUNDLER_BIN) && !MIOPEN_BACKEND_HIP
     // Unbundling is not required for HIP runtime && hip-clang
+    const LcOptionTargetStrings lots(target);
+    timer.start();
     std::ignore = tmp_dir.Execute(MIOPEN_OFFLOADBUNDLER_BIN,
                                   "--type=o "
                                   "--targets=hipv4-amdgcn-amd-amdhsa-" +
                                       (std::string{'-'} + lots.device + lots.xnack) + " --inputs=" +
                                       bin_file + " --outputs=" + bin_file + ".hsaco --unbundle");
+    MIOPEN_LOG_I2(filename << " unbundle, ms: " << timer.elapsed_ms());
 
     auto hsaco = std::find_if(fs::directory_iterator{tmp_dir->path}, {}, [](auto entry) {
         return (entry.path().extension() == ".hsaco");
@@ -219,4 +239,59 @@ fs::path HipBuild(const TmpDir& tmp_dir,
     return HipBuildImpl(tmp_dir, filename, std::string{src}, params, target, false);
 }
 
+bool IsHipBuildInMemoryEnabled()
+{
+#if MIOPEN_BACKEND_HIP && !defined(_WIN32)
+    // -save-temps puts the intermediate files next to the source, which does not exist here.
+    return env::enabled(MIOPEN_DEBUG_HIP_BUILD_IN_MEMORY) && !env::enabled(MIOPEN_DEBUG_HIP_DUMP);
+#else
+    return false;
+#endif
+}
+
+std::vector<char> HipBuildPiped(const fs::path& compiler,
+                                const fs::path& cwd,
+                                std::string_view src,
+                                std::string_view args)
+{
+    std::vector<char> binary;
+    const auto status = Process{compiler}.Pipe(args, cwd, src, binary);
+    if(status != 0 || binary.empty())
+        MIOPEN_THROW("Failed cmd: '" + compiler.string() + "', args: '" + std::string{args} +
+                     "', exit status: " + std::to_string(status));
+    return binary;
+}
+
+std::vector<char> HipBuild(const fs::path& filename,
+                           std::string_view src,
+                           std::string params,
+                           const TargetProperties& target)
+{
+    // Include files are the same for every build, so the directories they are written to are
+    // reused. Nothing else is written there: the source goes to the standard input of the
+    // compiler and the code object is taken from its standard output.
+    static TmpDirPool scratch_dirs{"hip-build", [](const TmpDir& dir) {
+                                       WriteKernelIncludes(dir);
+                                   }};
+
+    if(miopen::solver::support_amd_buffer_atomic_fadd(target.Name()))
+        params += " -DCK_AMD_BUFFER_ATOMIC_FADD_RETURNS_FLOAT=1";
+
+    Timer timer;
+    timer.start();
+    const auto dir        = scratch_dirs.Acquire();
+    const auto scratch_ms = timer.elapsed_ms();
+
+    const auto source = std::string{src} + "\nint main() {}\n";
+    const auto args   = MakeHipBuildParams(std::move(params), target) + " -x hip - -o -";
+
+    timer.start();
+    auto binary           = HipBuildPiped(MIOPEN_HIP_COMPILER, dir.Get(), source, args);
+    const auto compile_ms = timer.elapsed_ms();
+
+    MIOPEN_LOG_I2(filename << " scratch dir, ms: " << scratch_ms
+                           << ", compile, ms: " << compile_ms);
+    return binary;
+}
+
 } // namespace miopen
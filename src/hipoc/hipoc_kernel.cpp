@@ -29,6 +29,7 @@
 #include <miopen/hipoc_kernel.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/handle_lock.hpp>
+#include <miopen/launch_recording.hpp>
 #include <miopen/logger.hpp>
 
 #include <hip/hip_ext.h>
@@ -89,6 +90,13 @@ void HIPOCKernelInvoke::run(void* args, std::size_t size) const
                   << GetName() << ", global_work_dim = " << DimToFormattedString(gdims.data(), 3)
                   << ", local_work_dim = " << DimToFormattedString(ldims.data(), 3));
 
+    if(recording)
+    {
+        recording->Record(recording_program, fun, ldims, gdims, name, args, size);
+        if(!recording->IsLaunching())
+            return;
+    }
+
     HipEventPtr start = nullptr;
     HipEventPtr stop  = nullptr;
     void* config[]    = {// HIP_LAUNCH_PARAM_* are macros that do horrible things
@@ -158,6 +166,9 @@ void HIPOCKernelInvoke::run_cooperative(void** kern_args) const
                   << GetName() << ", global_work_dim = " << DimToFormattedString(gdims.data(), 3)
                   << ", local_work_dim = " << DimToFormattedString(ldims.data(), 3));
 
+    if(recording)
+        MIOPEN_THROW(miopenStatusNotImplemented, "Cooperative launches cannot be captured");
+
     const auto& arch = env::value(MIOPEN_DEVICE_ARCH);
     if(!arch.empty())
     {
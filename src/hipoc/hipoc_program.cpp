@@ -154,7 +154,7 @@ static hipModulePtr CreateModule(const fs::path& hsaco_file)
     return m;
 }
 
-template <typename T> /// intended for std::string and std::vector<char>
+template <typename T> /// intended for std::string(_view) and std::vector<char>
 hipModulePtr CreateModuleInMem(const T& blob)
 {
     hipModule_t raw_m;
@@ -190,6 +190,17 @@ HIPOCProgramImpl::HIPOCProgramImpl(const fs::path& program_name,
     module = CreateModuleInMem(blob);
 }
 
+HIPOCProgramImpl::HIPOCProgramImpl(const fs::path& program_name,
+                                   std::string_view blob,
+                                   std::shared_ptr<const void> storage)
+    : program(program_name), mapped_binary(blob), mapped_storage(std::move(storage))
+{
+    const auto& arch = env::value(MIOPEN_DEVICE_ARCH);
+    if(!arch.empty())
+        return;
+    module = CreateModuleInMem(mapped_binary);
+}
+
 HIPOCProgramImpl::HIPOCProgramImpl(const fs::path& program_name,
                                    std::string params,
                                    const TargetProperties& target_,
@@ -216,6 +227,12 @@ void HIPOCProgramImpl::BuildCodeObjectInFile(std::string& params,
                                              std::string_view src,
                                              const fs::path& filename)
 {
+    if(filename.extension() == ".cpp" && IsHipBuildInMemoryEnabled())
+    {
+        binary = HipBuild(filename, src, params, target);
+        return;
+    }
+
     dir.emplace(filename.filename().string());
     hsaco_file = make_object_file_name(dir.get() / filename);
 
@@ -352,6 +369,13 @@ HIPOCProgram::HIPOCProgram(const fs::path& program_name, const std::vector<uint8
 {
 }
 
+HIPOCProgram::HIPOCProgram(const fs::path& program_name,
+                           std::string_view hsaco,
+                           std::shared_ptr<const void> storage)
+    : impl(std::make_shared<HIPOCProgramImpl>(program_name, hsaco, std::move(storage)))
+{
+}
+
 hipModule_t HIPOCProgram::GetModule() const { return impl->module.get(); }
 
 fs::path HIPOCProgram::GetCodeObjectPathname() const
@@ -383,6 +407,10 @@ bool HIPOCProgram::IsCodeObjectInFile() const { return !impl->hsaco_file.empty()
 
 bool HIPOCProgram::IsCodeObjectInTempFile() const { return impl->dir.has_value(); }
 
+bool HIPOCProgram::IsCodeObjectMapped() const { return !impl->mapped_binary.empty(); }
+
+std::string_view HIPOCProgram::GetMappedCodeObject() const { return impl->mapped_binary; }
+
 void HIPOCProgram::AttachBinary(std::vector<char> binary) { impl->binary = std::move(binary); }
 
 void HIPOCProgram::AttachBinary(fs::path binary)
@@ -0,0 +1,127 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/hipoc_kernel.hpp>
+#include <miopen/launch_recording.hpp>
+#include <miopen/logger.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+namespace miopen {
+
+void LaunchRecording::Record(const HIPOCProgram& program,
+                             hipFunction_t fun,
+                             const std::array<std::size_t, 3>& ldims,
+                             const std::array<std::size_t, 3>& gdims,
+                             const std::string& name,
+                             const void* args,
+                             std::size_t size)
+{
+    const auto idx    = launches.size();
+    const auto* bytes = static_cast<const char*>(args);
+    launches.push_back({program, fun, ldims, gdims, name, {bytes, bytes + size}});
+
+    // Pointer arguments are always naturally aligned in the packed arguments, so it is enough to
+    // look at the aligned words. A word is patched if it points into a registered buffer.
+    for(std::size_t offset = 0; offset + sizeof(std::uintptr_t) <= size;
+        offset += alignof(std::uintptr_t))
+    {
+        std::uintptr_t value;
+        std::memcpy(&value, bytes + offset, sizeof(value));
+        if(value == 0)
+            continue;
+
+        for(std::size_t b = 0; b < buffers.size(); ++b)
+        {
+            const auto base = reinterpret_cast<std::uintptr_t>(buffers[b].first);
+            if(base == 0)
+                continue;
+            if(value == base || (value > base && value < base + buffers[b].second))
+            {
+                patches.push_back({idx, offset, b, static_cast<std::ptrdiff_t>(value - base)});
+                break;
+            }
+        }
+    }
+
+    MIOPEN_LOG_I2("Recorded launch #" << idx << ": " << name << ", " << size << " bytes");
+}
+
+std::vector<char> LaunchRecording::GetArgs(std::size_t idx,
+                                           const std::vector<Data_t>& new_buffers) const
+{
+    if(idx >= launches.size())
+        MIOPEN_THROW(miopenStatusBadParm, "Recorded launch index is out of range");
+    if(new_buffers.size() != buffers.size())
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "Expected " + std::to_string(buffers.size()) + " buffers for replay, got " +
+                         std::to_string(new_buffers.size()));
+
+    auto args = launches[idx].args;
+    for(const auto& patch : patches)
+    {
+        if(patch.launch != idx)
+            continue;
+        const auto value = reinterpret_cast<std::uintptr_t>(new_buffers[patch.buffer]) +
+                           static_cast<std::uintptr_t>(patch.delta);
+        std::memcpy(args.data() + patch.offset, &value, sizeof(value));
+    }
+    return args;
+}
+
+void LaunchRecording::Replay(const Handle& handle, const std::vector<Data_t>& new_buffers) const
+{
+    float elapsed = 0.0f;
+
+    for(std::size_t i = 0; i < launches.size(); ++i)
+    {
+        const auto& launch = launches[i];
+        auto args          = GetArgs(i, new_buffers);
+
+        HIPOCKernel kernel;
+        kernel.program = launch.program;
+        kernel.name    = launch.name;
+        kernel.fun     = launch.fun;
+        kernel.ldims   = launch.ldims;
+        kernel.gdims   = launch.gdims;
+
+        handle.Run(kernel).RunPacked(args.data(), args.size());
+
+        if(handle.IsProfilingEnabled())
+            elapsed += handle.GetKernelTime();
+    }
+
+    if(handle.IsProfilingEnabled())
+    {
+        handle.ResetKernelTime();
+        handle.AccumKernelTime(elapsed);
+    }
+}
+
+} // namespace miopen
@@ -0,0 +1,208 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/shared_program_cache.hpp>
+
+#include <miopen/hipoc_program.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+
+namespace miopen {
+
+std::size_t SharedProgramCache::KeyHash::operator()(const Key& key) const
+{
+    const auto hash = std::hash<std::string>{};
+    return hash(std::get<0>(key)) ^ (hash(std::get<1>(key)) << 1) ^ (hash(std::get<2>(key)) << 2);
+}
+
+SharedProgramCache& SharedProgramCache::Instance()
+{
+    // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+    static SharedProgramCache instance;
+    return instance;
+}
+
+Program SharedProgramCache::GetOrLoad(const std::string& scope,
+                                      const fs::path& name,
+                                      const std::string& params,
+                                      const std::function<Program()>& load)
+{
+    const auto key = Key{scope, name.string(), params};
+    auto promise   = std::promise<Program>{};
+    auto id        = std::size_t{0};
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        PruneIfNeeded();
+        auto& entry = entries[key];
+
+        if(entry.loading.valid())
+        {
+            auto loading = entry.loading;
+            if(loading.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+            {
+                ++stats.hits;
+            }
+            else
+            {
+                ++stats.waits;
+                MIOPEN_LOG_I2("Waiting for " << name << " to be loaded by another thread");
+            }
+            lock.unlock();
+            return loading.get();
+        }
+
+        if(auto impl = entry.program.lock())
+        {
+            ++stats.hits;
+            auto program = Program{};
+            program.impl = std::move(impl);
+            return program;
+        }
+
+        id            = ++last_id;
+        entry.id      = id;
+        entry.loading = promise.get_future().share();
+        ++stats.loads;
+    }
+
+    auto program = Program{};
+    try
+    {
+        program = load();
+    }
+    catch(...)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++stats.failures;
+            const auto it = entries.find(key);
+            if(it != entries.end() && it->second.id == id)
+                entries.erase(it);
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+
+    {
+        // The loaded program is only referenced from now on, the handles own it.
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = entries.find(key);
+        if(it != entries.end() && it->second.id == id)
+        {
+            it->second.loading = {};
+            it->second.program = program.impl;
+        }
+    }
+    promise.set_value(program);
+    return program;
+}
+
+std::optional<Program>
+SharedProgramCache::Find(const std::string& scope, const fs::path& name, const std::string& params)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto it = entries.find(Key{scope, name.string(), params});
+    if(it == entries.end() || it->second.loading.valid())
+        return std::nullopt;
+
+    auto impl = it->second.program.lock();
+    if(!impl)
+    {
+        entries.erase(it);
+        return std::nullopt;
+    }
+
+    ++stats.hits;
+    auto program = Program{};
+    program.impl = std::move(impl);
+    return program;
+}
+
+void SharedProgramCache::Store(const std::string& scope,
+                               const fs::path& name,
+                               const std::string& params,
+                               const Program& program)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    PruneIfNeeded();
+    auto& entry   = entries[Key{scope, name.string(), params}];
+    entry.id      = ++last_id;
+    entry.loading = {};
+    entry.program = program.impl;
+}
+
+void SharedProgramCache::Erase(const std::string& scope,
+                               const fs::path& name,
+                               const std::string& params)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.erase(Key{scope, name.string(), params});
+}
+
+void SharedProgramCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    prune_at = MinPruneSize;
+}
+
+std::size_t SharedProgramCache::Size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+void SharedProgramCache::PruneIfNeeded()
+{
+    if(entries.size() < prune_at)
+        return;
+
+    for(auto it = entries.begin(); it != entries.end();)
+    {
+        if(!it->second.loading.valid() && it->second.program.expired())
+            it = entries.erase(it);
+        else
+            ++it;
+    }
+    prune_at = std::max(MinPruneSize, 2 * entries.size());
+}
+
+SharedProgramCacheStats SharedProgramCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+void SharedProgramCache::ResetStats()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    stats = {};
+}
+
+} // namespace miopen
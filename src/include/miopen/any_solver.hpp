@@ -129,6 +129,12 @@ struct AnySolver
         return ptr_value->MayNeedWorkspace();
     }
 
+    std::uint64_t GetFeatureMask() const
+    {
+        assert(ptr_value != nullptr);
+        return ptr_value->GetFeatureMask();
+    }
+
     // virtual base class
     struct AnySolver_base
     {
@@ -163,6 +169,7 @@ struct AnySolver
         virtual size_t GetWorkspaceSize(const ExecutionContext& ctx,
                                         const miopen::conv::ProblemDescription& problem) const = 0;
         virtual bool MayNeedWorkspace() const                                                  = 0;
+        virtual std::uint64_t GetFeatureMask() const                                           = 0;
     };
 
     // templated derived class
@@ -372,6 +379,7 @@ struct AnySolver
             return value.GetWorkspaceSize(ctx, problem);
         }
         bool MayNeedWorkspace() const override { return value.MayNeedWorkspace(); }
+        std::uint64_t GetFeatureMask() const override { return value.GetFeatureMask(); }
         const std::type_info& Type() const override { return typeid(T); };
         std::string GetSolverDbId() const override { return value.SolverDbId(); }
 
@@ -30,6 +30,7 @@
 #include <miopen/config.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/filesystem.hpp>
+#include <miopen/lookup_counters.hpp>
 #include <string>
 
 namespace miopen {
@@ -41,27 +42,42 @@ GetCacheFile(const std::string& device, const fs::path& name, const std::string&
 
 MIOPEN_INTERNALS_EXPORT fs::path GetCachePath(bool is_system);
 
+/// Returns the build parameters the HIP backend stores and looks up the binary of the program
+/// with, i.e. params with the target appended.
+MIOPEN_INTERNALS_EXPORT std::string GetKernelCacheArgs(const TargetProperties& target,
+                                                       const fs::path& program_name,
+                                                       std::string params);
+
+/// The lookups and stores are counted in the process-wide LookupCounters and in `counters` unless
+/// it is null.
 #if !MIOPEN_ENABLE_SQLITE_KERN_CACHE
 fs::path LoadBinary(const TargetProperties& target,
                     std::size_t num_cu,
                     const fs::path& name,
-                    const std::string& args);
+                    const std::string& args,
+                    LookupCounters* counters = nullptr);
 
 fs::path SaveBinary(const fs::path& binary_path,
                     const TargetProperties& target,
                     const fs::path& name,
-                    const std::string& args);
+                    const std::string& args,
+                    LookupCounters* counters = nullptr);
 #else
+/// Returns the installed kernel database for the target, or an empty path if there is none.
+fs::path GetSystemKernelDbPath(const TargetProperties& target, std::size_t num_cu);
+
 std::vector<char> LoadBinary(const TargetProperties& target,
                              std::size_t num_cu,
                              const fs::path& name,
-                             const std::string& args);
+                             const std::string& args,
+                             LookupCounters* counters = nullptr);
 
 void SaveBinary(const std::vector<char>& hsaco,
                 const TargetProperties& target,
                 std::size_t num_cu,
                 const fs::path& name,
-                const std::string& args);
+                const std::string& args,
+                LookupCounters* counters = nullptr);
 #endif
 
 } // namespace miopen
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_BINARY_DB_RECORD_HPP_
+#define GUARD_MIOPEN_BINARY_DB_RECORD_HPP_
+
+#include <miopen/db_record.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/perf_field.hpp>
+
+#include <boost/optional/optional.hpp>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace miopen {
+
+/// Compact binary encoding of the IDs and VALUES of a db record.
+///
+/// Payload format, all integers are little-endian:
+///   u8 version, u16 count, count * u32 offset of the item, items sorted by ID.
+/// Item format:
+///   u16 ID size, ID, u8 type, then depending on the type:
+///     Text:       u32 VALUES size, VALUES;
+///     FindDbData: f32 time, LEB128 workspace, u8 algorithm index into a fixed table of
+///                 convolution algorithm names, or 0xFF followed by u16 size and the name.
+///
+/// VALUES are stored as FindDbData only when they are converted back to exactly the same text,
+/// so text -> binary -> text is lossless for any record.
+///
+/// An instance is a lazy accessor over an encoded payload: it does not copy the data and only
+/// decodes the items that are asked for. The payload has to outlive it.
+class MIOPEN_INTERNALS_EXPORT BinaryDbRecord
+{
+public:
+    enum class ValueType : std::uint8_t
+    {
+        Text       = 0,
+        FindDbData = 1,
+    };
+
+    static constexpr std::uint8_t Version = 1;
+
+    explicit BinaryDbRecord(std::string_view payload_);
+
+    bool IsValid() const { return valid; }
+    std::size_t GetSize() const { return count; }
+    std::string_view GetId(std::size_t index) const;
+    bool Contains(std::string_view id) const { return Find(id) != nullptr; }
+
+    /// Decodes VALUES of the ID only. Returns false if there is no such ID or VALUES can not be
+    /// represented as the requested type.
+    bool GetValues(std::string_view id, FindDbData& values) const;
+    bool GetValues(std::string_view id, std::string& values) const;
+
+    static std::string Encode(const DbRecord& record);
+    static boost::optional<DbRecord> Decode(const std::string& key, std::string_view payload);
+
+    /// Parses a text db line: KEY=ID:VALUES;ID:VALUES
+    static boost::optional<DbRecord> ParseText(const std::string& line);
+    static std::string ToText(const DbRecord& record);
+
+    /// Converts a whole db file between the text format and a file of binary records.
+    /// Binary file format: "MIOPBFDB", then for each record u32 KEY size, KEY, u32 payload size,
+    /// payload.
+    static bool ConvertTextToBinary(const fs::path& from, const fs::path& to);
+    static bool ConvertBinaryToText(const fs::path& from, const fs::path& to);
+
+private:
+    std::string_view payload;
+    std::size_t count = 0;
+    bool valid        = false;
+
+    const char* Find(std::string_view id) const;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_BINARY_DB_RECORD_HPP_
@@ -0,0 +1,99 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_BUFFER_POOL_HPP
+#define GUARD_MIOPEN_BUFFER_POOL_HPP
+
+#include <miopen/allocator.hpp>
+#include <miopen/config.hpp>
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+/// Caching allocator layered over Allocator. Buffers released by their owners are kept in size
+/// classes and handed out again for requests of the same class instead of going through the
+/// underlying allocator. Idle buffers are held up to the capacity of the pool, the rest is freed.
+///
+/// Buffers are reused in the order of release, which is safe for work submitted to a single
+/// stream. Buffers must not outlive the pool.
+class MIOPEN_INTERNALS_EXPORT BufferPool
+{
+public:
+    struct Counters
+    {
+        std::size_t allocations   = 0; // Buffers obtained from the underlying allocator
+        std::size_t deallocations = 0; // Buffers returned to the underlying allocator
+        std::size_t hits          = 0; // Requests served from the idle buffers
+        std::size_t misses        = 0; // Requests which needed a new allocation
+        std::size_t idle_bytes    = 0;
+        std::size_t in_use_bytes  = 0;
+    };
+
+    /// Default capacity comes from MIOPEN_BUFFER_POOL_CAPACITY, 0 unless it is set.
+    BufferPool();
+    explicit BufferPool(std::size_t capacity_);
+    ~BufferPool();
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    /// The returned buffer goes back to the pool when destroyed. It may be larger than requested.
+    Allocator::ManageDataPtr Get(const Allocator& allocator, std::size_t size);
+
+    /// Frees idle buffers, largest first, until at most `target` bytes are held.
+    void Trim(std::size_t target = 0);
+
+    void SetCapacity(std::size_t value);
+    std::size_t GetCapacity() const;
+    Counters GetCounters() const;
+
+    static std::size_t GetSizeClass(std::size_t size);
+
+private:
+    struct InUse
+    {
+        Allocator::ManageDataPtr buffer;
+        std::size_t size_class;
+    };
+
+    static void Release(void* context, void* ptr);
+    void Release(void* ptr);
+    void TrimImpl(std::size_t target);
+
+    mutable std::mutex mutex;
+    std::size_t capacity;
+    Counters counters;
+    std::map<std::size_t, std::vector<Allocator::ManageDataPtr>> idle;
+    std::unordered_map<void*, InUse> in_use;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_BUFFER_POOL_HPP
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_AI_MODEL_HPP_
+#define GUARD_MIOPEN_AI_MODEL_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace miopen {
+class MappedFile;
+
+namespace ai {
+
+/// A TunaNet or KernelTuningNet model in the binary format of model_format.
+///
+/// Construction only maps the file and checks its header, so that the models can be opened
+/// cheaply on the first heuristic call. The layers are resolved and validated against the
+/// weights on the first prediction, which also lays out their activations in a workspace that
+/// each thread allocates once and reuses.
+class MIOPEN_INTERNALS_EXPORT Network
+{
+public:
+    explicit Network(const fs::path& path);
+    ~Network();
+
+    Network(const Network&) = delete;
+    Network& operator=(const Network&) = delete;
+
+    /// Runs inference. Each input and output is a row-major tensor as described in
+    /// model_format, in the order of the inputs and outputs of the original model.
+    std::vector<std::vector<float>> Predict(const std::vector<std::vector<float>>& inputs) const;
+
+    /// Number of elements of each input.
+    std::vector<std::size_t> GetInputSizes() const;
+
+private:
+    struct Layer;
+
+    fs::path path;
+    std::unique_ptr<MappedFile> file;
+    mutable std::once_flag layers_init;
+    mutable std::vector<Layer> layers;
+    mutable std::size_t workspace_size = 0;
+
+    void InitLayers() const;
+};
+
+} // namespace ai
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_AI_MODEL_HPP_
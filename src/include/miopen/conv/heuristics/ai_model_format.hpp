@@ -0,0 +1,107 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_AI_MODEL_FORMAT_HPP_
+#define GUARD_MIOPEN_AI_MODEL_FORMAT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace miopen {
+namespace ai {
+/// Binary form of the TunaNet and KernelTuningNet models. It is written at build time by
+/// aimodel2bin from the frugally-deep JSON models and memory mapped at run time.
+///
+/// A file is a Header, the Nodes of the layer graph in topological order, the outputs of the
+/// model as NodeOutputs and the weights as float32, all in the little endian byte order. Tensors
+/// are row-major matrices of rows x cols, where sequences have a row per time step and vectors
+/// have a single row.
+namespace model_format {
+
+constexpr char Magic[8]           = {'M', 'I', 'O', 'P', 'E', 'N', 'N', 'N'};
+constexpr std::uint32_t Version   = 1;
+constexpr std::size_t MaxInputs   = 3;
+constexpr std::uint64_t NoWeights = ~std::uint64_t{0};
+/// The weights start at a multiple of this many bytes, so they can be read with aligned loads.
+constexpr std::uint64_t DataAlignment = 64;
+
+enum class LayerType : std::uint32_t
+{
+    /// params: rows, cols.
+    Input = 0,
+    /// params: input size, units. weights: kernel (input size x units), bias (units) or none.
+    Dense = 1,
+    ReLU  = 2,
+    /// Sum of two tensors of the same shape.
+    Add = 3,
+    /// params: input dim, output dim. weights: embeddings (input dim x output dim).
+    /// Each element of the input is a token, the output has a row per token.
+    Embedding = 4,
+    /// params: input size, units, return sequences. weights: kernel (input size x 4 units),
+    /// recurrent kernel (units x 4 units), bias (4 units), with the gates in the i, f, c, o order
+    /// of Keras. The inputs are the sequence and optionally the initial h and c states. The
+    /// outputs are the sequence or its last step, and the final h and c states.
+    LSTM = 5,
+};
+
+struct NodeOutput
+{
+    std::uint32_t node;
+    std::uint32_t output;
+};
+
+struct Header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t num_nodes;
+    std::uint32_t num_outputs;
+    std::uint32_t reserved;
+    /// In bytes, from the beginning of the file.
+    std::uint64_t data_offset;
+    /// In floats.
+    std::uint64_t data_size;
+};
+
+struct Node
+{
+    LayerType type;
+    std::uint32_t num_inputs;
+    NodeOutput inputs[MaxInputs];
+    std::uint32_t params[4];
+    /// In floats, from the beginning of the data, or NoWeights. aimodel2bin aligns them to
+    /// DataAlignment bytes.
+    std::uint64_t weights[3];
+};
+
+static_assert(sizeof(Header) == 40, "The layout of the file must not depend on the compiler");
+static_assert(sizeof(Node) == 72, "The layout of the file must not depend on the compiler");
+static_assert(sizeof(NodeOutput) == 8, "The layout of the file must not depend on the compiler");
+
+} // namespace model_format
+} // namespace ai
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_AI_MODEL_FORMAT_HPP_
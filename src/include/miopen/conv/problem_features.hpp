@@ -0,0 +1,183 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#pragma once
+
+#include <miopen/config.hpp>
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+namespace miopen {
+
+struct ExecutionContext;
+
+namespace conv {
+
+struct ProblemDescription;
+
+/// Coarse classes of a convolution problem and of the target it is solved for.
+/// A problem has exactly one feature of each group (layout, direction, target...),
+/// except for the data types where there is a feature per type any tensor has.
+enum class ProblemFeature : unsigned
+{
+    LayoutDefault,
+    LayoutNHWC,
+    LayoutOther,
+
+    TypeFp32,
+    TypeFp16,
+    TypeBfp16,
+    TypeInt8,
+    TypeInt32,
+    TypeFp8, // Both fp8 and bfp8
+    TypeOther,
+
+    Spatial2d,
+    Spatial3d,
+
+    DirectionForward,
+    DirectionBackwardData,
+    DirectionBackwardWrW,
+
+    GroupsOne,
+    GroupsMany,
+
+    StrideOne,
+    StrideOther,
+
+    DilationOne,
+    DilationOther,
+
+    Filter1x1,
+    Filter3x3,
+    FilterOther,
+
+    TargetGfx8,
+    TargetGfx900,
+    TargetGfx906,
+    TargetGfx908,
+    TargetGfx90a,
+    TargetGfx94x,
+    TargetGfx9Other,
+    TargetGfx10,
+    TargetGfx11,
+    TargetGfx12,
+    TargetOther,
+};
+
+using ProblemFeatures = std::uint64_t;
+
+constexpr ProblemFeatures FeatureBits(std::initializer_list<ProblemFeature> features)
+{
+    ProblemFeatures bits = 0;
+    for(const auto feature : features)
+        bits |= ProblemFeatures{1} << static_cast<unsigned>(feature);
+    return bits;
+}
+
+namespace feature_groups {
+
+// clang-format off
+constexpr ProblemFeatures Layout    = FeatureBits({ProblemFeature::LayoutDefault,
+                                                   ProblemFeature::LayoutNHWC,
+                                                   ProblemFeature::LayoutOther});
+constexpr ProblemFeatures Type      = FeatureBits({ProblemFeature::TypeFp32,
+                                                   ProblemFeature::TypeFp16,
+                                                   ProblemFeature::TypeBfp16,
+                                                   ProblemFeature::TypeInt8,
+                                                   ProblemFeature::TypeInt32,
+                                                   ProblemFeature::TypeFp8,
+                                                   ProblemFeature::TypeOther});
+constexpr ProblemFeatures Spatial   = FeatureBits({ProblemFeature::Spatial2d,
+                                                   ProblemFeature::Spatial3d});
+constexpr ProblemFeatures Direction = FeatureBits({ProblemFeature::DirectionForward,
+                                                   ProblemFeature::DirectionBackwardData,
+                                                   ProblemFeature::DirectionBackwardWrW});
+constexpr ProblemFeatures Groups    = FeatureBits({ProblemFeature::GroupsOne,
+                                                   ProblemFeature::GroupsMany});
+constexpr ProblemFeatures Stride    = FeatureBits({ProblemFeature::StrideOne,
+                                                   ProblemFeature::StrideOther});
+constexpr ProblemFeatures Dilation  = FeatureBits({ProblemFeature::DilationOne,
+                                                   ProblemFeature::DilationOther});
+constexpr ProblemFeatures Filter    = FeatureBits({ProblemFeature::Filter1x1,
+                                                   ProblemFeature::Filter3x3,
+                                                   ProblemFeature::FilterOther});
+constexpr ProblemFeatures Target    = FeatureBits({ProblemFeature::TargetGfx8,
+                                                   ProblemFeature::TargetGfx900,
+                                                   ProblemFeature::TargetGfx906,
+                                                   ProblemFeature::TargetGfx908,
+                                                   ProblemFeature::TargetGfx90a,
+                                                   ProblemFeature::TargetGfx94x,
+                                                   ProblemFeature::TargetGfx9Other,
+                                                   ProblemFeature::TargetGfx10,
+                                                   ProblemFeature::TargetGfx11,
+                                                   ProblemFeature::TargetGfx12,
+                                                   ProblemFeature::TargetOther});
+// clang-format on
+
+constexpr ProblemFeatures All[] = {
+    Layout, Type, Spatial, Direction, Groups, Stride, Dilation, Filter, Target};
+
+} // namespace feature_groups
+
+/// Builds a solver feature mask. Within each group which has any of the listed features,
+/// only the listed ones are accepted. Groups which have none are not restricted, e.g.
+/// FeatureMask({Spatial2d, TypeFp32, TypeFp16}) accepts any layout or direction.
+constexpr ProblemFeatures FeatureMask(std::initializer_list<ProblemFeature> allowed)
+{
+    const auto allowed_bits = FeatureBits(allowed);
+    auto mask               = ~ProblemFeatures{0};
+    for(const auto group : feature_groups::All)
+    {
+        if((allowed_bits & group) != 0)
+            mask = (mask & ~group) | (allowed_bits & group);
+    }
+    return mask;
+}
+
+/// Mask of a solver which does not restrict any feature.
+constexpr ProblemFeatures AnyFeatures = ~ProblemFeatures{0};
+
+/// True if the problem has no feature outside of the mask of a solver. False means that the
+/// solver is not applicable, true means nothing and IsApplicable() has to be called.
+constexpr bool IsFeatureMatch(ProblemFeatures problem, ProblemFeatures mask)
+{
+    return (problem & ~mask) == 0;
+}
+
+/// Computes the features of a problem for the given device, e.g. "gfx90a".
+MIOPEN_INTERNALS_EXPORT ProblemFeatures GetProblemFeatures(const ProblemDescription& problem,
+                                                           const std::string& device_name);
+
+/// Computes the features of a problem for the device of the context. Returns no features,
+/// which pass any mask, if the pre-filter is disabled by MIOPEN_DEBUG_CONV_FEATURE_FILTER=0.
+MIOPEN_INTERNALS_EXPORT ProblemFeatures GetProblemFeatures(const ExecutionContext& ctx,
+                                                           const ProblemDescription& problem);
+
+} // namespace conv
+} // namespace miopen
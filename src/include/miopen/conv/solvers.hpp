@@ -29,6 +29,7 @@
 #include <miopen/config.hpp>
 
 #include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/problem_features.hpp>
 #include <miopen/conv_solution.hpp>
 #include <miopen/execution_context.hpp>
 #include <miopen/legacy_exhaustive_search.hpp>
@@ -120,6 +121,8 @@ struct ConvAsm3x3U final : ConvTunableSolver<PerformanceConfigConvAsm3x3U>
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsm3x3U>(); }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT PerformanceConfigConvAsm3x3U GetDefaultPerformanceConfig(
@@ -228,6 +231,8 @@ struct ConvAsm1x1U final : ConvTunableSolver<PerformanceConfigConvAsm1x1U>
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsm1x1U>(); }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigConvAsm1x1U GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT bool
@@ -341,6 +346,8 @@ struct ConvAsm5x10u2v2f1 final : ConvSolver
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsm5x10u2v2f1>(); }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT ConvSolution
@@ -364,6 +371,8 @@ struct ConvAsm7x7c3h224w224k64u2v2p3q3f1 final : ConvSolver
         return GetSolverDbId<ConvAsm7x7c3h224w224k64u2v2p3q3f1>();
     }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT ConvSolution
@@ -377,6 +386,8 @@ struct ConvOclDirectFwd11x11 final : ConvSolver
         return GetSolverDbId<ConvOclDirectFwd11x11>();
     }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT bool
     IsApplicable(const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT ConvSolution
@@ -2235,6 +2246,8 @@ struct ConvAsmBwdWrW3x3 final : ConvTunableSolver<PerformanceConfigAsmDirect3x3W
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsmBwdWrW3x3>(); }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigAsmDirect3x3WrW GetDefaultPerformanceConfig(
         const ExecutionContext&, const miopen::conv::ProblemDescription&) const override;
     MIOPEN_INTERNALS_EXPORT bool
@@ -2378,6 +2391,8 @@ struct ConvAsmBwdWrW1x1 final : ConvTunableSolver<PerformanceConfigConvAsmBwdWrW
 {
     const std::string& SolverDbId() const override { return GetSolverDbId<ConvAsmBwdWrW1x1>(); }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigConvAsmBwdWrW1x1 MIOPEN_INTERNALS_EXPORT
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -3462,6 +3477,8 @@ struct ConvAsmImplicitGemmGTCDynamicFwdXdlopsNHWC final
         return GetSolverDbId<ConvAsmImplicitGemmGTCDynamicFwdXdlopsNHWC>();
     }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigAsmImplicitGemmGTCFwdXdlopsNHWC
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4462,6 +4479,8 @@ struct ConvHipImplicitGemmGroupFwdXdlops final
         return GetSolverDbId<ConvHipImplicitGemmGroupFwdXdlops>();
     }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemmGroupFwdXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4539,6 +4558,8 @@ struct ConvHipImplicitGemm3DGroupFwdXdlops final
         return GetSolverDbId<ConvHipImplicitGemm3DGroupFwdXdlops>();
     }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemm3DGroupFwdXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4616,6 +4637,8 @@ struct ConvHipImplicitGemm3DGroupWrwXdlops final
         return GetSolverDbId<ConvHipImplicitGemm3DGroupWrwXdlops>();
     }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemm3DGroupWrwXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4693,6 +4716,8 @@ struct ConvHipImplicitGemm3DGroupBwdXdlops final
         return GetSolverDbId<ConvHipImplicitGemm3DGroupBwdXdlops>();
     }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemm3DGroupBwdXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4784,6 +4809,8 @@ struct ConvHipImplicitGemmGroupBwdXdlops final
         return GetSolverDbId<ConvHipImplicitGemmGroupBwdXdlops>();
     }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemmGroupBwdXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -4878,6 +4905,8 @@ struct ConvHipImplicitGemmGroupWrwXdlops final
         return GetSolverDbId<ConvHipImplicitGemmGroupWrwXdlops>();
     }
 
+    MIOPEN_INTERNALS_EXPORT std::uint64_t GetFeatureMask() const override;
+
     MIOPEN_INTERNALS_EXPORT PerformanceConfigHipImplicitGemmGroupWrwXdlops
     GetDefaultPerformanceConfig(const ExecutionContext&,
                                 const miopen::conv::ProblemDescription&) const override;
@@ -26,9 +26,12 @@
 #ifndef GUARD_MIOPEN_DB_HPP_
 #define GUARD_MIOPEN_DB_HPP_
 
+#include <miopen/db_journal.hpp>
 #include <miopen/db_record.hpp>
+#include <miopen/errors.hpp>
 #include <miopen/rank.hpp>
 #include <miopen/filesystem.hpp>
+#include <miopen/lookup_counters.hpp>
 
 #include <boost/core/explicit_operator_bool.hpp>
 #include <boost/none.hpp>
@@ -142,6 +145,8 @@ protected:
     const DbKinds db_kind;
 
     LockFile& GetLockFile() { return lock_file; }
+    /// Returns the write-behind journal of the db or nullptr if journaling is disabled.
+    DbJournal* GetJournal() const { return journal; }
     const fs::path& GetFileName() const { return filename; }
     bool IsWarningIfUnreadable() const { return warning_if_unreadable; }
     boost::optional<DbRecord> FindRecordUnsafe(const std::string& key, RecordPositions* pos);
@@ -150,11 +155,21 @@ protected:
     bool RemoveRecordUnsafe(const std::string& key);
 
 private:
+    struct NoJournal
+    {
+    };
+
     fs::path filename;
     LockFile& lock_file;
     const bool warning_if_unreadable;
+    DbJournal* journal = nullptr;
+
+    friend class DbJournal;
+
+    PlainTextDb(DbKinds db_kind_, const fs::path& filename_, bool is_system, NoJournal);
 
     bool FlushUnsafe(const DbRecord& record, const RecordPositions* pos);
+    bool FoldJournalUnsafe(const DbJournalEntries& entries);
 
     template <class T>
     inline boost::optional<DbRecord> FindRecordUnsafe(const T& problem_config)
@@ -286,70 +301,101 @@ private:
 #endif
 };
 
+inline LookupSource GetLookupSource(DbKinds kind)
+{
+    switch(kind)
+    {
+    case DbKinds::FindDb: return LookupSource::FindDb;
+    case DbKinds::PerfDb: return LookupSource::PerfDb;
+    case DbKinds::KernelDb: return LookupSource::KernelDb;
+    }
+    MIOPEN_THROW(miopenStatusInternalError);
+}
+
+/// Logs the time of the operations and counts the lookups and stores in the process-wide
+/// LookupCounters and in the ones of the handle, if given.
 template <class TInnerDb>
 class DbTimer
 {
 public:
     template <class... TArgs>
-    DbTimer(TArgs&&... args) : inner(args...)
+    DbTimer(DbKinds kind, TArgs&&... args) : DbTimer(nullptr, kind, args...)
+    {
+    }
+
+    template <class... TArgs>
+    DbTimer(LookupCounters* handle_counters_, DbKinds kind, TArgs&&... args)
+        : inner(kind, args...), source(GetLookupSource(kind)), handle_counters(handle_counters_)
     {
     }
 
     template <typename... U>
     auto FindRecord(const U&... args)
     {
-        return Measure("FindRecord", [&]() { return inner.FindRecord(args...); });
+        return Measure("FindRecord", Counted::Lookup, [&]() { return inner.FindRecord(args...); });
     }
 
     template <typename... U>
     auto StoreRecord(U&... record)
     {
-        return Measure("StoreRecord", [&]() { return inner.StoreRecord(record...); });
+        return Measure(
+            "StoreRecord", Counted::Store, [&]() { return inner.StoreRecord(record...); });
     }
 
     template <typename... U>
     auto UpdateRecord(U&... args)
     {
-        return Measure("UpdateRecord", [&]() { return inner.UpdateRecord(args...); });
+        return Measure(
+            "UpdateRecord", Counted::Store, [&]() { return inner.UpdateRecord(args...); });
     }
 
     template <typename... U>
     auto RemoveRecord(const U&... args)
     {
-        return Measure("RemoveRecord", [&]() { return inner.RemoveRecord(args...); });
+        return Measure("RemoveRecord", Counted::No, [&]() { return inner.RemoveRecord(args...); });
     }
 
     template <typename... U>
     auto Update(const U&... args)
     {
-        return Measure("Update", [&]() { return inner.Update(args...); });
+        return Measure("Update", Counted::Store, [&]() { return inner.Update(args...); });
     }
 
     template <typename... U>
     bool Load(U&... args)
     {
-        return Measure("Load", [&]() { return inner.Load(args...); });
+        return Measure("Load", Counted::Lookup, [&]() { return inner.Load(args...); });
     }
 
     template <typename... U>
     bool Remove(const U&... args)
     {
-        return Measure("Remove", [&]() { return inner.Remove(args...); });
+        return Measure("Remove", Counted::No, [&]() { return inner.Remove(args...); });
     }
 
 private:
+    enum class Counted
+    {
+        No,
+        Lookup, // Hit if the result is not empty
+        Store,
+    };
+
     TInnerDb inner;
+    LookupSource source;
+    LookupCounters* handle_counters;
 
     template <class TFunc>
-    static auto Measure(const std::string& funcName, TFunc&& func)
+    auto Measure(const std::string& funcName, Counted counted, TFunc&& func) const
     {
-        if(!miopen::IsLogging(LoggingLevel::Info2))
-            return func();
-
-        const auto start = std::chrono::high_resolution_clock::now();
+        const auto start = std::chrono::steady_clock::now();
         auto ret         = func();
-        const auto end   = std::chrono::high_resolution_clock::now();
-        MIOPEN_LOG_I2("Db::" << funcName << " time: " << (end - start).count() * .000001f << " ms");
+        const auto time  = std::chrono::steady_clock::now() - start;
+        if(counted == Counted::Lookup)
+            RecordLookup(handle_counters, source, ret ? LookupEvent::Hit : LookupEvent::Miss, time);
+        else if(counted == Counted::Store)
+            RecordLookup(handle_counters, source, LookupEvent::Store, time);
+        MIOPEN_LOG_I2("Db::" << funcName << " time: " << time.count() * .000001f << " ms");
         return ret;
     }
 };
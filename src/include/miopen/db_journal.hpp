@@ -0,0 +1,104 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DB_JOURNAL_HPP_
+#define GUARD_MIOPEN_DB_JOURNAL_HPP_
+
+#include <miopen/db_record.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <boost/optional/optional.hpp>
+
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace miopen {
+
+struct DbJournalEntry
+{
+    bool replace; // replaces the record instead of merging into it
+    DbRecord record;
+};
+
+using DbJournalEntries = std::map<std::string, DbJournalEntry>;
+
+/// Write-behind journal of a user database file.
+///
+/// When MIOPEN_DB_JOURNAL is enabled, stores, updates and removals are appended to a journal
+/// file owned by the process instead of rewriting the database under the inter-process lock.
+/// The journal also keeps the pending changes in memory, so that lookups of this process see
+/// its own writes. Pending changes are folded into the database once their number reaches
+/// MIOPEN_DB_JOURNAL_THRESHOLD, on Flush() and at process exit. Journals of processes on the
+/// same host that have died before folding are folded by the next process opening the database.
+///
+/// One instance exists per database file and process, all methods are thread-safe.
+class MIOPEN_INTERNALS_EXPORT DbJournal
+{
+public:
+    DbJournal(DbKinds db_kind_, const fs::path& db_path_);
+    DbJournal(const DbJournal&) = delete;
+    DbJournal& operator=(const DbJournal&) = delete;
+    ~DbJournal();
+
+    static bool IsEnabled();
+
+    /// Returns the journal of the database file or nullptr if journaling is disabled.
+    static DbJournal* Get(DbKinds db_kind, const fs::path& db_path);
+
+    void Store(const DbRecord& record);
+    void Update(const DbRecord& record);
+    void Remove(const std::string& key);
+
+    /// Applies pending changes of the key on top of the record read from the database.
+    boost::optional<DbRecord> Apply(const std::string& key,
+                                    boost::optional<DbRecord> record) const;
+
+    /// Folds pending changes into the database. Returns false if the database was not written.
+    bool Flush();
+
+    std::size_t GetPendingCount() const;
+    const fs::path& GetPath() const { return path; }
+
+private:
+    const DbKinds db_kind;
+    const fs::path db_path;
+    const fs::path path;
+    mutable std::mutex mutex;
+    std::ofstream file;
+    DbJournalEntries pending;
+
+    static bool Read(const fs::path& journal_path, DbJournalEntries& entries);
+
+    void AppendUnsafe(char op, const DbRecord& record);
+    void FlushIfNeededUnsafe();
+    bool FlushUnsafe();
+    void RecoverOrphans();
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DB_JOURNAL_HPP_
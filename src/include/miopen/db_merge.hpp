@@ -0,0 +1,89 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DB_MERGE_HPP_
+#define GUARD_MIOPEN_DB_MERGE_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/db_record.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <cstddef>
+#include <iosfwd>
+#include <vector>
+
+namespace miopen {
+
+struct DbMergeOptions
+{
+    DbKinds kind = DbKinds::PerfDb;
+    /// Find-db inputs are text files. Perf-db inputs are text files, or SQLite databases if their
+    /// extension is .db or .udb. Kernel db inputs are SQLite .kdb or .ukdb files. All the inputs
+    /// must be in the format of the output.
+    ///
+    /// Of the entries with the same key and id, find-db keeps the one with the best time. Perf-db
+    /// and kernel db entries have no time, so the one of the last input wins, e.g. list the
+    /// curated system db first and the user dbs of the nodes after it.
+    std::vector<fs::path> inputs;
+    /// Replaced with the merged database.
+    fs::path output;
+    /// Drop the find-db and perf-db entries whose id is not a registered solver.
+    bool validate_solvers = true;
+    /// Drop the kernels whose program is not one of the kernel sources of this build.
+    bool drop_orphaned_kernels = true;
+    /// Number of inputs read in parallel, 0 for one per hardware thread.
+    std::size_t jobs = 0;
+};
+
+struct DbMergeStats
+{
+    std::size_t inputs = 0;
+    /// Inputs that could not be opened or have an unexpected format, see the log for the reason.
+    std::size_t unreadable_inputs = 0;
+    /// Records that could not be parsed.
+    std::size_t ill_formed = 0;
+    /// Entries, i.e. the id and values under a key, or kernels.
+    std::size_t read = 0;
+    /// Entries read from more than one input with the same values.
+    std::size_t duplicates = 0;
+    /// Entries read from more than one input with different values.
+    std::size_t conflicts = 0;
+    std::size_t unknown_solvers = 0;
+    std::size_t orphaned_kernels = 0;
+    /// Keys, or kernels, written.
+    std::size_t records = 0;
+    std::size_t written = 0;
+};
+
+/// Reads the inputs in parallel and writes their union to options.output, sorted by the key and
+/// the id. Text databases are written one record per key. SQLite databases get the schema of
+/// the first input, their rows are inserted in key order.
+MIOPEN_INTERNALS_EXPORT DbMergeStats MergeDbs(const DbMergeOptions& options);
+
+MIOPEN_INTERNALS_EXPORT std::ostream& operator<<(std::ostream& os, const DbMergeStats& stats);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DB_MERGE_HPP_
@@ -0,0 +1,44 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DB_PREFETCH_HPP_
+#define GUARD_MIOPEN_DB_PREFETCH_HPP_
+
+#include <miopen/config.hpp>
+
+namespace miopen {
+
+struct Handle;
+
+/// When MIOPEN_DB_PREFETCH is enabled, starts loading the installed find-db, perf-db and
+/// kernel-db of the handle's device on background threads, so that the first find or immediate
+/// mode call doesn't pay for parsing them. The paths are resolved on the calling thread, the
+/// handle is not used after the function returns. Databases already loaded or being loaded are
+/// skipped, so this is cheap to call for every new handle.
+MIOPEN_INTERNALS_EXPORT void PrefetchSystemDbs(Handle& handle);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DB_PREFETCH_HPP_
@@ -280,6 +280,8 @@ public:
     }
 
     friend class PlainTextDb;
+    friend class BinaryDbRecord;
+    friend class DbJournal;
     friend class SQLitePerfDb;
     friend class ReadonlyRamDb;
     friend class RamDb;
@@ -0,0 +1,181 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_DB_TEXT_PARSER_HPP_
+#define GUARD_MIOPEN_DB_TEXT_PARSER_HPP_
+
+#include <miopen/filesystem.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+/// Number of chunks to parse a text database of the given size in: one per hardware thread, but
+/// each at least min_chunk_size bytes long.
+inline std::size_t GetTextDbChunkCount(std::size_t size, std::size_t min_chunk_size = 1 << 20)
+{
+    const auto max_chunks = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    return std::clamp<std::size_t>(size / min_chunk_size, 1, max_chunks);
+}
+
+/// Splits the contents of a text database into at most n_chunks pieces of about equal size.
+/// Chunks end right after a newline, so no line is split.
+inline std::vector<std::string_view> SplitTextDb(std::string_view text, std::size_t n_chunks)
+{
+    auto chunks = std::vector<std::string_view>{};
+    chunks.reserve(n_chunks);
+
+    auto begin = std::size_t{0};
+    for(auto i = std::size_t{1}; i <= n_chunks && begin < text.size(); ++i)
+    {
+        auto end = text.size();
+        if(i < n_chunks)
+        {
+            end = text.find('\n', std::max(begin, text.size() / n_chunks * i));
+            end = end == std::string_view::npos ? text.size() : end + 1;
+        }
+        chunks.push_back(text.substr(begin, end - begin));
+        begin = end;
+    }
+    return chunks;
+}
+
+namespace detail {
+
+template <class TCache>
+struct TextDbChunk
+{
+    TCache cache;
+    int lines = 0;
+    std::vector<int> ill_formed_lines;
+};
+
+template <class TCache, class = void>
+struct HasReserve : std::false_type
+{
+};
+
+template <class TCache>
+struct HasReserve<TCache, std::void_t<decltype(std::declval<TCache&>().reserve(0))>>
+    : std::true_type
+{
+};
+
+template <class TCache>
+void ParseTextDbChunk(std::string_view text, TextDbChunk<TCache>& chunk)
+{
+    // Saves rehashing hash maps while they grow.
+    if constexpr(HasReserve<TCache>{})
+        chunk.cache.reserve(std::count(text.begin(), text.end(), '\n') + 1);
+
+    auto begin = std::size_t{0};
+    while(begin < text.size())
+    {
+        auto end = text.find('\n', begin);
+        if(end == std::string_view::npos)
+            end = text.size();
+
+        const auto line = text.substr(begin, end - begin);
+        begin           = end + 1;
+        ++chunk.lines;
+
+        if(line.empty())
+            continue;
+
+        const auto key_size = line.find('=');
+        if(key_size == std::string_view::npos || key_size == 0)
+        {
+            chunk.ill_formed_lines.push_back(chunk.lines);
+            continue;
+        }
+
+        // Like the rest of the parsing, emplace keeps the first of duplicate keys.
+        chunk.cache.emplace(std::string{line.substr(0, key_size)},
+                            typename TCache::mapped_type{chunk.lines,
+                                                         std::string{line.substr(key_size + 1)}});
+    }
+}
+
+} // namespace detail
+
+/// Parses the "key=contents" lines of a text database into cache, whose items are constructed
+/// from the line number and the contents. Big inputs are parsed in parallel chunks that are
+/// merged in file order, so the result and the line numbers are the same as of a sequential
+/// parse. Records already in cache and the first of duplicate keys are kept. Zero n_chunks picks
+/// the count with GetTextDbChunkCount().
+template <class TCache>
+void ParseTextDb(std::string_view text,
+                 const fs::path& path,
+                 TCache& cache,
+                 std::size_t n_chunks = 0)
+{
+    const auto texts =
+        SplitTextDb(text, n_chunks != 0 ? n_chunks : GetTextDbChunkCount(text.size()));
+    auto chunks      = std::vector<detail::TextDbChunk<TCache>>(texts.size());
+
+    par_for_impl(texts.size(), texts.size(), [&](std::size_t i) {
+        detail::ParseTextDbChunk(texts[i], chunks[i]);
+    });
+
+    if constexpr(detail::HasReserve<TCache>{})
+    {
+        auto records = cache.size();
+        for(const auto& chunk : chunks)
+            records += chunk.cache.size();
+        cache.reserve(records);
+    }
+
+    auto first_line = 0;
+    for(auto& chunk : chunks)
+    {
+        for(const auto line : chunk.ill_formed_lines)
+            MIOPEN_LOG_E("Ill-formed record: key not found: " << path << "#" << first_line + line);
+
+        if(first_line != 0)
+        {
+            for(auto& item : chunk.cache)
+                item.second.line += first_line;
+        }
+
+        // Moves the nodes without copying the strings again.
+        if(cache.empty())
+            cache.swap(chunk.cache);
+        else
+            cache.merge(chunk.cache);
+        first_line += chunk.lines;
+    }
+}
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_DB_TEXT_PARSER_HPP_
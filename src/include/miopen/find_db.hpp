@@ -32,6 +32,7 @@
 #include <miopen/db_path.hpp>
 #include <miopen/db_record.hpp>
 #include <miopen/env.hpp>
+#include <miopen/lookup_counters.hpp>
 #include <miopen/perf_field.hpp>
 #include <miopen/ramdb.hpp>
 #include <miopen/readonlyramdb.hpp>
@@ -101,7 +102,7 @@ public:
                              : GetInstalledPath(handle, path_suffix)),
           db(boost::make_optional<DbTimer<TDb>>(
               debug::testing_find_db_enabled && !env::enabled(MIOPEN_DEBUG_DISABLE_FIND_DB),
-              DbTimer<TDb>{DbKinds::FindDb, installed_path, path}))
+              DbTimer<TDb>{GetLookupCounters(handle), DbKinds::FindDb, installed_path, path}))
     {
         if(!db.is_initialized())
             return;
@@ -120,9 +121,9 @@ public:
 #if MIOPEN_DISABLE_USERDB
           db(boost::optional<DbTimer<TDb>>{DbKinds::FindDb})
 #else
-          db(boost::make_optional<DbTimer<TDb>>(debug::testing_find_db_enabled &&
-                                                    !env::enabled(MIOPEN_DEBUG_DISABLE_FIND_DB),
-                                                DbTimer<TDb>{DbKinds::FindDb, path, false}))
+          db(boost::make_optional<DbTimer<TDb>>(
+              debug::testing_find_db_enabled && !env::enabled(MIOPEN_DEBUG_DISABLE_FIND_DB),
+              DbTimer<TDb>{GetLookupCounters(handle), DbKinds::FindDb, path, false}))
 #endif
     {
         if(!db.is_initialized())
@@ -146,6 +147,8 @@ public:
     auto end() { return content->As<FindDbData>().end(); }
     bool empty() const { return !content.is_initialized(); }
 
+    static fs::path GetInstalledPath(Handle& handle, const std::string& path_suffix);
+
     template <class TProblemDescription>
     static std::vector<Solution> TryLoad(Handle& handle,
                                          const TProblemDescription& problem,
@@ -192,7 +195,6 @@ private:
     bool in_sync    = false;
     bool dont_store = false; // E.g. to skip writing sub-optimal find-db records to disk.
 
-    static fs::path GetInstalledPath(Handle& handle, const std::string& path_suffix);
     static fs::path GetInstalledPathEmbed(Handle& handle, const std::string& path_suffix);
     static fs::path GetInstalledPathFile(Handle& handle, const std::string& path_suffix);
     static fs::path GetUserPath(Handle& handle, const std::string& path_suffix);
@@ -31,6 +31,7 @@
 #include <miopen/env.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/conv_solution.hpp>
+#include <miopen/conv/problem_features.hpp>
 #include <miopen/execution_context.hpp>
 #include <miopen/find_controls.hpp>
 #include <miopen/handle.hpp>
@@ -50,6 +51,14 @@ struct AnyInvokeParams;
 
 namespace solver {
 
+/// Problems of primitives which do not define any features are never rejected by the
+/// pre-filter. Convolution problems use the overload from conv/problem_features.hpp.
+template <class Context, class Problem>
+std::uint64_t GetProblemFeatures(const Context&, const Problem&)
+{
+    return 0;
+}
+
 template <class Solver, class Context, class Problem, class Db>
 auto FindSolutionImpl(rank<1>,
                       Solver s,
@@ -283,6 +292,7 @@ struct SolverContainer
         std::vector<Solution> ss;
         std::size_t count    = 0;
         const auto find_only = GetEnvFindOnlySolver();
+        const auto features  = GetProblemFeatures(ctx, problem);
         miopen::each_args(
             [&](auto solver) {
                 if(count >= limit)
@@ -298,6 +308,10 @@ struct SolverContainer
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
                 }
+                else if(!miopen::conv::IsFeatureMatch(features, solver.GetFeatureMask()))
+                {
+                    MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable (features)");
+                }
                 else if(!solver.IsApplicable(ctx, problem))
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
@@ -340,6 +354,7 @@ struct SolverContainer
         std::vector<Solution> ss;
         std::size_t count    = 0;
         const auto find_only = GetEnvFindOnlySolver();
+        const auto features  = GetProblemFeatures(ctx, problem);
         miopen::each_args(
             [&](auto solver) {
                 if(count >= limit)
@@ -353,6 +368,10 @@ struct SolverContainer
                 // it is much faster than IsApplicable().
                 // else if(problem.use_dynamic_solutions_only && !solver.IsDynamic())
                 //    MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
+                else if(!miopen::conv::IsFeatureMatch(features, solver.GetFeatureMask()))
+                {
+                    MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable (features)");
+                }
                 else if(!solver.IsApplicable(ctx, problem))
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
@@ -400,6 +419,7 @@ struct SolverContainer
     {
         std::vector<std::pair<std::string, size_t>> res;
         const auto find_only = GetEnvFindOnlySolver();
+        const auto features  = GetProblemFeatures(ctx, problem);
         miopen::each_args(
             [&](auto solver) {
                 if(find_only &&
@@ -423,6 +443,10 @@ struct SolverContainer
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Skipped (non-dynamic)");
                 }
+                else if(!miopen::conv::IsFeatureMatch(features, solver.GetFeatureMask()))
+                {
+                    MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable (features)");
+                }
                 else if(!solver.IsApplicable(ctx, problem))
                 {
                     MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable");
@@ -443,6 +467,7 @@ struct SolverContainer
     bool IsAnySolverApplicable(const Context& ctx, const Problem& problem) const
     {
         const auto find_only = GetEnvFindOnlySolver();
+        const auto features  = GetProblemFeatures(ctx, problem);
         auto found           = false;
 
         miopen::each_args(
@@ -460,6 +485,12 @@ struct SolverContainer
                     return;
                 }
 
+                if(!miopen::conv::IsFeatureMatch(features, solver.GetFeatureMask()))
+                {
+                    MIOPEN_LOG_I2(solver.SolverDbId() << ": Not applicable (features)");
+                    return;
+                }
+
                 if(solver.IsApplicable(ctx, problem))
                 {
                     found = true;
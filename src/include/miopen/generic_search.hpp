@@ -37,7 +37,9 @@
 #include <miopen/logger.hpp>
 #include <miopen/timer.hpp>
 #include <miopen/mt_queue.hpp>
+#include <miopen/perf_config_catalog.hpp>
 #include <miopen/generic_search_controls.hpp>
+#include <miopen/tuning_queue.hpp>
 
 #include <algorithm>
 #include <vector>
@@ -46,7 +48,10 @@
 #include <iterator>
 #include <chrono>
 #include <cassert>
+#include <optional>
 #include <random>
+#include <sstream>
+#include <string>
 
 namespace miopen {
 namespace solver {
@@ -262,24 +267,84 @@ public:
 /// ------------------------------------------------
 /// clang-format-on
 
+/// Identifies the (solver, problem class) pair, i.e. everything the set of valid perf configs
+/// depends on: the solver, the device and the network config of the problem.
+template <class Solver, class Context, class Problem>
+std::string GetSearchKey(const Solver& s, const Context& context, const Problem& problem)
+{
+    return s.SolverDbId() + ' ' + context.GetStream().GetDbBasename() + ' ' +
+           problem.MakeNetworkConfig().ToString();
+}
+
+template <class PerformanceConfig>
+std::string SerializeConfig(const PerformanceConfig& config)
+{
+    std::ostringstream ss;
+    config.Serialize(ss);
+    return ss.str();
+}
+
+/// Returns the valid configs of the main set, or of the spare one if the former is empty.
+/// The enumeration is done once per (solver, problem class) and kept in the perf config
+/// catalog, other calls and later runs only deserialize the configs.
 template <class Solver, class Context, class Problem>
 auto GetAllConfigs(const Solver s, const Context& context, const Problem& problem)
-    -> ComputedContainer<decltype(s.GetDefaultPerformanceConfig(context, problem)),
-                         Context,
-                         Problem>
+    -> std::vector<decltype(s.GetDefaultPerformanceConfig(context, problem))>
 {
     using PerformanceConfig = decltype(s.GetDefaultPerformanceConfig(context, problem));
 
-    const ComputedContainer<PerformanceConfig, Context, Problem> primary(context, problem);
-    const int primary_size = std::distance(primary.begin(), primary.end());
-    const ComputedContainer<PerformanceConfig, Context, Problem> spare(context, problem, true);
-    const int spare_size = std::distance(spare.begin(), spare.end());
-    const bool useSpare  = (primary_size == 0);
+    auto* const catalog = GetPerfConfigCatalog();
+    const auto key      = GetSearchKey(s, context, problem);
+    const auto entry    = catalog != nullptr ? catalog->Find(key) : nullptr;
+
+    std::vector<PerformanceConfig> all_configs;
+    bool spare    = false;
+    bool is_found = entry != nullptr;
+
+    if(is_found)
+    {
+        spare = entry->IsSpare();
+        all_configs.reserve(entry->Configs().size());
+        for(const auto& serialized : entry->Configs())
+        {
+            PerformanceConfig config;
+            if(!config.Deserialize(serialized))
+            {
+                MIOPEN_LOG_W("Perf config catalog of " << key << " is obsolete: " << serialized);
+                catalog->Remove(key);
+                all_configs.clear();
+                is_found = false;
+                break;
+            }
+            all_configs.emplace_back(std::move(config));
+        }
+    }
+
+    if(!is_found)
+    {
+        // The spare set is only enumerated if the main one is empty.
+        const ComputedContainer<PerformanceConfig, Context, Problem> primary(context, problem);
+        all_configs.assign(primary.begin(), primary.end());
+        spare = all_configs.empty();
+        if(spare)
+        {
+            const ComputedContainer<PerformanceConfig, Context, Problem> spare_configs(
+                context, problem, true);
+            all_configs.assign(spare_configs.begin(), spare_configs.end());
+        }
+
+        if(catalog != nullptr)
+        {
+            std::vector<std::string> serialized;
+            serialized.reserve(all_configs.size());
+            for(const auto& config : all_configs)
+                serialized.emplace_back(SerializeConfig(config));
+            catalog->Store(key, {spare, std::move(serialized)});
+        }
+    }
 
-    ComputedContainer<PerformanceConfig, Context, Problem> all_configs = useSpare ? spare : primary;
-    const int n_runs_total = useSpare ? spare_size : primary_size;
-    MIOPEN_LOG_W(s.SolverDbId() << ": Searching the best solution among " << n_runs_total
-                                << (useSpare ? " (spare)" : "") << "...");
+    MIOPEN_LOG_W(s.SolverDbId() << ": Searching the best solution among " << all_configs.size()
+                                << (spare ? " (spare)" : "") << "...");
 
     return all_configs;
 }
@@ -306,6 +371,18 @@ std::size_t GetTuningIterationsMax();
 std::chrono::milliseconds GetTuningTimeMax(); // returns the max allowed time in milliseconds
 std::size_t GetTuningThreadsMax();
 
+/// Set with MIOPEN_TUNING_QUEUE_ROLE when MIOPEN_TUNING_QUEUE is used.
+enum class TuningRole
+{
+    Coordinator, // Only enqueues the units
+    Worker,      // Enqueues the units unless done by the coordinator, then processes them
+    Merge,       // Returns the best config found by the workers
+};
+
+TuningRole GetTuningRole();
+std::optional<TuningQueue> GetTuningQueue();
+std::size_t GetTuningUnitSize();
+
 template <typename PerformanceConfig, typename Solver, typename Context, typename Problem>
 void CompileAgent(size_t thread_index,
                   size_t total_threads,
@@ -348,60 +425,30 @@ void CompileAgent(size_t thread_index,
     MIOPEN_LOG_I2("Thread: " << thread_index << " Done, completed tuning");
 }
 
-template <class Solver, class Context, class Problem>
-auto GenericSearch(const Solver s,
-                   const Context& context_,
-                   const Problem& problem,
-                   const AnyInvokeParams& invoke_ctx_)
-    -> decltype(s.GetDefaultPerformanceConfig(context_, problem))
+template <class PerformanceConfig>
+struct BenchmarkResult
 {
-    auto context                  = context_;
-    context.is_for_generic_search = true;
-
-    using PerformanceConfig = decltype(s.GetDefaultPerformanceConfig(context, problem));
-    PerformanceConfig best_config;
-    const auto default_solution =
-        s.GetSolution(context, problem, s.GetDefaultPerformanceConfig(context, problem));
-    const auto invoke_ctx = [invoke_ctx_]() {
-        auto copy = invoke_ctx_;
-        copy.SetInvokeType(InvokeType::AutoTune);
-        return copy;
-    }();
-
-    auto& profile_h = context.GetStream();
-    const AutoEnableProfiling enableProfiling{profile_h};
-
-    auto tmp_all_configs = GetAllConfigs(s, context, problem);
-    // For random access
-    std::vector<PerformanceConfig> all_configs;
-    std::copy(tmp_all_configs.begin(), tmp_all_configs.end(), std::back_inserter(all_configs));
-    // shuffle the configs
-    std::random_device rd{};
-    auto rng = std::default_random_engine{rd()};
-    std::shuffle(all_configs.begin(), all_configs.end(), rng);
-    std::size_t n_runs_total = std::min(all_configs.size(), GetTuningIterationsMax());
-    all_configs.resize(n_runs_total);
-    std::size_t patience = env::value(MIOPEN_TUNING_PATIENCE);
-
-    if(all_configs.empty())
-    {
-        const auto default_config = s.GetDefaultPerformanceConfig(context, problem);
+    PerformanceConfig config;
+    float time     = std::numeric_limits<float>::max();
+    bool is_passed = false; // left false only if all iterations failed.
+};
 
-        if(default_config.IsValid(context, problem))
-        {
-            all_configs.emplace_back(default_config);
-            n_runs_total += 1;
-        }
-        else
-        {
-            const auto id = s.SolverDbId();
-            MIOPEN_THROW("Generic search has failed. Solver " + id +
-                         " cannot produce any valid configuration.");
-        }
-    }
+/// Compiles `all_configs` in GetTuningThreadsMax() threads and benchmarks them as soon as
+/// they are built. Only compiles them if `compile_only` is set.
+template <class Solver, class Context, class Problem, class PerformanceConfig>
+BenchmarkResult<PerformanceConfig> BenchmarkConfigs(const Solver& s,
+                                                    const Context& context,
+                                                    const Problem& problem,
+                                                    const AnyInvokeParams& invoke_ctx,
+                                                    const ConvSolution& default_solution,
+                                                    std::vector<PerformanceConfig>& all_configs,
+                                                    bool compile_only)
+{
+    auto& profile_h                = context.GetStream();
+    const std::size_t n_runs_total = all_configs.size();
+    const std::size_t patience     = env::value(MIOPEN_TUNING_PATIENCE);
 
-    bool is_passed  = false; // left false only if all iterations failed.
-    float best_time = std::numeric_limits<float>::max();
+    BenchmarkResult<PerformanceConfig> result;
     size_t n_failed = 0;
     size_t n_best   = 0;
     HeartBeat<PerformanceConfig> heartbeat;
@@ -424,7 +471,7 @@ auto GenericSearch(const Solver s,
                                     std::ref(solution_queue));
     }
 
-    if(!env::enabled(MIOPEN_DEBUG_COMPILE_ONLY))
+    if(!compile_only)
     {
         size_t n_current       = 0;
         size_t last_imprv      = 0;
@@ -498,7 +545,7 @@ auto GenericSearch(const Solver s,
             MIOPEN_LOG_T("##"
                          << "(n_current, n_failed, n_runs_total):  " << n_current << '/' << n_failed
                          << '/' << n_runs_total << " elapsed_time: " << elapsed_time
-                         << ", best_time: " << best_time << ", " << current_config);
+                         << ", best_time: " << result.time << ", " << current_config);
 
             if(ret == 0)
             {
@@ -507,10 +554,10 @@ auto GenericSearch(const Solver s,
                 // then re-run it 9 times more and compute average time,
                 // and decide using average of all 10 attempts vs. the best.
                 constexpr int N_RUNS = 10;
-                if(elapsed_time / best_time < 1.10f)
+                if(elapsed_time / result.time < 1.10f)
                 {
-                    MIOPEN_LOG_I2("Finding average for: " << elapsed_time << " / " << best_time
-                                                          << " = " << (elapsed_time / best_time));
+                    MIOPEN_LOG_I2("Finding average for: " << elapsed_time << " / " << result.time
+                                                          << " = " << (elapsed_time / result.time));
 
                     try
                     {
@@ -527,22 +574,22 @@ auto GenericSearch(const Solver s,
 
                     if(ret == 0)
                     {
-                        is_passed = true;
+                        result.is_passed = true;
                         elapsed_time /= N_RUNS;
-                        if(elapsed_time < best_time)
+                        if(elapsed_time < result.time)
                         {
                             MIOPEN_LOG_I('#' << n_current << '/' << n_failed << '/' << n_runs_total
-                                             << ' ' << elapsed_time << " < " << best_time << ' '
+                                             << ' ' << elapsed_time << " < " << result.time << ' '
                                              << current_config);
-                            best_config = current_config;
-                            best_time   = elapsed_time;
-                            n_best      = n_current;
-                            last_imprv  = 0;
+                            result.config = current_config;
+                            result.time   = elapsed_time;
+                            n_best        = n_current;
+                            last_imprv    = 0;
                         }
                         else
                         {
                             MIOPEN_LOG_I2("Average is not better: " << elapsed_time
-                                                                    << " >= " << best_time);
+                                                                    << " >= " << result.time);
                         }
                     }
                 }
@@ -563,26 +610,198 @@ auto GenericSearch(const Solver s,
             heartbeat.Monitor(ret != 0,
                               elapsed_time,
                               n_current,
-                              best_time,
+                              result.time,
                               n_failed,
                               n_runs_total,
                               current_config);
             ++n_current;
         }
     }
-    else
+
+    for(auto& agent : compile_agents)
+        agent.join();
+
+    if(!compile_only)
+    {
+        MIOPEN_LOG_W("Done: " << n_runs_total << '/' << n_failed << '/' << n_runs_total
+                              << ", best #" << n_best << ' ' << result.time << ' '
+                              << result.config);
+    }
+
+    return result;
+}
+
+/// Shuffles the configs and keeps at most GetTuningIterationsMax() of them.
+template <class Solver, class Context, class Problem>
+auto GetSearchConfigs(const Solver& s, const Context& context, const Problem& problem)
+    -> std::vector<decltype(s.GetDefaultPerformanceConfig(context, problem))>
+{
+    auto all_configs = GetAllConfigs(s, context, problem);
+    // shuffle the configs
+    std::random_device rd{};
+    auto rng = std::default_random_engine{rd()};
+    std::shuffle(all_configs.begin(), all_configs.end(), rng);
+    all_configs.resize(std::min(all_configs.size(), GetTuningIterationsMax()));
+
+    if(all_configs.empty())
+    {
+        const auto default_config = s.GetDefaultPerformanceConfig(context, problem);
+
+        if(default_config.IsValid(context, problem))
+        {
+            all_configs.emplace_back(default_config);
+        }
+        else
+        {
+            const auto id = s.SolverDbId();
+            MIOPEN_THROW("Generic search has failed. Solver " + id +
+                         " cannot produce any valid configuration.");
+        }
+    }
+
+    return all_configs;
+}
+
+/// Implements the MIOPEN_TUNING_QUEUE mode of GenericSearch. The coordinator splits the configs
+/// into units, workers benchmark (or only compile) the units they claim, and the merge step
+/// returns the best config found by all workers, so that only it is written to the perf-db.
+template <class Solver, class Context, class Problem>
+auto QueuedSearch(const Solver& s,
+                  const Context& context,
+                  const Problem& problem,
+                  const AnyInvokeParams& invoke_ctx,
+                  const ConvSolution& default_solution,
+                  TuningQueue& queue)
+    -> decltype(s.GetDefaultPerformanceConfig(context, problem))
+{
+    using PerformanceConfig = decltype(s.GetDefaultPerformanceConfig(context, problem));
+
+    const auto role = GetTuningRole();
+    const auto key  = GetSearchKey(s, context, problem);
+
+    if(role == TuningRole::Merge)
+    {
+        const auto unit = queue.Best(key);
+        if(!unit)
+            MIOPEN_THROW("No tuning results for " + key + " in " + queue.Path());
+
+        const auto n_done = queue.Count(key, TuningUnitState::Done);
+        const auto n_all  = queue.Count(key);
+        if(n_done != n_all)
+            MIOPEN_LOG_W(key << ": " << n_all - n_done << " of " << n_all
+                             << " tuning units are not done");
+
+        PerformanceConfig config;
+        if(!config.Deserialize(unit->best) || !config.IsValid(context, problem))
+            MIOPEN_THROW("Invalid tuning result for " + key + ": " + unit->best);
+
+        MIOPEN_LOG_W("Merged: " << key << ", best " << unit->time << ' ' << config);
+        return config;
+    }
+
+    if(queue.Count(key) == 0)
+    {
+        std::vector<std::string> configs;
+        for(const auto& config : GetSearchConfigs(s, context, problem))
+            configs.emplace_back(SerializeConfig(config));
+        queue.Enqueue(key, configs, GetTuningUnitSize());
+    }
+
+    if(role == TuningRole::Coordinator)
     {
         MIOPEN_THROW(miopenStatusGpuOperationsSkipped,
-                     "Running kernels on GPU is disabled. Search skipped");
+                     "Tuning units of " + key + " are in " + queue.Path() + ". Search skipped.");
     }
 
-    for(auto& agent : compile_agents)
-        agent.join();
+    const auto compile_only = env::enabled(MIOPEN_DEBUG_COMPILE_ONLY);
+    std::size_t n_units     = 0;
+
+    while(auto unit = queue.Claim(key, compile_only))
+    {
+        MIOPEN_LOG_I(key << ": tuning unit #" << unit->chunk << ", " << unit->configs.size()
+                         << " configs");
+
+        std::vector<PerformanceConfig> configs;
+        for(const auto& serialized : unit->configs)
+        {
+            PerformanceConfig config;
+            if(config.Deserialize(serialized) && config.IsValid(context, problem))
+                configs.emplace_back(std::move(config));
+            else
+                MIOPEN_LOG_W("Invalid config in tuning unit: " << serialized);
+        }
 
-    MIOPEN_LOG_W("Done: " << n_runs_total << '/' << n_failed << '/' << n_runs_total << ", best #"
-                          << n_best << ' ' << best_time << ' ' << best_config);
+        try
+        {
+            const auto result = BenchmarkConfigs(
+                s, context, problem, invoke_ctx, default_solution, configs, compile_only);
+            if(compile_only)
+            {
+                unit->state = TuningUnitState::Compiled;
+            }
+            else
+            {
+                unit->state = TuningUnitState::Done;
+                if(result.is_passed)
+                {
+                    unit->time = result.time;
+                    unit->best = SerializeConfig(result.config);
+                }
+            }
+        }
+        catch(const std::exception& ex)
+        {
+            // Do not let other workers retry a unit which is likely to fail for them as well.
+            MIOPEN_LOG_E(key << ": tuning unit #" << unit->chunk << " failed: " << ex.what());
+            unit->state = TuningUnitState::Done;
+        }
+
+        queue.Complete(*unit);
+        ++n_units;
+    }
+
+    MIOPEN_THROW(miopenStatusGpuOperationsSkipped,
+                 std::to_string(n_units) + " tuning units of " + key +
+                     " processed. Results are written to the perf-db by the merge step.");
+}
+
+template <class Solver, class Context, class Problem>
+auto GenericSearch(const Solver s,
+                   const Context& context_,
+                   const Problem& problem,
+                   const AnyInvokeParams& invoke_ctx_)
+    -> decltype(s.GetDefaultPerformanceConfig(context_, problem))
+{
+    auto context                  = context_;
+    context.is_for_generic_search = true;
+
+    const auto default_solution =
+        s.GetSolution(context, problem, s.GetDefaultPerformanceConfig(context, problem));
+    const auto invoke_ctx = [invoke_ctx_]() {
+        auto copy = invoke_ctx_;
+        copy.SetInvokeType(InvokeType::AutoTune);
+        return copy;
+    }();
+
+    auto& profile_h = context.GetStream();
+    const AutoEnableProfiling enableProfiling{profile_h};
+
+    if(auto queue = GetTuningQueue())
+        return QueuedSearch(s, context, problem, invoke_ctx, default_solution, *queue);
+
+    auto all_configs = GetSearchConfigs(s, context, problem);
+
+    const auto compile_only = env::enabled(MIOPEN_DEBUG_COMPILE_ONLY);
+    const auto result       = BenchmarkConfigs(
+        s, context, problem, invoke_ctx, default_solution, all_configs, compile_only);
+
+    if(compile_only)
+    {
+        MIOPEN_THROW(miopenStatusGpuOperationsSkipped,
+                     "Running kernels on GPU is disabled. Search skipped");
+    }
 
-    if(!is_passed)
+    if(!result.is_passed)
         MIOPEN_THROW("Search failed");
     // Run once with the default config and show score.
 
@@ -590,10 +809,10 @@ auto GenericSearch(const Solver s,
                                                    default_solution.construction_params);
     invoker(profile_h, invoke_ctx);
     const auto default_time = profile_h.GetKernelTime();
-    const auto score        = (best_time > 0.0f) ? default_time / best_time : 0.0f;
+    const auto score        = (result.time > 0.0f) ? default_time / result.time : 0.0f;
     MIOPEN_LOG_W("...Score: " << score << " (default time " << default_time << ')');
 
-    return best_config;
+    return result.config;
 }
 
 } // namespace solver
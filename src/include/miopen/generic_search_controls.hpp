@@ -46,3 +46,7 @@ MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_COMPILE_PARALLEL_LEVEL,
                               std::thread::hardware_concurrency() / 2)
 #endif
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_COMPILE_ONLY)
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_TUNING_QUEUE)
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_TUNING_QUEUE_ROLE)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_UNIT_SIZE, 32)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_TUNING_UNIT_TIMEOUT, 3600)
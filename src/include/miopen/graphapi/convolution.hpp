@@ -28,6 +28,7 @@
 #include <miopen/graphapi/graphapi.hpp>
 #include <miopen/graphapi/opgraph.hpp>
 #include <miopen/graphapi/tensor.hpp>
+#include <miopen/logger.hpp>
 
 #include <cstdint>
 
@@ -276,6 +277,16 @@ public:
     Tensor* getW() const noexcept { return mW; }
     double getAlpha() const noexcept { return mAlpha; }
     double getBeta() const noexcept { return mBeta; }
+
+    virtual void serializeAttributes(std::ostream& stream) const override
+    {
+        stream << mConvolution->getCompType() << ',' << mConvolution->getMode() << ','
+               << mConvolution->getSpatialDims() << ",[";
+        LogRange(stream, mConvolution->getPrePaddings(), ",") << "],[";
+        LogRange(stream, mConvolution->getPostPaddings(), ",") << "],[";
+        LogRange(stream, mConvolution->getFilterStrides(), ",") << "],[";
+        LogRange(stream, mConvolution->getDilations(), ",") << "]," << mAlpha << ',' << mBeta;
+    }
 };
 
 class OperationConvolutionForward : public OperationConvolution
@@ -82,6 +82,9 @@ class MIOPEN_INTERNALS_EXPORT GraphPatternExecutor
 public:
     virtual void execute(miopenHandle_t handle, const VariantPack& vpk) = 0;
     virtual size_t getWorkspaceSize() const                             = 0;
+    /// True if the executor keeps no pointers into the graph it was created
+    /// for, so it may serve any graph with the same signature (see EngineCache)
+    virtual bool isReusable() const { return false; }
     virtual ~GraphPatternExecutor();
 };
 
@@ -101,6 +104,9 @@ public:
 
     size_t getWorkspaceSize() const final;
 
+    // Only the tensor ids and enum ids of mTensorInfoMap are used in execute()
+    bool isReusable() const final { return true; }
+
     static std::unique_ptr<GraphPatternExecutor> make(miopenSolution_t sol,
                                                       const std::shared_ptr<TensorInfoMap>& tmap)
     {
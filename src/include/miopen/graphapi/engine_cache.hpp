@@ -0,0 +1,88 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#pragma once
+
+#include <miopen/graphapi/engine.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+namespace graphapi {
+
+/// Process-wide cache of the engines found for an operation graph.
+///
+/// Frameworks with dynamic graphs rebuild the very same operation graph on
+/// every step. Without the cache each rebuild runs pattern matching and
+/// Find 2.0 from scratch. The key is OpGraph::getSignature() prefixed with the
+/// device the graph was built for, so a repeated finalize costs one pass over
+/// the graph plus a hash lookup.
+///
+/// Only engines whose executors are reusable (see
+/// GraphPatternExecutor::isReusable()) are stored, the rest are found anew for
+/// each graph.
+class MIOPEN_INTERNALS_EXPORT EngineCache
+{
+public:
+    static EngineCache& instance();
+
+    static std::string makeKey(const OpGraph& graph);
+
+    /// Returns the cached engines rebound to graph, or nullopt on a miss
+    std::optional<std::vector<Engine>> find(const std::string& key, OpGraph* graph);
+
+    /// Returns false if the engines were not stored because some executor
+    /// is not reusable
+    bool store(const std::string& key, const std::vector<Engine>& engines);
+
+    void clear();
+
+    std::size_t size() const;
+    std::size_t getHits() const noexcept { return mHits.load(std::memory_order_relaxed); }
+    std::size_t getMisses() const noexcept { return mMisses.load(std::memory_order_relaxed); }
+
+private:
+    struct Record
+    {
+        std::shared_ptr<GraphPatternExecutor> mExecutor;
+        int64_t mGlobalIndex = -1;
+        int32_t mSmCount     = 0;
+    };
+
+    mutable std::mutex mMutex;
+    std::unordered_map<std::string, std::vector<Record>> mRecords;
+    std::atomic<std::size_t> mHits{0};
+    std::atomic<std::size_t> mMisses{0};
+};
+
+} // namespace graphapi
+} // namespace miopen
@@ -133,6 +133,13 @@ public:
         static const std::string name = "OP_MATMUL";
         return name;
     }
+    virtual void serializeAttributes(std::ostream& stream) const override
+    {
+        auto overrideId = [](const Tensor* t) { return t != nullptr ? t->getId() : 0; };
+        stream << mMatmul->getComputeType() << ',' << mBatchCount << ','
+               << overrideId(mGemmMOverride) << ',' << overrideId(mGemmNOverride) << ','
+               << overrideId(mGemmKOverride);
+    }
 
 private:
     friend class OperationMatmulBuilder;
@@ -30,6 +30,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -92,6 +93,12 @@ public:
 
     virtual const std::string& signName() const = 0;
 
+    /// Writes the node attributes that are not expressed by signName() and by
+    /// the in/out tensors, e.g. the pointwise mode or the convolution strides.
+    /// Used to build OpGraph::getSignature(), so two nodes that may produce
+    /// different results must never serialize identically.
+    virtual void serializeAttributes(std::ostream& stream) const;
+
 private:
     std::vector<Edge> mInEdges;
     std::vector<Edge> mOutEdges;
@@ -347,6 +354,12 @@ public:
 
     VecOfPaths getAllPaths() const;
 
+    /// Canonical description of the graph: every node with its attributes and
+    /// the ids, types, dims and strides of its tensors. Does not depend on the
+    /// order in which the nodes were added, so two independently built
+    /// identical graphs have the same signature.
+    std::string getSignature() const;
+
     // NOTE: for testing only. May remove in the future
     bool hasEdgeFromSource(OpNode* dst, Tensor* tens_ptr) const
     {
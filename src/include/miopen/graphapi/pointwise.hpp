@@ -250,6 +250,7 @@ public:
     Alpha getAlpha2() const noexcept { return mAlpha2; }
 
     const std::string& signName() const override;
+    void serializeAttributes(std::ostream& stream) const override;
     std::vector<Tensor*> getInTensors() const override;
     std::vector<Tensor*> getOutTensors() const override;
 };
@@ -120,6 +120,7 @@ public:
     Tensor* getY() const noexcept { return mY; }
 
     const std::string& signName() const override;
+    void serializeAttributes(std::ostream& stream) const override;
     std::vector<Tensor*> getInTensors() const override;
     std::vector<Tensor*> getOutTensors() const override;
 };
@@ -31,9 +31,11 @@
 #include <miopen/common.hpp>
 #include <miopen/invoker_cache.hpp>
 #include <miopen/kernel.hpp>
+#include <miopen/lookup_counters.hpp>
 #include <miopen/miopen.h>
 #include <miopen/names.hpp>
 #include <miopen/object.hpp>
+#include <miopen/pending_invokers.hpp>
 #include <miopen/allocator.hpp>
 #include <miopen/simple_hash.hpp>
 #include <miopen/solver_id.hpp>
@@ -42,6 +44,7 @@
 
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <chrono>
 #include <cstdio>
 #include <cstring>
 #include <ios>
@@ -73,6 +76,8 @@ extern "C" hipblasStatus_t hipblasLtDestroy(hipblasLtHandle_t handle);
 namespace miopen {
 
 struct HandleImpl;
+struct LaunchRecording;
+class BufferPool;
 
 #if MIOPEN_USE_ROCBLAS
 using rocblas_handle_ptr = MIOPEN_MANAGE_PTR(rocblas_handle, rocblas_destroy_handle);
@@ -137,6 +142,16 @@ struct MIOPEN_EXPORT Handle : miopenHandle
     }
 
     KernelInvoke Run(Kernel k, bool coop_launch = false) const;
+
+#if MIOPEN_BACKEND_HIP
+    /// Starts recording the kernel launches issued through Run() into a LaunchRecording. The
+    /// (address, size) ranges of the buffers used by the captured calls are the ones rewritten
+    /// on replay. If launch is false the kernels are only recorded.
+    void BeginCapture(std::vector<std::pair<ConstData_t, std::size_t>> buffers,
+                      bool launch = true) const;
+    LaunchRecording EndCapture() const;
+    bool IsCapturing() const;
+#endif
     const std::vector<Kernel>& GetKernelsImpl(const std::string& algorithm,
                                               const std::string& network_config) const;
 
@@ -148,6 +163,9 @@ struct MIOPEN_EXPORT Handle : miopenHandle
     bool HasProgram(const fs::path& program_name, const std::string& params) const;
     void ClearProgram(const fs::path& program_name, const std::string& params) const;
     void AddProgram(Program prog, const fs::path& program_name, const std::string& params) const;
+    /// Handles with the same non-empty scope can use the programs loaded by each other, see
+    /// SharedProgramCache. Empty if the programs of this handle cannot be shared.
+    std::string GetProgramCacheScope() const;
 
     void Finish() const;
     void Flush() const;
@@ -179,6 +197,11 @@ public:
     void Copy(ConstData_t src, Data_t dest, std::size_t size) const;
 
     Allocator::ManageDataPtr Create(std::size_t sz) const;
+    /// Like Create(), but the buffer is taken from and returned to the BufferPool of the handle.
+    Allocator::ManageDataPtr CreateCached(std::size_t sz) const;
+    BufferPool& GetBufferPool() const;
+    /// Lookups done on behalf of this handle. They are counted process-wide as well.
+    LookupCounters& GetLookupCounters() const;
     Allocator::ManageDataPtr&
     WriteTo(const void* data, Allocator::ManageDataPtr& ddata, std::size_t sz) const;
     void ReadTo(void* data, const Allocator::ManageDataPtr& ddata, std::size_t sz) const;
@@ -252,7 +275,12 @@ public:
                          const std::string& solver,
                          const std::optional<AlgorithmName>& algo = std::nullopt)
     {
+        const auto start = std::chrono::steady_clock::now();
         invokers.Register({config, solver}, invoker);
+        RecordLookup(&GetLookupCounters(),
+                     LookupSource::InvokerCache,
+                     LookupEvent::Store,
+                     std::chrono::steady_clock::now() - start);
         if(algo.has_value())
             SetAsFound1_0(config, *algo, solver);
     }
@@ -273,7 +301,10 @@ public:
         {
             MIOPEN_LOG_I2("Returning an invoker for problem " << config.ToString() << " and solver "
                                                               << solver->ToString());
-            return invokers[std::make_pair(config.ToString(), solver->ToString())];
+            const auto start = std::chrono::steady_clock::now();
+            auto invoker     = invokers[std::make_pair(config.ToString(), solver->ToString())];
+            RecordInvokerLookup(invoker.has_value(), std::chrono::steady_clock::now() - start);
+            return invoker;
         }
 
         if(!algo)
@@ -281,7 +312,10 @@ public:
 
         MIOPEN_LOG_I2("Returning an invoker for problem " << config.ToString() << " and algorithm "
                                                           << algo->ToString());
-        return invokers.GetFound1_0(config, *algo);
+        const auto start = std::chrono::steady_clock::now();
+        auto invoker     = invokers.GetFound1_0(config, *algo);
+        RecordInvokerLookup(invoker.has_value(), std::chrono::steady_clock::now() - start);
+        return invoker;
     }
 
     std::optional<std::string> GetFound1_0SolverId(const NetworkConfig& config,
@@ -290,6 +324,9 @@ public:
         return invokers.GetFound1_0SolverId(config, algo);
     }
 
+    /// Invokers being built in the background, see PendingInvokers.
+    PendingInvokers& GetPendingInvokers() { return pending_invokers; }
+
 #if MIOPEN_USE_ROCBLAS
     const rocblas_handle_ptr& rhandle() const;
 #endif
@@ -305,7 +342,17 @@ private:
     hipblasLt_handle_ptr CreateHipblasLtHandle() const;
 #endif
 
+    void RecordInvokerLookup(bool hit, std::chrono::nanoseconds latency) const
+    {
+        RecordLookup(&GetLookupCounters(),
+                     LookupSource::InvokerCache,
+                     hit ? LookupEvent::Hit : LookupEvent::Miss,
+                     latency);
+    }
+
     InvokerCache invokers;
+    // Declared after impl, so the builds are finished before the handle is torn down.
+    PendingInvokers pending_invokers;
 };
 
 inline std::ostream& operator<<(std::ostream& os, const Handle& handle) { return handle.Print(os); }
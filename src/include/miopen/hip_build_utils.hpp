@@ -33,6 +33,7 @@
 #include <miopen/write_file.hpp>
 #include <boost/optional.hpp>
 #include <string>
+#include <vector>
 
 namespace miopen {
 
@@ -42,6 +43,24 @@ fs::path HipBuild(const TmpDir& tmp_dir,
                   std::string params,
                   const TargetProperties& target);
 
+/// True if HipBuild() without a TmpDir may be used, which is controlled by
+/// MIOPEN_DEBUG_HIP_BUILD_IN_MEMORY. Only supported for HIP backend on Linux.
+bool IsHipBuildInMemoryEnabled();
+
+/// Builds the code object without writing the source or the object to disk. Only the include
+/// files are kept in scratch directories which are reused between builds.
+std::vector<char> HipBuild(const fs::path& filename,
+                           std::string_view src,
+                           std::string params,
+                           const TargetProperties& target);
+
+/// Runs `compiler` in `cwd` with `src` on its standard input and returns everything it writes
+/// to its standard output. Throws if the compiler fails or the output is empty.
+MIOPEN_INTERNALS_EXPORT std::vector<char> HipBuildPiped(const fs::path& compiler,
+                                                        const fs::path& cwd,
+                                                        std::string_view src,
+                                                        std::string_view args);
+
 void bin_file_to_str(const fs::path& file, std::string& buf);
 
 class LcOptionTargetStrings
@@ -35,10 +35,13 @@
 #include <array>
 #include <cassert>
 #include <cstring>
+#include <memory>
 #include <vector>
 
 namespace miopen {
 
+struct LaunchRecording;
+
 using HipEventPtr = MIOPEN_MANAGE_PTR(hipEvent_t, hipEventDestroy);
 inline HipEventPtr make_hip_event()
 {
@@ -184,6 +187,17 @@ struct MIOPEN_INTERNALS_EXPORT HIPOCKernelInvoke
 
     const std::string& GetName() const { return name; }
 
+    /// Launches with already packed arguments, e.g. replayed from a LaunchRecording.
+    void RunPacked(void* args, std::size_t size) const { run(args, size); }
+
+    /// Launches are appended to the recording instead of (or in addition to) being issued. The
+    /// recording keeps the program, which owns the module of the function.
+    void SetRecording(std::shared_ptr<LaunchRecording> recording_, HIPOCProgram program)
+    {
+        recording         = std::move(recording_);
+        recording_program = std::move(program);
+    }
+
 private:
     void run(void* args, std::size_t size) const;
     void run_cooperative(void** kern_args) const;
@@ -194,7 +208,9 @@ private:
     std::array<size_t, 3> gdims = {};
     std::string name;
     std::function<void(hipEvent_t, hipEvent_t)> callback;
-    bool coop_launch;
+    bool coop_launch = false;
+    std::shared_ptr<LaunchRecording> recording;
+    HIPOCProgram recording_program;
 };
 
 struct MIOPEN_INTERNALS_EXPORT HIPOCKernel
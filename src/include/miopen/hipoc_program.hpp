@@ -31,7 +31,9 @@
 #include <miopen/hipoc_program_impl.hpp>
 #include <miopen/filesystem.hpp>
 #include <hip/hip_runtime_api.h>
+#include <memory>
 #include <string>
+#include <string_view>
 
 namespace miopen {
 
@@ -52,6 +54,10 @@ struct HIPOCProgram
     HIPOCProgram(const fs::path& program_name, const fs::path& hsaco);
     HIPOCProgram(const fs::path& program_name, const std::vector<char>& hsaco);
     HIPOCProgram(const fs::path& program_name, const std::vector<uint8_t>& hsaco);
+    /// Loads the module directly from memory owned by storage without copying the blob.
+    HIPOCProgram(const fs::path& program_name,
+                 std::string_view hsaco,
+                 std::shared_ptr<const void> storage);
     std::shared_ptr<HIPOCProgramImpl> impl;
     hipModule_t GetModule() const;
     /// \return Pathname of CO file, if it resides on the filesystem.
@@ -64,6 +70,9 @@ struct HIPOCProgram
     bool IsCodeObjectInMemory() const;
     bool IsCodeObjectInFile() const;
     bool IsCodeObjectInTempFile() const;
+    /// \return True if CO blob is referenced in memory owned by someone else.
+    bool IsCodeObjectMapped() const;
+    std::string_view GetMappedCodeObject() const;
     void FreeCodeObjectFileStorage();
     void AttachBinary(std::vector<char> binary);
     void AttachBinary(fs::path binary);
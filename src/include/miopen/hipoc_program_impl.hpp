@@ -34,6 +34,7 @@
 #include <boost/optional.hpp>
 #include <hip/hip_runtime_api.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -49,6 +50,10 @@ struct HIPOCProgramImpl
 
     HIPOCProgramImpl(const fs::path& program_name, const std::vector<uint8_t>& blob);
 
+    HIPOCProgramImpl(const fs::path& program_name,
+                     std::string_view blob,
+                     std::shared_ptr<const void> storage);
+
     HIPOCProgramImpl(const fs::path& program_name,
                      std::string params,
                      const TargetProperties& target_,
@@ -60,6 +65,10 @@ struct HIPOCProgramImpl
     hipModulePtr module;
     boost::optional<TmpDir> dir;
     std::vector<char> binary;
+    /// Code object owned by someone else (e.g. a mapped solution bundle) and kept alive by
+    /// mapped_storage.
+    std::string_view mapped_binary;
+    std::shared_ptr<const void> mapped_storage;
 
 #if !MIOPEN_USE_COMGR
     void BuildCodeObjectInFile(std::string& params, std::string_view src, const fs::path& filename);
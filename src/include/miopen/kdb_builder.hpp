@@ -0,0 +1,90 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_KDB_BUILDER_HPP_
+#define GUARD_MIOPEN_KDB_BUILDER_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+struct KernelDbBuildOptions
+{
+    /// Target as accepted by MIOPEN_DEVICE_ARCH, e.g. "gfx90a:sramecc+:xnack-".
+    std::string arch;
+    std::size_t num_cu = 0;
+    /// The kernel database to write. Records already in it are kept.
+    fs::path output;
+    /// Build the kernels of every applicable solver instead of only the solvers recorded in the
+    /// installed find-db for the problem.
+    bool all_solvers = false;
+    /// Number of compiler threads, 0 to use the default of the tuning.
+    std::size_t jobs = 0;
+};
+
+struct KernelDbBuildStats
+{
+    std::size_t problems = 0;
+    /// Solutions whose kernels were collected.
+    std::size_t solutions = 0;
+    /// Distinct kernels needed by the solutions.
+    std::size_t kernels = 0;
+    /// Kernels found in the output database already.
+    std::size_t present = 0;
+    /// Kernels copied from the installed or user kernel databases.
+    std::size_t copied = 0;
+    std::size_t compiled = 0;
+    /// Solvers and kernels that failed, see the log for the reason.
+    std::size_t failed = 0;
+};
+
+/// Parses a convolution command line of MIOpenDriver, such as
+/// "convfp16 -n 16 -c 64 -H 56 -W 56 -k 64 -y 3 -x 3 -p 1 -q 1 -F 1", and returns a problem for
+/// each direction enabled by -F. Flags that don't affect the problem are ignored.
+MIOPEN_INTERNALS_EXPORT std::vector<conv::ProblemDescription>
+ParseConvDriverCommand(const std::string& command);
+
+/// Parses a find-db or perf-db problem key, such as
+/// "64-56-56-3x3-64-56-56-16-1x1-1x1-1x1-0-NCHW-FP32-F", the inverse of
+/// conv::ProblemDescription::Serialize().
+MIOPEN_INTERNALS_EXPORT conv::ProblemDescription ParseConvProblemKey(const std::string& key);
+
+/// Collects the kernels of the solutions applicable to the problems on the given target, without
+/// using a GPU, and stores their binaries in options.output, compiling the ones that are not in
+/// the kernel databases already. The result is a kernel database that can be installed next to
+/// the ones shipped with MIOpen.
+MIOPEN_INTERNALS_EXPORT KernelDbBuildStats
+BuildKernelDb(const std::vector<conv::ProblemDescription>& problems,
+              const KernelDbBuildOptions& options);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_KDB_BUILDER_HPP_
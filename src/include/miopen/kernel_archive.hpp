@@ -0,0 +1,83 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_KERNEL_ARCHIVE_HPP
+#define GUARD_MIOPEN_KERNEL_ARCHIVE_HPP
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+/// Index record of a kernel source stored compressed in an archive generated
+/// by addkernels -archive
+struct KernelArchiveEntry
+{
+    const char* name;
+    std::size_t offset;
+    std::size_t compressed_size;
+    std::size_t size;
+};
+
+/// Read-only view of a compressed kernel archive. A source is decompressed on
+/// the first request and stays in memory for the lifetime of the process, so
+/// the returned views never dangle.
+class MIOPEN_INTERNALS_EXPORT KernelArchive
+{
+public:
+    KernelArchive(const char* data, const KernelArchiveEntry* index, std::size_t count);
+
+    bool Contains(const fs::path& name) const { return entries.count(name) != 0; }
+
+    /// Throws if there is no such source
+    std::string_view Get(const fs::path& name) const;
+
+    std::vector<std::reference_wrapper<const fs::path>> GetNames() const;
+
+private:
+    struct Slot
+    {
+        const KernelArchiveEntry* entry;
+        mutable std::once_flag once;
+        mutable std::string text;
+
+        explicit Slot(const KernelArchiveEntry* entry_) : entry(entry_) {}
+    };
+
+    const char* data;
+    std::unordered_map<fs::path, Slot, FsPathHash> entries;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_KERNEL_ARCHIVE_HPP
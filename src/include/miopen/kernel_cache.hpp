@@ -84,10 +84,15 @@ public:
     const std::vector<Kernel>& GetKernels(const std::string& algorithm,
                                           const std::string& network_config);
 
-    bool HasProgram(const fs::path& name, const std::string& params) const;
-    void ClearProgram(const fs::path& name, const std::string& params);
+    /// Programs are shared with the other handles of the same program cache scope (see
+    /// Handle::GetProgramCacheScope()), so these also look up, erase and publish them there.
+    bool HasProgram(const Handle& h, const fs::path& name, const std::string& params);
+    void ClearProgram(const Handle& h, const fs::path& name, const std::string& params);
 
-    void AddProgram(Program prog, const fs::path& program_name, std::string params);
+    void AddProgram(const Handle& h,
+                    Program prog,
+                    const fs::path& program_name,
+                    std::string params);
 
     KernelCache();
 
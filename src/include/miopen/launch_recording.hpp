@@ -0,0 +1,111 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_LAUNCH_RECORDING_HPP
+#define GUARD_MIOPEN_LAUNCH_RECORDING_HPP
+
+#include <miopen/common.hpp>
+#include <miopen/config.hpp>
+#include <miopen/hipoc_program.hpp>
+
+#include <hip/hip_runtime_api.h>
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+
+/// Kernel launch captured while a handle is in capture mode. Arguments are kept in the packed
+/// form that is passed to the launch API. The program is shared with the kernel cache, so the
+/// module of fun stays loaded as long as the recording even if the cache drops the program.
+struct RecordedLaunch
+{
+    HIPOCProgram program;
+    hipFunction_t fun                = nullptr;
+    std::array<std::size_t, 3> ldims = {};
+    std::array<std::size_t, 3> gdims = {};
+    std::string name;
+    std::vector<char> args;
+};
+
+/// Location of a buffer address inside the packed arguments of a recorded launch.
+struct LaunchArgPatch
+{
+    std::size_t launch;
+    std::size_t offset;
+    std::size_t buffer;
+    std::ptrdiff_t delta;
+};
+
+/// Sequence of kernel launches recorded by Handle::BeginCapture()/EndCapture(). Replaying it
+/// skips invoker logic entirely: the packed arguments are reused as is and only the addresses
+/// that point into the buffers registered at capture time are rewritten.
+///
+/// Only launches issued through Handle::Run() are recorded, so operations that bypass it
+/// (memset/memcpy, rocBLAS, composable kernels) are not part of the sequence.
+struct MIOPEN_INTERNALS_EXPORT LaunchRecording
+{
+    using BufferRange = std::pair<ConstData_t, std::size_t>;
+
+    LaunchRecording() = default;
+    LaunchRecording(std::vector<BufferRange> buffers_, bool launch_)
+        : buffers(std::move(buffers_)), launch(launch_)
+    {
+    }
+
+    void Record(const HIPOCProgram& program,
+                hipFunction_t fun,
+                const std::array<std::size_t, 3>& ldims,
+                const std::array<std::size_t, 3>& gdims,
+                const std::string& name,
+                const void* args,
+                std::size_t size);
+
+    /// Packed arguments of the given launch with the registered buffers replaced.
+    std::vector<char> GetArgs(std::size_t idx, const std::vector<Data_t>& new_buffers) const;
+
+    void Replay(const Handle& handle, const std::vector<Data_t>& new_buffers) const;
+
+    const std::vector<RecordedLaunch>& GetLaunches() const { return launches; }
+    const std::vector<LaunchArgPatch>& GetPatches() const { return patches; }
+    const std::vector<BufferRange>& GetBuffers() const { return buffers; }
+    /// Whether the launches are also issued while being recorded.
+    bool IsLaunching() const { return launch; }
+
+private:
+    std::vector<BufferRange> buffers;
+    bool launch = true;
+    std::vector<RecordedLaunch> launches;
+    std::vector<LaunchArgPatch> patches;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_LAUNCH_RECORDING_HPP
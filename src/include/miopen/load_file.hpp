@@ -27,14 +27,39 @@
 #ifndef MIOPEN_GUARD_MLOPEN_LOAD_FILE_HPP
 #define MIOPEN_GUARD_MLOPEN_LOAD_FILE_HPP
 
+#include <miopen/config.hpp>
 #include <miopen/filesystem.hpp>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace miopen {
 
 std::vector<char> LoadFile(const fs::path& path);
 
+/// Read-only view of a whole file. The file is memory mapped where the platform allows it and
+/// read into memory otherwise.
+class MIOPEN_INTERNALS_EXPORT MappedFile
+{
+public:
+    explicit MappedFile(const fs::path& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return ptr; }
+    std::size_t size() const { return length; }
+    std::string_view view() const { return {ptr, length}; }
+
+private:
+    const char* ptr    = nullptr;
+    std::size_t length = 0;
+#ifdef _WIN32
+    std::vector<char> storage;
+#endif
+};
+
 } // namespace miopen
 
 #endif
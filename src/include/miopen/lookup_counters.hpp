@@ -0,0 +1,119 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_LOOKUP_COUNTERS_HPP
+#define GUARD_MIOPEN_LOOKUP_COUNTERS_HPP
+
+#include <miopen/config.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+
+namespace miopen {
+
+struct Handle;
+
+/// Databases and caches whose lookups are counted.
+enum class LookupSource : std::uint8_t
+{
+    FindDb,
+    PerfDb,
+    KernelDb,
+    InvokerCache,
+    ProgramCache,
+    HeuristicFallback, // Hit: the AI heuristic ranked the solvers, miss: the WTI ranking was used
+    CompileFallback,   // Hit: a fallback served the call while the solution was built in the
+                       // background, miss: the call waited for the build, store: a build finished
+    Count,
+};
+
+enum class LookupEvent : std::uint8_t
+{
+    Hit,
+    Miss,
+    Store,
+};
+
+struct LookupCounterValues
+{
+    std::uint64_t hits       = 0;
+    std::uint64_t misses     = 0;
+    std::uint64_t stores     = 0;
+    std::uint64_t latency_ns = 0; // Spent in all counted hits, misses and stores
+};
+
+/// Lock-free hit, miss and store counters with the time spent in them. Every handle owns a set,
+/// the process-wide set receives the events of all handles and of the lookups done without one.
+class MIOPEN_INTERNALS_EXPORT LookupCounters
+{
+public:
+    LookupCounters()                      = default;
+    LookupCounters(const LookupCounters&) = delete;
+    LookupCounters& operator=(const LookupCounters&) = delete;
+
+    void Record(LookupSource source, LookupEvent event, std::chrono::nanoseconds latency);
+    LookupCounterValues Get(LookupSource source) const;
+    void Reset();
+
+    /// The dump of the process-wide counters is printed at exit if MIOPEN_DUMP_LOOKUP_COUNTERS is
+    /// enabled.
+    static LookupCounters& Process();
+
+private:
+    struct Slot
+    {
+        std::atomic<std::uint64_t> hits{0};
+        std::atomic<std::uint64_t> misses{0};
+        std::atomic<std::uint64_t> stores{0};
+        std::atomic<std::uint64_t> latency_ns{0};
+    };
+
+    std::array<Slot, static_cast<std::size_t>(LookupSource::Count)> slots;
+};
+
+/// Counts the event in the process-wide counters and in `handle_counters` unless it is null.
+MIOPEN_INTERNALS_EXPORT void RecordLookup(LookupCounters* handle_counters,
+                                          LookupSource source,
+                                          LookupEvent event,
+                                          std::chrono::nanoseconds latency);
+
+/// Same as Handle::GetLookupCounters(), for the code which only has Handle declared.
+MIOPEN_INTERNALS_EXPORT LookupCounters* GetLookupCounters(const Handle& handle);
+
+/// Prints the counters of the handle to std::cerr if MIOPEN_DUMP_LOOKUP_COUNTERS is enabled.
+MIOPEN_INTERNALS_EXPORT void DumpLookupCounters(const Handle& handle);
+
+MIOPEN_INTERNALS_EXPORT const char* ToString(LookupSource source);
+
+/// One line per source with any events.
+MIOPEN_INTERNALS_EXPORT std::ostream& operator<<(std::ostream& os,
+                                                 const LookupCounters& counters);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_LOOKUP_COUNTERS_HPP
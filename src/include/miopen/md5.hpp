@@ -9,6 +9,7 @@ namespace miopen {
 
 MIOPEN_INTERNALS_EXPORT std::string md5(const std::string&);
 MIOPEN_INTERNALS_EXPORT std::string md5(const std::vector<char>&);
+MIOPEN_INTERNALS_EXPORT std::string md5(const void* data, size_t length);
 
 } // namespace miopen
 
@@ -64,6 +64,9 @@ struct HandleImpl
     KernelCache cache;
     std::int64_t ctx;
     TargetProperties target_properties;
+    std::shared_ptr<LaunchRecording> recording;
+    BufferPool buffer_pool;
+    LookupCounters lookup_counters;
 };
 } // namespace miopen
 #endif // GUARD_MIOPEN_NOGPU_HANDLE_IMPL_HPP_
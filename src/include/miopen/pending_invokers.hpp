@@ -0,0 +1,97 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_PENDING_INVOKERS_HPP
+#define GUARD_MIOPEN_PENDING_INVOKERS_HPP
+
+#include <miopen/config.hpp>
+#include <miopen/invoker.hpp>
+#include <miopen/invoker_cache.hpp>
+#include <miopen/kernel.hpp>
+#include <miopen/kernel_info.hpp>
+
+#include <future>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+
+/// Invokers whose programs are built on background threads, so the calling thread can serve
+/// the requests with another solution in the meantime. The programs of a finished build are
+/// added to the handle by Take() or Wait(), which then prepare the invoker without compiling.
+/// Not thread-safe, like the rest of the handle: only the builds run in the background.
+class MIOPEN_INTERNALS_EXPORT PendingInvokers
+{
+public:
+    using Key = InvokerCache::Key;
+
+    PendingInvokers() = default;
+    PendingInvokers(const PendingInvokers&) = delete;
+    /// The builds use the handle they were started with, so they are finished before moving.
+    PendingInvokers(PendingInvokers&& other) noexcept;
+    PendingInvokers& operator=(const PendingInvokers&) = delete;
+    PendingInvokers& operator=(PendingInvokers&& other) noexcept;
+    ~PendingInvokers();
+
+    /// Starts building the programs of kernels that the handle has not loaded yet. Returns false
+    /// if there is nothing to build, then the invoker can be prepared right away.
+    bool Start(const Handle& handle,
+               const Key& key,
+               const InvokerFactory& factory,
+               const std::vector<solver::KernelInfo>& kernels);
+
+    bool IsPending(const Key& key) const { return builds.find(key) != builds.end(); }
+
+    /// Returns the invoker of a finished build and forgets the build. Returns nothing while the
+    /// build is running or if none was started. Rethrows the errors of the build.
+    std::optional<Invoker> Take(const Handle& handle, const Key& key);
+
+    /// Same as Take(), but waits for the build to finish.
+    std::optional<Invoker> Wait(const Handle& handle, const Key& key);
+
+    std::size_t Size() const { return builds.size(); }
+
+private:
+    struct Build
+    {
+        InvokerFactory factory;
+        std::vector<solver::KernelInfo> kernels;
+        // The kernels of the programs being built, one per program
+        std::vector<solver::KernelInfo> built;
+        std::future<std::vector<Program>> programs;
+    };
+
+    void WaitAll() const;
+    Invoker Finish(const Handle& handle, std::map<Key, Build>::iterator build);
+
+    std::map<Key, Build> builds;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_PENDING_INVOKERS_HPP
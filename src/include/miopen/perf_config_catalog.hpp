@@ -0,0 +1,95 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace miopen {
+namespace solver {
+
+/// Serialized valid performance configs of a (solver, problem class) pair, in the order the
+/// ComputedContainer enumerates them.
+class MIOPEN_INTERNALS_EXPORT PerfConfigCatalogEntry
+{
+public:
+    PerfConfigCatalogEntry(bool spare_, std::vector<std::string> configs_);
+
+    /// Set if the main set of configs is empty and the configs are from the spare one.
+    bool IsSpare() const { return spare; }
+    const std::vector<std::string>& Configs() const { return configs; }
+    bool Contains(const std::string& config) const { return index.count(config) != 0; }
+
+private:
+    bool spare;
+    std::vector<std::string> configs;
+    std::unordered_set<std::string> index;
+};
+
+/// Keeps the results of the perf config enumeration, which calls IsValid() on every candidate
+/// and takes seconds per problem for some solvers. Entries are kept in memory and, unless the
+/// user db is disabled, in a directory with one text file per key, so other processes and
+/// later runs reuse them. Files are written under a lock file and replaced atomically.
+class MIOPEN_INTERNALS_EXPORT PerfConfigCatalog
+{
+public:
+    /// An empty `dir_` keeps the entries in memory only.
+    explicit PerfConfigCatalog(fs::path dir_);
+
+    /// Returns nullptr unless the entry has been stored by this or another process.
+    std::shared_ptr<const PerfConfigCatalogEntry> Find(const std::string& key);
+
+    std::shared_ptr<const PerfConfigCatalogEntry> Store(const std::string& key,
+                                                        PerfConfigCatalogEntry entry);
+
+    /// Drops an entry which could not be deserialized, e.g. if the solver has changed.
+    void Remove(const std::string& key);
+
+    const fs::path& Path() const { return dir; }
+
+private:
+    fs::path FilePath(const std::string& key) const;
+    std::shared_ptr<const PerfConfigCatalogEntry> Load(const std::string& key) const;
+    void Save(const std::string& key, const PerfConfigCatalogEntry& entry) const;
+
+    fs::path dir;
+    std::mutex mutex;
+    std::unordered_map<std::string, std::shared_ptr<const PerfConfigCatalogEntry>> entries;
+};
+
+/// Process-wide catalog, nullptr if disabled with MIOPEN_DEBUG_PERF_CONFIG_CATALOG=0.
+/// MIOPEN_PERF_CONFIG_CATALOG_PATH overrides the default location in the user db directory.
+MIOPEN_INTERNALS_EXPORT PerfConfigCatalog* GetPerfConfigCatalog();
+
+} // namespace solver
+} // namespace miopen
@@ -32,6 +32,7 @@
 #include <memory>
 #include <string_view>
 #include <map>
+#include <vector>
 
 namespace miopen {
 
@@ -48,6 +49,13 @@ struct MIOPEN_INTERNALS_EXPORT Process
                    std::ostream* out                                           = nullptr,
                    const ProcessEnvironmentMap& additionalEnvironmentVariables = {});
 
+    /// Feeds `input` to the standard input of the process and collects everything it
+    /// writes to the standard output into `output`. No temporary files are involved.
+    int Pipe(std::string_view args,
+             const fs::path& cwd,
+             std::string_view input,
+             std::vector<char>& output);
+
 private:
     std::unique_ptr<ProcessImpl> impl;
 };
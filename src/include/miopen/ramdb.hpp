@@ -65,6 +65,7 @@ public:
     RamDb& operator=(RamDb&&) = delete;
 
     static fs::path GetTimeFilePath(const fs::path& path);
+    static void UpdateModificationTime(const fs::path& path);
     static RamDb& GetCached(DbKinds db_kind_, const fs::path& path, bool is_system);
 
     static RamDb& GetCached(DbKinds db_kind_,
@@ -151,65 +152,85 @@ template <>
 // cppcheck-suppress noConstructor
 class DbTimer<RamDb>
 {
+    enum class Counted
+    {
+        No,
+        Lookup,
+        Store,
+    };
+
     RamDb& inner;
+    LookupSource source;
+    LookupCounters* handle_counters;
 
     template <class TFunc>
-    static auto Measure(const std::string& funcName, TFunc&& func)
+    auto Measure(const std::string& funcName, Counted counted, TFunc&& func) const
     {
-        if(!miopen::IsLogging(LoggingLevel::Info2))
-            return func();
-
-        const auto start = std::chrono::high_resolution_clock::now();
+        const auto start = std::chrono::steady_clock::now();
         auto ret         = func();
-        const auto end   = std::chrono::high_resolution_clock::now();
-        MIOPEN_LOG_I2("Db::" << funcName << " time: " << (end - start).count() * .000001f << " ms");
+        const auto time  = std::chrono::steady_clock::now() - start;
+        if(counted == Counted::Lookup)
+            RecordLookup(handle_counters, source, ret ? LookupEvent::Hit : LookupEvent::Miss, time);
+        else if(counted == Counted::Store)
+            RecordLookup(handle_counters, source, LookupEvent::Store, time);
+        MIOPEN_LOG_I2("Db::" << funcName << " time: " << time.count() * .000001f << " ms");
         return ret;
     }
 
 public:
     template <class... TArgs>
-    DbTimer(TArgs&&... args) : inner(RamDb::GetCached(args...))
+    DbTimer(DbKinds kind, TArgs&&... args) : DbTimer(nullptr, kind, args...)
+    {
+    }
+
+    template <class... TArgs>
+    DbTimer(LookupCounters* handle_counters_, DbKinds kind, TArgs&&... args)
+        : inner(RamDb::GetCached(kind, args...)),
+          source(GetLookupSource(kind)),
+          handle_counters(handle_counters_)
     {
     }
 
     template <class TProblem>
     auto FindRecord(const TProblem& problem)
     {
-        return Measure("FindRecord", [&]() { return inner.FindRecord(problem); });
+        return Measure("FindRecord", Counted::Lookup, [&]() { return inner.FindRecord(problem); });
     }
 
     bool StoreRecord(const DbRecord& record)
     {
-        return Measure("StoreRecord", [&]() { return inner.StoreRecord(record); });
+        return Measure("StoreRecord", Counted::Store, [&]() { return inner.StoreRecord(record); });
     }
 
     bool UpdateRecord(DbRecord& record)
     {
-        return Measure("UpdateRecord", [&]() { return inner.UpdateRecord(record); });
+        return Measure(
+            "UpdateRecord", Counted::Store, [&]() { return inner.UpdateRecord(record); });
     }
 
     template <class TProblem>
     bool RemoveRecord(const TProblem& problem)
     {
-        return Measure("RemoveRecord", [&]() { return inner.RemoveRecord(problem); });
+        return Measure("RemoveRecord", Counted::No, [&]() { return inner.RemoveRecord(problem); });
     }
 
     template <class TProblem, class TValue>
     auto Update(const TProblem& problem, const std::string& id, const TValue& value)
     {
-        return Measure("Update", [&]() { return inner.Update(problem, id, value); });
+        return Measure(
+            "Update", Counted::Store, [&]() { return inner.Update(problem, id, value); });
     }
 
     template <class TProblem, class TValue>
     bool Load(const TProblem& problem, const std::string& id, TValue& value)
     {
-        return Measure("Load", [&]() { return inner.Load(problem, id, value); });
+        return Measure("Load", Counted::Lookup, [&]() { return inner.Load(problem, id, value); });
     }
 
     template <class TProblem>
     bool Remove(const TProblem& problem, const std::string& id)
     {
-        return Measure("Remove", [&]() { return inner.Remove(problem, id); });
+        return Measure("Remove", Counted::No, [&]() { return inner.Remove(problem, id); });
     }
 };
 
@@ -31,9 +31,12 @@
 
 #include <boost/optional.hpp>
 
+#include <chrono>
+#include <future>
+#include <mutex>
 #include <unordered_map>
 #include <string>
-#include <sstream>
+#include <string_view>
 
 namespace miopen {
 
@@ -49,6 +52,10 @@ public:
     static ReadonlyRamDb&
     GetCached(DbKinds db_kind_, const fs::path& path, bool warn_if_unreadable);
 
+    /// Starts loading the database on a background thread and returns immediately. A later
+    /// GetCached() of the same path blocks only while the loading is still in flight.
+    static void PrefetchAsync(DbKinds db_kind_, const fs::path& path, bool warn_if_unreadable);
+
     boost::optional<DbRecord> FindRecord(const std::string& problem) const
     {
         MIOPEN_LOG_I2("Looking for key " << problem << " in file " << db_path);
@@ -101,14 +108,22 @@ private:
     DbKinds db_kind;
     fs::path db_path;
     std::unordered_map<std::string, CacheItem> cache;
+    std::chrono::duration<double, std::milli> load_time{};
+    std::once_flag load_reported;
+    // Declared last so that destruction waits for the background load before the cache goes away.
+    std::shared_future<void> loading;
+
+    ReadonlyRamDb(const ReadonlyRamDb&) = delete;
+    ReadonlyRamDb(ReadonlyRamDb&&)      = delete;
+    ReadonlyRamDb& operator=(const ReadonlyRamDb&) = delete;
+    ReadonlyRamDb& operator=(ReadonlyRamDb&&) = delete;
 
-    ReadonlyRamDb(const ReadonlyRamDb&) = default;
-    ReadonlyRamDb(ReadonlyRamDb&&)      = default;
-    ReadonlyRamDb& operator=(const ReadonlyRamDb&) = default;
-    ReadonlyRamDb& operator=(ReadonlyRamDb&&) = default;
+    static ReadonlyRamDb&
+    GetInstance(DbKinds db_kind_, const fs::path& path, bool warn_if_unreadable, bool async);
 
     void Prefetch(bool warn_if_unreadable);
-    void ParseAndLoadDb(std::istream& input_stream, bool warn_if_unreadable);
+    void WaitForPrefetch();
+    void ParseAndLoadDb(std::string_view text);
 };
 
 } // namespace miopen
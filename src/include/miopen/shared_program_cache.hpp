@@ -0,0 +1,129 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_SHARED_PROGRAM_CACHE_HPP_
+#define GUARD_MIOPEN_SHARED_PROGRAM_CACHE_HPP_
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/kernel.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+namespace miopen {
+
+struct SharedProgramCacheStats
+{
+    /// Lookups served by a program loaded earlier.
+    std::size_t hits = 0;
+    /// Lookups that found the program being loaded by another thread and waited for it.
+    std::size_t waits = 0;
+    /// Programs actually loaded from the binary cache or compiled.
+    std::size_t loads = 0;
+    /// Loads that have thrown. The exception is rethrown to every waiter.
+    std::size_t failures = 0;
+};
+
+/// Programs loaded by the handles of the process, keyed by the program cache scope of the
+/// handle (see Handle::GetProgramCacheScope()), the program name and the build parameters.
+///
+/// The cache only references the programs, they are owned by the kernel caches of the handles
+/// and are released once the last handle using them is destroyed. Concurrent requests for a
+/// program that is not loaded yet are coalesced: the first one loads it, the others wait for
+/// the result. Entries of released programs are dropped when they are looked up, and in a sweep
+/// whenever the number of entries has doubled since the previous one.
+class MIOPEN_INTERNALS_EXPORT SharedProgramCache
+{
+public:
+    static SharedProgramCache& Instance();
+
+    /// Returns the program, calling load() unless it is alive in some handle or another thread
+    /// is loading it already. If load() throws, the exception is propagated to all the callers
+    /// waiting for it and the next call retries.
+    Program GetOrLoad(const std::string& scope,
+                      const fs::path& name,
+                      const std::string& params,
+                      const std::function<Program()>& load);
+
+    /// Returns the program if it is alive in some handle. Doesn't wait for loads in progress.
+    std::optional<Program>
+    Find(const std::string& scope, const fs::path& name, const std::string& params);
+
+    /// Replaces the shared program, e.g. by one built with the binary attached.
+    void Store(const std::string& scope,
+               const fs::path& name,
+               const std::string& params,
+               const Program& program);
+
+    void Erase(const std::string& scope, const fs::path& name, const std::string& params);
+    void Clear();
+
+    /// Number of entries, including the released programs that were not dropped yet.
+    std::size_t Size() const;
+
+    SharedProgramCacheStats GetStats() const;
+    void ResetStats();
+
+private:
+    using Key = std::tuple<std::string, std::string, std::string>;
+
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const;
+    };
+
+    struct Entry
+    {
+        /// Valid while the program is being loaded.
+        std::shared_future<Program> loading;
+        std::weak_ptr<HIPOCProgramImpl> program;
+        /// Tells the thread loading the program whether the entry was replaced meanwhile.
+        std::size_t id = 0;
+    };
+
+    static constexpr std::size_t MinPruneSize = 64;
+
+    mutable std::mutex mutex;
+    std::unordered_map<Key, Entry, KeyHash> entries;
+    std::size_t last_id  = 0;
+    std::size_t prune_at = MinPruneSize;
+    SharedProgramCacheStats stats;
+
+    /// Drops the entries of released programs once there are prune_at entries, so that the
+    /// amortized cost per insertion is constant. Must be called under the lock.
+    void PruneIfNeeded();
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_SHARED_PROGRAM_CACHE_HPP_
@@ -30,6 +30,8 @@
 
 #include <miopen/config.hpp>
 #include <miopen/errors.hpp>
+#include <miopen/invoke_params.hpp>
+#include <miopen/invoker.hpp>
 #include <miopen/kernel_info.hpp>
 #include <miopen/object.hpp>
 #include <miopen/problem.hpp>
@@ -42,10 +44,13 @@
 
 #include <optional>
 #include <unordered_map>
+#include <vector>
 
 namespace miopen {
 
 struct Handle;
+struct BoundSolution;
+struct SolutionBundle;
 
 struct MIOPEN_INTERNALS_EXPORT Solution : miopenSolution
 {
@@ -114,10 +119,17 @@ struct MIOPEN_INTERNALS_EXPORT Solution : miopenSolution
              Data_t workspace,
              size_t workspace_size);
 
+    /// Resolves and validates the tensor descriptors and prepares the invoker once. Buffers of
+    /// `inputs` are ignored, BoundSolution::Run takes them in the order of `arguments`.
+    BoundSolution Bind(Handle& handle,
+                       const std::vector<miopenTensorArgumentId_t>& arguments,
+                       const std::unordered_map<miopenTensorArgumentId_t, RunInput>& inputs);
+
     void LogDriverCommand() const;
 
     friend void to_json(nlohmann::json& json, const Solution& solution);
     friend void from_json(const nlohmann::json& json, Solution& solution);
+    friend struct SolutionBundle;
 
     void SetInvoker(Invoker invoker_,
                     const std::vector<Program>& programs            = {},
@@ -163,6 +175,10 @@ private:
                  std::size_t workspace_size,
                  const ConvolutionDescriptor& conv_desc);
 
+    void PrepareConvInvoker(Handle& handle,
+                            const Problem& problem_,
+                            const AnyInvokeParams& invoke_ctx);
+
     void RunImpl(Handle& handle,
                  const std::unordered_map<miopenTensorArgumentId_t, RunInput>& inputs,
                  Data_t /*workspace*/,
@@ -197,6 +213,52 @@ private:
 
     void LogDriverCommand(const Problem& problem_) const;
     void LogDriverCommand(const FusedProblem& problem_) const;
+
+    /// Serializes everything but the code objects. Kernels refer to the returned programs by
+    /// index.
+    std::vector<Program> SerializeMetadata(nlohmann::json& json) const;
+    void DeserializeMetadata(const nlohmann::json& json, const std::vector<Program>& programs);
+};
+
+/// Many solutions stored in a single file. Code objects are stored once per distinct content and
+/// are loaded directly from the memory mapped file.
+struct MIOPEN_INTERNALS_EXPORT SolutionBundle
+{
+    static void Save(const fs::path& path, const std::vector<const Solution*>& solutions);
+    static std::vector<Solution> Load(const fs::path& path);
+    static std::size_t GetSize(const fs::path& path);
+};
+
+/// Solution with the tensor descriptors fixed by Solution::Bind. Running it only patches the
+/// buffers of the prepared invoke params before calling the invoker.
+/// \note Numerics are not checked for bound solutions.
+struct MIOPEN_INTERNALS_EXPORT BoundSolution : miopenBoundSolution
+{
+    /// Patches the buffers of the invoke params. `buffers` are in the order of the arguments.
+    using Patch = std::function<void(
+        AnyInvokeParams&, const Data_t* buffers, Data_t workspace, std::size_t workspace_size)>;
+
+    BoundSolution(std::vector<miopenTensorArgumentId_t> arguments_,
+                  Invoker invoker_,
+                  AnyInvokeParams invoke_params_,
+                  Patch patch_,
+                  std::size_t workspace_required_);
+
+    void Run(Handle& handle,
+             const Data_t* buffers,
+             std::size_t buffers_count,
+             Data_t workspace,
+             std::size_t workspace_size) const;
+
+    const std::vector<miopenTensorArgumentId_t>& GetArguments() const { return arguments; }
+    std::size_t GetWorkspaceSize() const { return workspace_required; }
+
+private:
+    std::vector<miopenTensorArgumentId_t> arguments;
+    Invoker invoker;
+    AnyInvokeParams invoke_params;
+    Patch patch;
+    std::size_t workspace_required;
 };
 
 } // namespace miopen
@@ -209,3 +271,4 @@ inline std::ostream& operator<<(std::ostream& stream, const miopen::Solution& so
 }
 
 MIOPEN_DEFINE_OBJECT(miopenSolution, miopen::Solution);
+MIOPEN_DEFINE_OBJECT(miopenBoundSolution, miopen::BoundSolution);
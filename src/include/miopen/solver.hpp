@@ -35,6 +35,7 @@
 #include <miopen/performance_config.hpp>
 #include <miopen/type_name.hpp>
 
+#include <cstdint>
 #include <string>
 #include <type_traits>
 #include <algorithm>
@@ -88,6 +89,12 @@ struct SolverBase
     /// Must return true if a Solver has its own implementation of GetWorkspaceSize().
     virtual bool MayNeedWorkspace() const { return false; }
 
+    /// Cheap necessary condition of IsApplicable(). Bits of the mask are the problem
+    /// features the Solver accepts (see conv::ProblemFeature), the default accepts all.
+    /// Problems having any feature out of the mask are rejected without calling IsApplicable(),
+    /// so the mask must never reject a problem for which IsApplicable() returns true.
+    virtual std::uint64_t GetFeatureMask() const { return ~std::uint64_t{0}; }
+
 protected:
     template <class Solver>
     static const std::string& GetSolverDbId()
@@ -5,6 +5,11 @@
 #include <miopen/filesystem.hpp>
 #include <miopen/config.hpp>
 
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
 namespace miopen {
 
 struct MIOPEN_INTERNALS_EXPORT TmpDir
@@ -25,6 +30,49 @@ struct MIOPEN_INTERNALS_EXPORT TmpDir
     ~TmpDir();
 };
 
+/// Keeps temporary directories between uses, so that the files which are the same for every
+/// use (e.g. kernel include files) are written once per directory instead of once per use.
+/// A directory must be returned in the same state it was leased, except for those files.
+class MIOPEN_INTERNALS_EXPORT TmpDirPool
+{
+public:
+    class MIOPEN_INTERNALS_EXPORT Lease
+    {
+    public:
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&&) = delete;
+        ~Lease();
+
+        const TmpDir& Get() const { return *dir; }
+        const TmpDir* operator->() const { return &*dir; }
+
+    private:
+        friend class TmpDirPool;
+        Lease(TmpDirPool& pool_, TmpDir dir_);
+
+        TmpDirPool* pool;
+        std::optional<TmpDir> dir;
+    };
+
+    /// `init` is called once for each new directory. At most `max_idle` directories are kept
+    /// when they are not in use, the others are removed on return.
+    TmpDirPool(std::string_view prefix_,
+               std::function<void(const TmpDir&)> init_ = {},
+               std::size_t max_idle_                    = 4);
+
+    Lease Acquire();
+    std::size_t IdleCount() const;
+
+private:
+    void Release(TmpDir dir);
+
+    std::string prefix;
+    std::function<void(const TmpDir&)> init;
+    std::size_t max_idle;
+    mutable std::mutex mutex;
+    std::vector<TmpDir> idle;
+};
+
 } // namespace miopen
 
 #endif
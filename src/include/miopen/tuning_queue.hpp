@@ -0,0 +1,106 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#pragma once
+
+#include <miopen/config.hpp>
+#include <miopen/filesystem.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace solver {
+
+enum class TuningUnitState
+{
+    Pending,   // Not claimed yet
+    Compiling, // Claimed by a compile-only worker
+    Compiled,  // Kernels are in the binary cache, waiting for a benchmarking worker
+    Running,   // Claimed by a benchmarking worker
+    Done,      // Benchmarked, `best` is empty if all configs have failed
+};
+
+/// A chunk of performance configs of a single (solver, problem) pair.
+struct TuningUnit
+{
+    std::string key;
+    std::size_t chunk      = 0;
+    TuningUnitState state  = TuningUnitState::Pending;
+    float time             = 0.0f;
+    std::string best;
+    std::string owner;        // "host:pid" of the worker which has claimed the unit
+    std::int64_t claimed = 0; // Claim time, seconds since the epoch
+    std::vector<std::string> configs;
+};
+
+/// Work queue shared by processes which tune the same set of problems, e.g. several
+/// MIOpenDriver instances. The queue is a text file with one unit per line, guarded by
+/// a lock file next to it, so it can be shared over a network file system between hosts.
+///
+/// Units claimed by a worker which has died go back to pending, so that other workers finish
+/// them. A worker is considered dead once its process is gone (checked on the same host only) or
+/// once its claim is older than `claim_timeout`. Zero timeout disables the latter.
+class MIOPEN_INTERNALS_EXPORT TuningQueue
+{
+public:
+    explicit TuningQueue(fs::path file_, std::chrono::seconds claim_timeout_ = {});
+
+    /// Splits `configs` into units of `chunk_size` unless there are some units for `key`
+    /// already. Returns the number of units added.
+    std::size_t Enqueue(const std::string& key,
+                        const std::vector<std::string>& configs,
+                        std::size_t chunk_size);
+
+    /// Compile-only workers claim pending units. Benchmarking workers prefer compiled ones.
+    /// Abandoned claims are requeued first.
+    std::optional<TuningUnit> Claim(const std::string& key, bool compile_only);
+
+    /// Stores the state, time and best config of a claimed unit.
+    void Complete(const TuningUnit& unit);
+
+    /// Picks the fastest config among the benchmarked units.
+    std::optional<TuningUnit> Best(const std::string& key) const;
+
+    std::size_t Count(const std::string& key, std::optional<TuningUnitState> state = {}) const;
+
+    const fs::path& Path() const { return file; }
+
+private:
+    std::vector<TuningUnit> Read() const;
+    void Write(const std::vector<TuningUnit>& units) const;
+    std::size_t RequeueAbandoned(std::vector<TuningUnit>& units) const;
+
+    fs::path file;
+    fs::path lock_path;
+    std::chrono::seconds claim_timeout;
+};
+
+} // namespace solver
+} // namespace miopen
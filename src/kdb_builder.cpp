@@ -0,0 +1,634 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/kdb_builder.hpp>
+
+#include <miopen/any_solver.hpp>
+#include <miopen/binary_cache.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/execution_context.hpp>
+#include <miopen/find_db.hpp>
+#include <miopen/generic_search.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/load_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/mlo_internal.hpp>
+#include <miopen/par_for.hpp>
+#include <miopen/problem_description_base.hpp>
+#include <miopen/solver_id.hpp>
+#include <miopen/stringutils.hpp>
+#include <miopen/tensor.hpp>
+
+#if MIOPEN_ENABLE_SQLITE_KERN_CACHE
+#include <miopen/kern_db.hpp>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <tuple>
+#include <unordered_map>
+
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DEVICE_ARCH)
+
+namespace miopen {
+
+namespace {
+
+int ParseInt(const std::string& value, const std::string& what)
+{
+    // std::stoi() accepts trailing garbage like "3x3".
+    auto pos = std::size_t{0};
+    auto ret = 0;
+    try
+    {
+        ret = std::stoi(value, &pos);
+    }
+    catch(const std::exception&)
+    {
+        pos = 0;
+    }
+    if(value.empty() || pos != value.size())
+        MIOPEN_THROW(miopenStatusInvalidValue, "Invalid " + what + ": '" + value + "'");
+    return ret;
+}
+
+std::vector<int>
+ParseDims(const std::string& value, std::size_t spatial_dims, const std::string& what)
+{
+    const auto items = SplitDelim(value, 'x');
+    if(items.size() != spatial_dims)
+        MIOPEN_THROW(miopenStatusInvalidValue,
+                     "Expected " + std::to_string(spatial_dims) + " " + what + ": '" + value +
+                         "'");
+    auto dims = std::vector<int>{};
+    std::transform(items.begin(), items.end(), std::back_inserter(dims), [&](auto&& item) {
+        return ParseInt(item, what);
+    });
+    return dims;
+}
+
+miopenDataType_t ParseDataType(const std::string& name)
+{
+    for(const auto type : {miopenHalf,
+                           miopenFloat,
+                           miopenInt32,
+                           miopenInt8,
+                           miopenBFloat16,
+                           miopenDouble,
+                           miopenFloat8,
+                           miopenBFloat8,
+                           miopenInt64})
+    {
+        if(GetDataTypeName(type) == name)
+            return type;
+    }
+    MIOPEN_THROW(miopenStatusNotImplemented, "Unsupported data type: '" + name + "'");
+}
+
+miopenTensorLayout_t ParseLayout(const std::string& name)
+{
+    for(const auto layout :
+        {miopenTensorNCHW, miopenTensorNHWC, miopenTensorNCDHW, miopenTensorNDHWC})
+    {
+        if(TensorDescriptor::LayoutEnumToStr(layout) == name)
+            return layout;
+    }
+    MIOPEN_THROW(miopenStatusNotImplemented, "Unsupported layout: '" + name + "'");
+}
+
+conv::Direction ParseDirection(const std::string& name)
+{
+    if(name == "F")
+        return conv::Direction::Forward;
+    if(name == "B")
+        return conv::Direction::BackwardData;
+    if(name == "W")
+        return conv::Direction::BackwardWeights;
+    MIOPEN_THROW(miopenStatusInvalidValue, "Invalid direction: '" + name + "'");
+}
+
+struct DriverFlag
+{
+    char short_name;
+    std::string name;
+    std::string default_value;
+};
+
+/// The MIOpenDriver flags that define a convolution problem, with the defaults of the driver.
+const std::vector<DriverFlag>& GetConvDriverFlags()
+{
+    // clang-format off
+    static const auto flags = std::vector<DriverFlag>{
+        {'_', "spatial_dim", "2"},
+        {'n', "batchsize", "100"},
+        {'c', "in_channels", "3"},
+        {'!', "in_d", "32"},
+        {'H', "in_h", "32"},
+        {'W', "in_w", "32"},
+        {'k', "out_channels", "32"},
+        {'@', "fil_d", "3"},
+        {'y', "fil_h", "3"},
+        {'x', "fil_w", "3"},
+        {'#', "conv_stride_d", "1"},
+        {'u', "conv_stride_h", "1"},
+        {'v', "conv_stride_w", "1"},
+        {'$', "pad_d", "0"},
+        {'p', "pad_h", "0"},
+        {'q', "pad_w", "0"},
+        {'^', "dilation_d", "1"},
+        {'l', "dilation_h", "1"},
+        {'j', "dilation_w", "1"},
+        {'%', "trans_output_pad_d", "0"},
+        {'Y', "trans_output_pad_h", "0"},
+        {'X', "trans_output_pad_w", "0"},
+        {'g', "group_count", "1"},
+        {'m', "mode", "conv"},
+        {'z', "pad_mode", "default"},
+        {'F', "forw", "0"},
+        {'I', "in_layout", ""},
+        {'f', "fil_layout", ""},
+        {'O', "out_layout", ""},
+        {'Z', "tensor_vect", "0"},
+        {'L', "vector_length", "1"},
+        {'U', "in_cast_type", "-1"},
+        {'R', "wei_cast_type", "-1"},
+        {'T', "out_cast_type", "-1"},
+    };
+    // clang-format on
+    return flags;
+}
+
+miopenDataType_t GetDriverDataType(const std::string& operation)
+{
+    if(operation == "conv")
+        return miopenFloat;
+    if(operation == "convfp16")
+        return miopenHalf;
+    if(operation == "convbfp16")
+        return miopenBFloat16;
+    MIOPEN_THROW(miopenStatusNotImplemented,
+                 "Unsupported MIOpenDriver operation: '" + operation + "'");
+}
+
+} // namespace
+
+std::vector<conv::ProblemDescription> ParseConvDriverCommand(const std::string& command)
+{
+    auto tokens = std::vector<std::string>{};
+    {
+        auto ss    = std::istringstream{command};
+        auto token = std::string{};
+        while(ss >> token)
+            tokens.push_back(token);
+    }
+
+    // Skip the path to the driver, if any.
+    auto it = std::find_if(tokens.begin(), tokens.end(), [](const std::string& token) {
+        return fs::path{token}.filename() != "MIOpenDriver";
+    });
+    if(it == tokens.end())
+        MIOPEN_THROW(miopenStatusInvalidValue, "No operation in: '" + command + "'");
+    const auto type = GetDriverDataType(*it);
+
+    const auto& known = GetConvDriverFlags();
+    auto values       = std::unordered_map<std::string, std::string>{};
+    for(const auto& flag : known)
+        values[flag.name] = flag.default_value;
+
+    for(++it; it != tokens.end(); ++it)
+    {
+        const auto& flag = *it;
+        if(flag.size() < 2 || flag[0] != '-')
+            MIOPEN_THROW(miopenStatusInvalidValue, "Unexpected argument: '" + flag + "'");
+        if(std::next(it) == tokens.end())
+            MIOPEN_THROW(miopenStatusInvalidValue, "No value for: '" + flag + "'");
+        const auto& value = *(++it);
+
+        const auto match = std::find_if(known.begin(), known.end(), [&](const DriverFlag& f) {
+            return StartsWith(flag, "--") ? flag.substr(2) == f.name
+                                          : flag.size() == 2 && flag[1] == f.short_name;
+        });
+        // Flags like -i or -V don't affect the problem.
+        if(match != known.end())
+            values[match->name] = value;
+    }
+
+    const auto get = [&](const std::string& name) { return ParseInt(values.at(name), name); };
+
+    const auto spatial_dims = get("spatial_dim");
+    if(spatial_dims != 2 && spatial_dims != 3)
+        MIOPEN_THROW(miopenStatusNotImplemented,
+                     "Unsupported spatial_dim: " + std::to_string(spatial_dims));
+    const auto get_spatial = [&](const std::string& prefix) {
+        auto ret = std::vector<int>{};
+        if(spatial_dims == 3)
+            ret.push_back(get(prefix + "_d"));
+        ret.push_back(get(prefix + "_h"));
+        ret.push_back(get(prefix + "_w"));
+        return ret;
+    };
+
+    for(const auto& name : {"in_cast_type", "wei_cast_type", "out_cast_type"})
+    {
+        if(values.at(name) != "-1")
+            MIOPEN_THROW(miopenStatusNotImplemented, std::string{"Unsupported flag: "} + name);
+    }
+    if(get("tensor_vect") != 0 || get("vector_length") != 1)
+        MIOPEN_THROW(miopenStatusNotImplemented, "Vectorized tensors are not supported");
+
+    const auto& mode_name = values.at("mode");
+    if(mode_name != "conv" && mode_name != "trans")
+        MIOPEN_THROW(miopenStatusInvalidValue, "Invalid mode: '" + mode_name + "'");
+    const auto mode = mode_name == "trans" ? miopenTranspose : miopenConvolution;
+
+    const auto batch_size   = get("batchsize");
+    const auto in_channels  = get("in_channels");
+    const auto out_channels = get("out_channels");
+    const auto group_count  = std::max(get("group_count"), 1);
+    if(in_channels % group_count != 0 || out_channels % group_count != 0)
+        MIOPEN_THROW(miopenStatusInvalidValue, "Invalid group_count");
+
+    const auto in_spatial        = get_spatial("in");
+    const auto fil_spatial       = get_spatial("fil");
+    const auto strides           = get_spatial("conv_stride");
+    const auto dilations         = get_spatial("dilation");
+    const auto trans_output_pads = get_spatial("trans_output_pad");
+    auto pads                    = get_spatial("pad");
+
+    // Same as MIOpenDriver.
+    const auto& pad_mode = values.at("pad_mode");
+    if(mode == miopenConvolution &&
+       (std::all_of(dilations.begin(), dilations.end(), [](auto v) { return v == 1; }) ||
+        std::all_of(fil_spatial.begin(), fil_spatial.end(), [](auto v) { return v == 1; })))
+    {
+        for(auto i = 0; i < spatial_dims; ++i)
+        {
+            if(pad_mode == "same")
+            {
+                pads[i] = in_spatial[i] % strides[i] == 0
+                              ? std::max(fil_spatial[i] - strides[i], 0)
+                              : std::max(fil_spatial[i] - in_spatial[i] % strides[i], 0);
+                pads[i] /= 2;
+            }
+            else if(pad_mode == "valid")
+            {
+                pads[i] = 0;
+            }
+        }
+    }
+
+    const auto default_layout = spatial_dims == 2 ? "NCHW" : "NCDHW";
+    const auto get_layout     = [&](const std::string& name) {
+        const auto& value = values.at(name);
+        return value.empty() ? std::string{default_layout} : value;
+    };
+
+    auto in_lens = std::vector<int>{batch_size, in_channels};
+    in_lens.insert(in_lens.end(), in_spatial.begin(), in_spatial.end());
+    auto wei_lens = mode == miopenTranspose
+                        ? std::vector<int>{in_channels, out_channels / group_count}
+                        : std::vector<int>{out_channels, in_channels / group_count};
+    wei_lens.insert(wei_lens.end(), fil_spatial.begin(), fil_spatial.end());
+
+    const auto x = TensorDescriptor{type, ParseLayout(get_layout("in_layout")), in_lens};
+    const auto w = TensorDescriptor{type, ParseLayout(get_layout("fil_layout")), wei_lens};
+    const auto conv = ConvolutionDescriptor{static_cast<std::size_t>(spatial_dims),
+                                            mode,
+                                            miopenPaddingDefault,
+                                            pads,
+                                            strides,
+                                            dilations,
+                                            trans_output_pads,
+                                            group_count};
+    const auto y = conv.GetForwardOutputTensorWithLayout(x, w, get_layout("out_layout"), type);
+
+    const auto forw = get("forw");
+    if(forw < 0 || forw > 7)
+        MIOPEN_THROW(miopenStatusInvalidValue, "Invalid forw: " + std::to_string(forw));
+
+    // See MakeFwdCtxAndProblem() and its siblings for the transpose mode.
+    auto problems = std::vector<conv::ProblemDescription>{};
+    if(forw == 0 || (forw & 1) != 0)
+    {
+        const auto direction =
+            mode == miopenTranspose ? conv::Direction::BackwardData : conv::Direction::Forward;
+        problems.emplace_back(x, w, y, conv, direction);
+    }
+    if(forw == 0 || (forw & 2) != 0)
+    {
+        const auto direction =
+            mode == miopenTranspose ? conv::Direction::Forward : conv::Direction::BackwardData;
+        problems.emplace_back(y, w, x, conv, direction);
+    }
+    if(forw == 0 || (forw & 4) != 0)
+    {
+        if(mode == miopenTranspose)
+            problems.emplace_back(x, w, y, conv, conv::Direction::BackwardWeights);
+        else
+            problems.emplace_back(y, w, x, conv, conv::Direction::BackwardWeights);
+    }
+    return problems;
+}
+
+conv::ProblemDescription ParseConvProblemKey(const std::string& key)
+{
+    const auto parts = SplitDelim(key, '_');
+    if(parts.empty())
+        MIOPEN_THROW(miopenStatusInvalidValue, "Empty problem key");
+    auto group_count = 1;
+    for(auto i = std::size_t{1}; i < parts.size(); ++i)
+    {
+        if(!StartsWith(parts[i], "g"))
+            MIOPEN_THROW(miopenStatusNotImplemented,
+                         "Unsupported problem key suffix: '" + parts[i] + "'");
+        group_count = ParseInt(RemovePrefix(parts[i], "g"), "group count");
+    }
+
+    const auto fields = SplitDelim(parts[0], '-');
+    if(fields.size() < 4)
+        MIOPEN_THROW(miopenStatusInvalidValue, "Invalid problem key: '" + key + "'");
+    // The filter follows the input sizes and has them joined by 'x'.
+    const auto spatial_dims = fields[3].find('x') != std::string::npos ? std::size_t{2} : 3;
+    // With one or three layouts.
+    const auto num_fields = spatial_dims == 3 ? std::size_t{17} : std::size_t{15};
+    if(fields.size() != num_fields && fields.size() != num_fields + 2)
+        MIOPEN_THROW(miopenStatusInvalidValue, "Invalid problem key: '" + key + "'");
+
+    auto field      = fields.begin();
+    const auto next = [&]() -> const std::string& { return *field++; };
+    const auto next_spatial = [&](const std::string& what) {
+        auto ret = std::vector<int>{};
+        for(auto i = std::size_t{0}; i < spatial_dims; ++i)
+            ret.push_back(ParseInt(next(), what));
+        return ret;
+    };
+
+    const auto in_channels  = ParseInt(next(), "input channels");
+    const auto in_spatial   = next_spatial("input size");
+    const auto fil_spatial  = ParseDims(next(), spatial_dims, "filter size");
+    const auto out_channels = ParseInt(next(), "output channels");
+    const auto out_spatial  = next_spatial("output size");
+    const auto batch_size   = ParseInt(next(), "batch size");
+    const auto pads         = ParseDims(next(), spatial_dims, "pads");
+    const auto strides      = ParseDims(next(), spatial_dims, "strides");
+    const auto dilations    = ParseDims(next(), spatial_dims, "dilations");
+    const auto bias         = ParseInt(next(), "bias");
+    const auto in_layout    = ParseLayout(next());
+    const auto wei_layout   = fields.size() == num_fields ? in_layout : ParseLayout(next());
+    const auto out_layout   = fields.size() == num_fields ? in_layout : ParseLayout(next());
+    const auto type         = ParseDataType(next());
+    const auto direction    = ParseDirection(next());
+
+    if(in_channels % group_count != 0 || out_channels % group_count != 0)
+        MIOPEN_THROW(miopenStatusInvalidValue, "Invalid group count in: '" + key + "'");
+
+    auto in_lens = std::vector<int>{batch_size, in_channels};
+    in_lens.insert(in_lens.end(), in_spatial.begin(), in_spatial.end());
+    auto out_lens = std::vector<int>{batch_size, out_channels};
+    out_lens.insert(out_lens.end(), out_spatial.begin(), out_spatial.end());
+    // Backward problems have y as the input, so the channels of the weights are swapped.
+    auto wei_lens = direction == conv::Direction::Forward
+                        ? std::vector<int>{out_channels, in_channels / group_count}
+                        : std::vector<int>{in_channels, out_channels / group_count};
+    wei_lens.insert(wei_lens.end(), fil_spatial.begin(), fil_spatial.end());
+
+    const auto conv = ConvolutionDescriptor{spatial_dims,
+                                            miopenConvolution,
+                                            miopenPaddingDefault,
+                                            pads,
+                                            strides,
+                                            dilations,
+                                            std::vector<int>(spatial_dims, 0),
+                                            group_count};
+
+    return {TensorDescriptor{type, in_layout, in_lens},
+            TensorDescriptor{type, wei_layout, wei_lens},
+            TensorDescriptor{type, out_layout, out_lens},
+            conv,
+            direction,
+            bias};
+}
+
+#if MIOPEN_MODE_NOGPU && MIOPEN_ENABLE_SQLITE_KERN_CACHE
+namespace {
+
+/// A handle of the target being built for, with the compute units the kernel database is
+/// named after.
+class OfflineHandle : public Handle
+{
+public:
+    explicit OfflineHandle(std::size_t num_cu_) : num_cu(num_cu_) {}
+
+    std::size_t GetMaxComputeUnits() const override { return num_cu; }
+
+private:
+    std::size_t num_cu;
+};
+
+std::vector<solver::KernelInfo>
+CollectKernels(const ExecutionContext& ctx,
+               const std::vector<conv::ProblemDescription>& problems,
+               bool all_solvers,
+               KernelDbBuildStats& stats)
+{
+    const auto& all = solver::GetSolversByPrimitive(solver::Primitive::Convolution);
+    auto kernels    = std::vector<solver::KernelInfo>{};
+    auto seen       = std::set<std::tuple<std::string, std::string>>{};
+
+    for(const auto& problem : problems)
+    {
+        auto problem_ctx = ctx;
+        problem.SetupFloats(problem_ctx);
+
+        auto ids = std::vector<solver::Id>{};
+        if(!all_solvers)
+        {
+            const auto record = FindDbRecord{ctx.GetStream(), problem};
+            if(!record.empty())
+            {
+                for(const auto& item : record)
+                    ids.emplace_back(item.first);
+            }
+        }
+        if(ids.empty())
+        {
+            MIOPEN_LOG_I2("Using all applicable solvers for " << problem);
+            ids = all;
+        }
+
+        auto db = GetDb(problem_ctx);
+        for(const auto& id : ids)
+        {
+            const auto solver = id.GetSolver();
+            if(!id.IsValid() || solver.IsEmpty())
+                continue;
+
+            try
+            {
+                if(!solver.IsApplicable(problem_ctx, problem))
+                    continue;
+                const auto solution = solver.FindSolution(problem_ctx, problem, db, {});
+                if(!solution.Succeeded())
+                    continue;
+                ++stats.solutions;
+                for(const auto& kernel : solution.construction_params)
+                {
+                    if(seen.emplace(kernel.kernel_file.string(), kernel.comp_options).second)
+                        kernels.push_back(kernel);
+                }
+            }
+            catch(const std::exception& ex)
+            {
+                ++stats.failed;
+                MIOPEN_LOG_W(id.ToString() << " failed for " << problem << ": " << ex.what());
+            }
+        }
+    }
+    return kernels;
+}
+
+std::vector<char> BuildBinary(const Handle& handle, const solver::KernelInfo& kernel)
+{
+    const auto program = handle.LoadProgram(kernel.kernel_file, kernel.comp_options, "", true);
+    if(program.IsCodeObjectInMemory())
+        return program.GetCodeObjectBlob();
+    if(program.IsCodeObjectMapped())
+    {
+        const auto code_object = program.GetMappedCodeObject();
+        return {code_object.begin(), code_object.end()};
+    }
+    return LoadFile(program.GetCodeObjectPathname());
+}
+
+void StoreKernels(const Handle& handle,
+                  const std::vector<solver::KernelInfo>& kernels,
+                  const KernelDbBuildOptions& options,
+                  KernelDbBuildStats& stats)
+{
+    const auto& target = handle.GetTargetProperties();
+    auto output        = KernDb{DbKinds::KernelDb, options.output, false};
+    auto output_mutex  = std::mutex{};
+    auto present       = std::atomic<std::size_t>{0};
+    auto copied        = std::atomic<std::size_t>{0};
+    auto compiled      = std::atomic<std::size_t>{0};
+    auto failed        = std::atomic<std::size_t>{0};
+    const auto jobs    = options.jobs != 0 ? options.jobs : solver::GetTuningThreadsMax();
+
+    par_for_strided(kernels.size(), max_threads{jobs}, [&](auto i) {
+        const auto& kernel = kernels[i];
+        // The keys of the HIP backend, not the ones of the handle building the kernels.
+        const auto args = GetKernelCacheArgs(target, kernel.kernel_file, kernel.comp_options);
+        auto config     = KernelConfig{make_object_file_name(kernel.kernel_file), args, {}};
+        {
+            std::lock_guard<std::mutex> lock(output_mutex);
+            if(output.FindRecord(config))
+            {
+                ++present;
+                return;
+            }
+        }
+
+        try
+        {
+            config.kernel_blob =
+                LoadBinary(target, options.num_cu, kernel.kernel_file, config.kernel_args);
+            if(!config.kernel_blob.empty())
+            {
+                ++copied;
+            }
+            else
+            {
+                config.kernel_blob = BuildBinary(handle, kernel);
+                ++compiled;
+            }
+        }
+        catch(const std::exception& ex)
+        {
+            ++failed;
+            MIOPEN_LOG_W("Failed to build " << kernel.kernel_file << " with '"
+                                            << kernel.comp_options << "': " << ex.what());
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(output_mutex);
+        output.StoreRecord(config);
+    });
+
+    stats.present += present;
+    stats.copied += copied;
+    stats.compiled += compiled;
+    stats.failed += failed;
+}
+
+} // namespace
+#endif
+
+KernelDbBuildStats BuildKernelDb(const std::vector<conv::ProblemDescription>& problems,
+                                 const KernelDbBuildOptions& options)
+{
+#if MIOPEN_MODE_NOGPU && MIOPEN_ENABLE_SQLITE_KERN_CACHE
+    if(options.arch.empty() || options.num_cu == 0 || options.output.empty())
+        MIOPEN_THROW(miopenStatusBadParm, "The target, compute units and output are required");
+
+    const auto& arch = env::value(MIOPEN_DEVICE_ARCH);
+    if(!arch.empty() && arch != options.arch)
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "MIOPEN_DEVICE_ARCH=" + arch + " conflicts with the target " + options.arch);
+    env::update(MIOPEN_DEVICE_ARCH, options.arch);
+
+#if MIOPEN_USE_COMGR
+    MIOPEN_LOG_W("The kernels built with COMGR are specific to the target ID " << options.arch);
+#endif
+
+    auto handle    = OfflineHandle{options.num_cu};
+    const auto ctx = ExecutionContext{&handle};
+    auto stats     = KernelDbBuildStats{};
+    stats.problems = problems.size();
+
+    const auto kernels = CollectKernels(ctx, problems, options.all_solvers, stats);
+    stats.kernels      = kernels.size();
+    StoreKernels(handle, kernels, options, stats);
+
+    MIOPEN_LOG_I(options.output << ": " << stats.kernels << " kernels for " << stats.problems
+                                << " problems, " << stats.present << " present, " << stats.copied
+                                << " copied, " << stats.compiled << " compiled, " << stats.failed
+                                << " failed");
+    return stats;
+#else
+    std::ignore = problems;
+    std::ignore = options;
+    MIOPEN_THROW(miopenStatusNotImplemented,
+                 "Kernel databases are built with the HIPNOGPU backend and the SQLite kernel "
+                 "cache");
+#endif
+}
+
+} // namespace miopen
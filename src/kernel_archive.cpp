@@ -0,0 +1,72 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/bz2.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/kernel_archive.hpp>
+#include <miopen/logger.hpp>
+
+namespace miopen {
+
+KernelArchive::KernelArchive(const char* data_, const KernelArchiveEntry* index, std::size_t count)
+    : data(data_)
+{
+    for(std::size_t i = 0; i < count; ++i)
+        entries.try_emplace(index[i].name, &index[i]);
+}
+
+std::string_view KernelArchive::Get(const fs::path& name) const
+{
+    const auto it = entries.find(name);
+    if(it == entries.end())
+        MIOPEN_THROW("Failed to load kernel source: " + name);
+
+    const auto& slot = it->second;
+    std::call_once(slot.once, [&]() {
+        const auto* begin = data + slot.entry->offset;
+        const auto text =
+            decompress(std::vector<char>(begin, begin + slot.entry->compressed_size),
+                       static_cast<unsigned int>(slot.entry->size));
+        if(text.size() != slot.entry->size)
+            MIOPEN_THROW("Corrupted kernel archive entry: " + name);
+        slot.text.assign(text.begin(), text.end());
+        MIOPEN_LOG_I2("Decompressed " << name << ": " << slot.entry->compressed_size << " -> "
+                                      << slot.entry->size << " bytes");
+    });
+
+    return slot.text;
+}
+
+std::vector<std::reference_wrapper<const fs::path>> KernelArchive::GetNames() const
+{
+    std::vector<std::reference_wrapper<const fs::path>> names;
+    names.reserve(entries.size());
+    for(const auto& entry : entries)
+        names.emplace_back(std::cref(entry.first));
+    return names;
+}
+
+} // namespace miopen
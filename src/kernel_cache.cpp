@@ -43,15 +43,56 @@
 #include <miopen/errors.hpp>
 #include <miopen/kernel_cache.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/lookup_counters.hpp>
 #include <miopen/stringutils.hpp>
 
+#if MIOPEN_BACKEND_HIP
+#include <miopen/shared_program_cache.hpp>
+#endif
+
+#include <chrono>
 #include <iostream>
 #include <iterator>
+#include <tuple>
 
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DEVICE_ARCH)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_DISABLE_SHARED_PROGRAM_CACHE)
 
 namespace miopen {
 
+namespace {
+
+#if MIOPEN_BACKEND_HIP
+std::string GetSharedProgramScope(const Handle& h)
+{
+    if(env::enabled(MIOPEN_DEBUG_DISABLE_SHARED_PROGRAM_CACHE))
+        return {};
+    return h.GetProgramCacheScope();
+}
+#endif
+
+/// Programs already loaded by another handle on the same device are reused, and concurrent
+/// loads of the same program are done once.
+Program LoadSharedProgram(const Handle& h,
+                          const fs::path& program_name,
+                          const std::string& params,
+                          const std::string& kernel_src,
+                          bool force_attach_binary)
+{
+    const auto load = [&] {
+        return h.LoadProgram(program_name, params, kernel_src, force_attach_binary);
+    };
+
+#if MIOPEN_BACKEND_HIP
+    const auto scope = GetSharedProgramScope(h);
+    if(!scope.empty())
+        return SharedProgramCache::Instance().GetOrLoad(scope, program_name, params, load);
+#endif
+    return load();
+}
+
+} // namespace
+
 const std::vector<Kernel>& KernelCache::GetKernels(const std::string& algorithm,
                                                    const std::string& network_config)
 {
@@ -71,24 +112,55 @@ const std::vector<Kernel>& KernelCache::GetKernels(const std::string& algorithm,
     return empty;
 }
 
-bool KernelCache::HasProgram(const fs::path& name, const std::string& params) const
+bool KernelCache::HasProgram(const Handle& h, const fs::path& name, const std::string& params)
 {
     const auto key = std::make_pair(name, params);
-    return program_map.count(key) > 0;
-}
+    if(program_map.count(key) > 0)
+        return true;
 
-void KernelCache::ClearProgram(const fs::path& name, const std::string& params)
-{
-    if(HasProgram(name, params))
+#if MIOPEN_BACKEND_HIP
+    // Another handle on the same device may have the program already.
+    const auto scope = GetSharedProgramScope(h);
+    if(!scope.empty())
     {
-        const auto key = std::make_pair(name, params);
-        program_map.erase(key);
+        if(auto program = SharedProgramCache::Instance().Find(scope, name, params))
+        {
+            program_map.emplace(key, std::move(*program));
+            return true;
+        }
     }
+#else
+    std::ignore = h;
+#endif
+    return false;
 }
 
-void KernelCache::AddProgram(Program prog, const fs::path& program_name, std::string params)
+void KernelCache::ClearProgram(const Handle& h, const fs::path& name, const std::string& params)
 {
-    program_map[std::make_pair(program_name, params)] = prog;
+    program_map.erase(std::make_pair(name, params));
+
+#if MIOPEN_BACKEND_HIP
+    const auto scope = GetSharedProgramScope(h);
+    if(!scope.empty())
+        SharedProgramCache::Instance().Erase(scope, name, params);
+#else
+    std::ignore = h;
+#endif
+}
+
+void KernelCache::AddProgram(const Handle& h,
+                             Program prog,
+                             const fs::path& program_name,
+                             std::string params)
+{
+#if MIOPEN_BACKEND_HIP
+    const auto scope = GetSharedProgramScope(h);
+    if(!scope.empty())
+        SharedProgramCache::Instance().Store(scope, program_name, params, prog);
+#else
+    std::ignore = h;
+#endif
+    program_map[std::make_pair(program_name, std::move(params))] = std::move(prog);
 }
 
 Kernel KernelCache::AddKernel(const Handle& h,
@@ -108,29 +180,38 @@ Kernel KernelCache::AddKernel(const Handle& h,
         MIOPEN_LOG_I2("Key: " << key.first << " \"" << key.second << '\"');
 
     const auto program = [&] {
-        auto program_it = program_map.find(std::make_pair(program_name, params));
-        if(program_it != program_map.end())
+        const auto program_key = std::make_pair(program_name, params);
+        const auto start       = std::chrono::steady_clock::now();
+        auto program_it        = program_map.find(program_key);
+        const auto hit         = program_it != program_map.end();
+        if(!hit)
         {
-            auto& program = program_it->second;
-
-            if(program_out != nullptr && !program.IsCodeObjectInMemory() &&
-               !program.IsCodeObjectInFile())
-            {
-                // We need the binaries attached to the program.
-                // This may happen if someone calls immediate mode and then find 2.0 with request
-                // for binaries.
-                program = h.LoadProgram(program_name, params, kernel_src, true);
-            }
-
-            return program;
+            auto loaded =
+                LoadSharedProgram(h, program_name, params, kernel_src, program_out != nullptr);
+            program_it = program_map.emplace(program_key, std::move(loaded)).first;
         }
-        else
-        {
-            auto program = h.LoadProgram(program_name, params, kernel_src, program_out != nullptr);
+        RecordLookup(&h.GetLookupCounters(),
+                     LookupSource::ProgramCache,
+                     hit ? LookupEvent::Hit : LookupEvent::Miss,
+                     std::chrono::steady_clock::now() - start);
+
+        auto& program = program_it->second;
 
-            program_map[std::make_pair(program_name, params)] = program;
-            return program;
+        if(program_out != nullptr && !program.IsCodeObjectInMemory() &&
+           !program.IsCodeObjectInFile())
+        {
+            // We need the binaries attached to the program.
+            // This may happen if someone calls immediate mode and then find 2.0 with request
+            // for binaries, or if the program was loaded by another handle.
+            program = h.LoadProgram(program_name, params, kernel_src, true);
+#if MIOPEN_BACKEND_HIP
+            const auto scope = GetSharedProgramScope(h);
+            if(!scope.empty())
+                SharedProgramCache::Instance().Store(scope, program_name, params, program);
+#endif
         }
+
+        return program;
     }();
 
     if(program_out != nullptr)
@@ -27,6 +27,15 @@
 #include <miopen/errors.hpp>
 #include <miopen/load_file.hpp>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
 #include <fstream>
 #include <ios>
 #include <iterator>
@@ -54,4 +63,49 @@ std::vector<char> LoadFile(const fs::path& path)
     return v;
 }
 
+#ifdef _WIN32
+MappedFile::MappedFile(const fs::path& path) : storage(LoadFile(path))
+{
+    ptr    = storage.data();
+    length = storage.size();
+}
+
+MappedFile::~MappedFile() {}
+#else
+MappedFile::MappedFile(const fs::path& path)
+{
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+        MIOPEN_THROW(path.string() + ": file opening error, " + std::strerror(errno));
+
+    struct stat st = {};
+    if(::fstat(fd, &st) != 0)
+    {
+        ::close(fd);
+        MIOPEN_THROW(path.string() + ": file stat error, " + std::strerror(errno));
+    }
+
+    length = static_cast<std::size_t>(st.st_size);
+    if(length != 0)
+    {
+        auto* const mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(mapped == MAP_FAILED)
+        {
+            ::close(fd);
+            MIOPEN_THROW(path.string() + ": file mapping error, " + std::strerror(errno));
+        }
+        ptr = static_cast<const char*>(mapped);
+    }
+
+    // The mapping stays valid after the descriptor is closed.
+    ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if(ptr != nullptr)
+        ::munmap(const_cast<char*>(ptr), length);
+}
+#endif
+
 } // namespace miopen
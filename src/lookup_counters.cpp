@@ -0,0 +1,163 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/lookup_counters.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+
+#include <iomanip>
+#include <iostream>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DUMP_LOOKUP_COUNTERS)
+
+namespace miopen {
+
+namespace {
+
+struct ProcessLookupCounters
+{
+    LookupCounters counters;
+    // Read once, the environment may not be accessible at exit anymore.
+    bool dump_at_exit = env::enabled(MIOPEN_DUMP_LOOKUP_COUNTERS);
+
+    ~ProcessLookupCounters()
+    {
+        if(dump_at_exit)
+            std::cerr << "MIOpen: Lookup counters of the process:" << std::endl << counters;
+    }
+};
+
+} // namespace
+
+void LookupCounters::Record(LookupSource source,
+                            LookupEvent event,
+                            std::chrono::nanoseconds latency)
+{
+    auto& slot = slots.at(static_cast<std::size_t>(source));
+
+    switch(event)
+    {
+    case LookupEvent::Hit: slot.hits.fetch_add(1, std::memory_order_relaxed); break;
+    case LookupEvent::Miss: slot.misses.fetch_add(1, std::memory_order_relaxed); break;
+    case LookupEvent::Store: slot.stores.fetch_add(1, std::memory_order_relaxed); break;
+    }
+
+    slot.latency_ns.fetch_add(latency.count(), std::memory_order_relaxed);
+}
+
+LookupCounterValues LookupCounters::Get(LookupSource source) const
+{
+    if(source >= LookupSource::Count)
+        MIOPEN_THROW(miopenStatusBadParm, "Unknown lookup counter source");
+
+    const auto& slot = slots[static_cast<std::size_t>(source)];
+
+    auto values       = LookupCounterValues{};
+    values.hits       = slot.hits.load(std::memory_order_relaxed);
+    values.misses     = slot.misses.load(std::memory_order_relaxed);
+    values.stores     = slot.stores.load(std::memory_order_relaxed);
+    values.latency_ns = slot.latency_ns.load(std::memory_order_relaxed);
+    return values;
+}
+
+void LookupCounters::Reset()
+{
+    for(auto& slot : slots)
+    {
+        slot.hits.store(0, std::memory_order_relaxed);
+        slot.misses.store(0, std::memory_order_relaxed);
+        slot.stores.store(0, std::memory_order_relaxed);
+        slot.latency_ns.store(0, std::memory_order_relaxed);
+    }
+}
+
+LookupCounters& LookupCounters::Process()
+{
+    static ProcessLookupCounters process;
+    return process.counters;
+}
+
+void RecordLookup(LookupCounters* handle_counters,
+                  LookupSource source,
+                  LookupEvent event,
+                  std::chrono::nanoseconds latency)
+{
+    LookupCounters::Process().Record(source, event, latency);
+    if(handle_counters != nullptr)
+        handle_counters->Record(source, event, latency);
+}
+
+LookupCounters* GetLookupCounters(const Handle& handle) { return &handle.GetLookupCounters(); }
+
+void DumpLookupCounters(const Handle& handle)
+{
+    if(!env::enabled(MIOPEN_DUMP_LOOKUP_COUNTERS))
+        return;
+
+    std::cerr << "MIOpen: Lookup counters of the handle " << &handle << ':' << std::endl
+              << handle.GetLookupCounters();
+}
+
+const char* ToString(LookupSource source)
+{
+    switch(source)
+    {
+    case LookupSource::FindDb: return "find-db";
+    case LookupSource::PerfDb: return "perf-db";
+    case LookupSource::KernelDb: return "kernel-db";
+    case LookupSource::InvokerCache: return "invoker cache";
+    case LookupSource::ProgramCache: return "program cache";
+    case LookupSource::HeuristicFallback: return "heuristic fallback";
+    case LookupSource::CompileFallback: return "compile fallback";
+    case LookupSource::Count: break;
+    }
+    return "<unknown>";
+}
+
+std::ostream& operator<<(std::ostream& os, const LookupCounters& counters)
+{
+    const auto flags     = os.flags();
+    const auto precision = os.precision();
+
+    for(auto i = 0; i < static_cast<int>(LookupSource::Count); ++i)
+    {
+        const auto source = static_cast<LookupSource>(i);
+        const auto values = counters.Get(source);
+        if(values.hits == 0 && values.misses == 0 && values.stores == 0)
+            continue;
+
+        os << "    " << ToString(source) << ": hits " << values.hits << ", misses "
+           << values.misses << ", stores " << values.stores << ", latency " << std::fixed
+           << std::setprecision(3) << values.latency_ns * 1e-6 << " ms" << std::endl;
+    }
+
+    os.flags(flags);
+    os.precision(precision);
+    return os;
+}
+
+} // namespace miopen
@@ -51,7 +51,10 @@
 
 miopen::PerformanceDb miopen::GetDb(const miopen::ExecutionContext& ctx)
 {
-    return {DbKinds::PerfDb, ctx.GetPerfDbPath(), ctx.GetUserPerfDbPath()};
+    return {&ctx.GetStream().GetLookupCounters(),
+            DbKinds::PerfDb,
+            ctx.GetPerfDbPath(),
+            ctx.GetUserPerfDbPath()};
 }
 
 static auto GetGemmSolvers()
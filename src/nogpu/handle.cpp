@@ -28,6 +28,7 @@
 #include <miopen/config.h>
 #include <miopen/handle.hpp>
 #include <miopen/binary_cache.hpp>
+#include <miopen/db_prefetch.hpp>
 #include <miopen/target_properties.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/handle_lock.hpp>
@@ -52,7 +53,10 @@
 #include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <cstdlib>
 #include <thread>
+#include <miopen/buffer_pool.hpp>
+#include <miopen/launch_recording.hpp>
 #include <miopen/nogpu/handle_impl.hpp>
 
 #if MIOPEN_USE_HIPBLASLT
@@ -61,15 +65,26 @@
 
 namespace miopen {
 
+namespace {
+
+// There is no device memory, host memory stands in for it.
+void* default_allocator(void*, size_t sz) { return std::malloc(sz); }
+
+void default_deallocator(void*, void* mem) { std::free(mem); }
+
+} // namespace
+
 Handle::Handle(miopenAcceleratorQueue_t /* stream */) : Handle::Handle() {}
 
 Handle::Handle() : impl(new HandleImpl())
 {
+    this->SetAllocator(nullptr, nullptr, nullptr);
     this->impl->target_properties.Init(this);
     MIOPEN_LOG_NQI(*this);
+    PrefetchSystemDbs(*this);
 }
 
-Handle::~Handle() {}
+Handle::~Handle() { DumpLookupCounters(*this); }
 
 void Handle::SetStream(miopenAcceleratorQueue_t /* streamID */) const {}
 
@@ -78,10 +93,16 @@ void Handle::ReserveExtraStreamsInPool(int) const {}
 
 miopenAcceleratorQueue_t Handle::GetStream() const { return {}; }
 
-void Handle::SetAllocator(miopenAllocatorFunction /* allocator */,
-                          miopenDeallocatorFunction /* deallocator */,
-                          void* /* allocatorContext */) const
+void Handle::SetAllocator(miopenAllocatorFunction allocator,
+                          miopenDeallocatorFunction deallocator,
+                          void* allocatorContext) const
 {
+    this->impl->allocator.allocator   = allocator == nullptr ? default_allocator : allocator;
+    this->impl->allocator.deallocator = deallocator == nullptr ? default_deallocator : deallocator;
+    this->impl->allocator.context     = allocatorContext;
+
+    // Cached buffers belong to the previous allocator.
+    this->impl->buffer_pool.Trim();
 }
 
 void Handle::EnableProfiling(bool enable) const { this->impl->enable_profiling = enable; }
@@ -90,6 +111,15 @@ float Handle::GetKernelTime() const { return this->impl->profiling_result; }
 
 Allocator::ManageDataPtr Handle::Create(std::size_t sz) const { return this->impl->allocator(sz); }
 
+Allocator::ManageDataPtr Handle::CreateCached(std::size_t sz) const
+{
+    return this->impl->buffer_pool.Get(this->impl->allocator, sz);
+}
+
+BufferPool& Handle::GetBufferPool() const { return this->impl->buffer_pool; }
+
+LookupCounters& Handle::GetLookupCounters() const { return this->impl->lookup_counters; }
+
 Allocator::ManageDataPtr&
 Handle::WriteTo(const void* /* data */, Allocator::ManageDataPtr& ddata, std::size_t /* sz */) const
 {
@@ -167,7 +197,7 @@ void Handle::ClearKernels(const std::string& algorithm, const std::string& netwo
 }
 void Handle::ClearProgram(const fs::path& program_name, const std::string& params) const
 {
-    this->impl->cache.ClearProgram(program_name, params);
+    this->impl->cache.ClearProgram(*this, program_name, params);
 }
 
 const std::vector<Kernel>& Handle::GetKernelsImpl(const std::string& algorithm,
@@ -176,7 +206,34 @@ const std::vector<Kernel>& Handle::GetKernelsImpl(const std::string& algorithm,
     return this->impl->cache.GetKernels(algorithm, network_config);
 }
 
-KernelInvoke Handle::Run(Kernel /*k*/, bool /*coop_launch*/) const { return {}; }
+KernelInvoke Handle::Run(Kernel k, bool coop_launch) const
+{
+    if(!this->impl->recording)
+        return {};
+    auto invoke = k.Invoke(nullptr, nullptr, coop_launch);
+    invoke.SetRecording(this->impl->recording, k.program);
+    return invoke;
+}
+
+void Handle::BeginCapture(std::vector<std::pair<ConstData_t, std::size_t>> buffers,
+                          bool /*launch*/) const
+{
+    if(this->impl->recording)
+        MIOPEN_THROW(miopenStatusInvalidValue, "Launch capture is already in progress");
+    // There is no device to launch on, so the launches are only recorded.
+    this->impl->recording = std::make_shared<LaunchRecording>(std::move(buffers), false);
+}
+
+LaunchRecording Handle::EndCapture() const
+{
+    if(!this->impl->recording)
+        MIOPEN_THROW(miopenStatusInvalidValue, "Launch capture has not been started");
+    auto recording = std::move(*this->impl->recording);
+    this->impl->recording.reset();
+    return recording;
+}
+
+bool Handle::IsCapturing() const { return this->impl->recording != nullptr; }
 
 Program Handle::LoadProgram(const fs::path& program_name,
                             std::string params,
@@ -190,8 +247,11 @@ Program Handle::LoadProgram(const fs::path& program_name,
         params += " -mcpu=" + this->GetTargetProperties().Name();
     }
 
-    auto hsaco =
-        miopen::LoadBinary(GetTargetProperties(), GetMaxComputeUnits(), program_name, params);
+    auto hsaco = miopen::LoadBinary(GetTargetProperties(),
+                                    GetMaxComputeUnits(),
+                                    program_name,
+                                    params,
+                                    &this->impl->lookup_counters);
     auto pgmImpl     = std::make_shared<HIPOCProgramImpl>();
     pgmImpl->program = program_name;
     pgmImpl->target  = this->GetTargetProperties();
@@ -210,14 +270,16 @@ Program Handle::LoadProgram(const fs::path& program_name,
                            this->GetTargetProperties(),
                            this->GetMaxComputeUnits(),
                            program_name,
-                           params);
+                           params,
+                           &this->impl->lookup_counters);
 #else
         auto path = miopen::GetCachePath(false) / boost::filesystem::unique_path().string();
         if(p.IsCodeObjectInMemory())
             miopen::WriteFile(p.GetCodeObjectBlob(), path);
         else
             fs::copy_file(p.GetCodeObjectPathname(), path);
-        miopen::SaveBinary(path, GetTargetProperties(), program_name, params);
+        miopen::SaveBinary(
+            path, GetTargetProperties(), program_name, params, &this->impl->lookup_counters);
 #endif
     }
     else
@@ -230,12 +292,18 @@ Program Handle::LoadProgram(const fs::path& program_name,
 
 bool Handle::HasProgram(const fs::path& program_name, const std::string& params) const
 {
-    return this->impl->cache.HasProgram(program_name, params);
+    return this->impl->cache.HasProgram(*this, program_name, params);
 }
 
 void Handle::AddProgram(Program prog, const fs::path& program_name, const std::string& params) const
 {
-    this->impl->cache.AddProgram(prog, program_name, params);
+    this->impl->cache.AddProgram(*this, prog, program_name, params);
+}
+
+std::string Handle::GetProgramCacheScope() const
+{
+    return std::to_string(this->impl->device) + ':' + this->GetDeviceName() + ':' +
+           std::to_string(this->GetMaxComputeUnits());
 }
 
 void Handle::Finish() const {}
@@ -51,7 +51,10 @@ namespace batchnorm {
 miopen::PerformanceDb GetDb(const miopen::ExecutionContext& ctx,
                             const miopen::batchnorm::ProblemDescriptionTag&)
 {
-    return {DbKinds::PerfDb, ctx.GetPerfDbPath("batchnorm"), ctx.GetUserPerfDbPath("batchnorm")};
+    return {&ctx.GetStream().GetLookupCounters(),
+            DbKinds::PerfDb,
+            ctx.GetPerfDbPath("batchnorm"),
+            ctx.GetUserPerfDbPath("batchnorm")};
 }
 } // namespace batchnorm
 
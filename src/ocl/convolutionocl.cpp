@@ -29,6 +29,7 @@
 #include <miopen/algorithm.hpp>
 #include <miopen/conv_algo_name.hpp>
 #include <miopen/conv/solver_finders.hpp>
+#include <miopen/conv/problem_features.hpp>
 #include <miopen/check_numerics.hpp>
 #include <miopen/config.h>
 #include <miopen/db.hpp>
@@ -40,6 +41,7 @@
 #include <miopen/generic_search_controls.hpp>
 #include <miopen/invoker.hpp>
 #include <miopen/kernel.hpp>
+#include <miopen/lookup_counters.hpp>
 #include <miopen/solution.hpp>
 #include <miopen/tensor_ops.hpp>
 #include <miopen/tensor.hpp>
@@ -55,6 +57,7 @@
 #include <miopen/conv/heuristics/ai_heuristics.hpp>
 
 #include <cassert>
+#include <chrono>
 #include <functional>
 #include <type_traits>
 
@@ -64,6 +67,7 @@ MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_CONV_IMMED_FALLBACK)
 MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DUMP_TENSOR_PATH)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_ENABLE_AI_IMMED_MODE_FALLBACK)
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_FORCE_IMMED_MODE_FALLBACK)
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_CONV_IMMED_ASYNC_COMPILE)
 
 namespace miopen {
 
@@ -79,10 +83,9 @@ static inline void ValidateWorkspace(Data_t workSpace, const size_t workSpaceSiz
     /// \todo could add a check here that workSpace points to GPU memory
 }
 
-static Invoker PrepareInvoker(ExecutionContext ctx,
-                              const conv::ProblemDescription& problem,
-                              const NetworkConfig& config,
-                              solver::Id solver_id)
+static solver::ConvSolution FindInvokerSolution(ExecutionContext ctx,
+                                                const conv::ProblemDescription& problem,
+                                                solver::Id solver_id)
 {
     problem.SetupFloats(ctx);
     ctx.do_search              = false;
@@ -90,12 +93,29 @@ static Invoker PrepareInvoker(ExecutionContext ctx,
 
     const auto solver = solver_id.GetSolver();
     auto db           = GetDb(ctx);
-    auto solution     = solver.FindSolution(ctx, problem, db, {}); // auto tune is not expected here
-    auto& handle      = ctx.GetStream();
-    auto invoker = handle.PrepareInvoker(*solution.invoker_factory, solution.construction_params);
-    const auto algo = AlgorithmName{solver_id.GetAlgo(problem.GetDirection())};
+    return solver.FindSolution(ctx, problem, db, {}); // auto tune is not expected here
+}
 
+static void RegisterInvoker(Handle& handle,
+                            const Invoker& invoker,
+                            const conv::ProblemDescription& problem,
+                            const NetworkConfig& config,
+                            solver::Id solver_id)
+{
+    const auto algo = AlgorithmName{solver_id.GetAlgo(problem.GetDirection())};
     handle.RegisterInvoker(invoker, config, solver_id.ToString(), algo);
+}
+
+static Invoker PrepareInvoker(const ExecutionContext& ctx,
+                              const conv::ProblemDescription& problem,
+                              const NetworkConfig& config,
+                              solver::Id solver_id)
+{
+    const auto solution = FindInvokerSolution(ctx, problem, solver_id);
+    auto& handle        = ctx.GetStream();
+    auto invoker = handle.PrepareInvoker(*solution.invoker_factory, solution.construction_params);
+
+    RegisterInvoker(handle, invoker, problem, config, solver_id);
     return invoker;
 }
 
@@ -111,6 +131,102 @@ Invoker LoadOrPrepareInvoker(const ExecutionContext& ctx,
     return PrepareInvoker(ctx, problem, config, solver_id);
 }
 
+/// The naive solvers build one kernel per data type and layout, which serves every problem of
+/// them, so they are cheap to have ready while the kernels of a problem are being built.
+static solver::Id GetCompileFallbackSolver(conv::Direction direction)
+{
+    switch(direction)
+    {
+    case conv::Direction::Forward: return solver::Id{"ConvDirectNaiveConvFwd"};
+    case conv::Direction::BackwardData: return solver::Id{"ConvDirectNaiveConvBwd"};
+    case conv::Direction::BackwardWeights: return solver::Id{"ConvDirectNaiveConvWrw"};
+    }
+    MIOPEN_THROW(miopenStatusInternalError);
+}
+
+/// Same as LoadOrPrepareInvoker(), but the kernels of solver_id are built in the background when
+/// MIOPEN_CONV_IMMED_ASYNC_COMPILE is set. Until the build finishes, the calls are served with
+/// the naive solver if it is applicable and fits into the workspace, otherwise they wait for it.
+static Invoker LoadOrPrepareInvokerAsync(const ExecutionContext& ctx,
+                                         const conv::ProblemDescription& problem,
+                                         solver::Id solver_id,
+                                         std::size_t workspace_size)
+{
+    if(!env::enabled(MIOPEN_CONV_IMMED_ASYNC_COMPILE))
+        return LoadOrPrepareInvoker(ctx, problem, solver_id);
+
+    auto& handle      = ctx.GetStream();
+    const auto config = problem.MakeNetworkConfig();
+    if(const auto invoker = handle.GetInvoker(config, solver_id))
+        return *invoker;
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto key   = InvokerCache::Key{config.ToString(), solver_id.ToString()};
+    auto& pending    = handle.GetPendingInvokers();
+
+    const auto register_built = [&](const Invoker& invoker) {
+        RegisterInvoker(handle, invoker, problem, config, solver_id);
+        RecordLookup(&handle.GetLookupCounters(),
+                     LookupSource::CompileFallback,
+                     LookupEvent::Store,
+                     std::chrono::steady_clock::now() - start);
+        return invoker;
+    };
+
+    if(pending.IsPending(key))
+    {
+        if(const auto invoker = pending.Take(handle, key))
+            return register_built(*invoker);
+    }
+    else
+    {
+        const auto solution = FindInvokerSolution(ctx, problem, solver_id);
+        if(!pending.Start(handle, key, *solution.invoker_factory, solution.construction_params))
+        {
+            // Every program is loaded already, there is nothing to wait for.
+            auto invoker =
+                handle.PrepareInvoker(*solution.invoker_factory, solution.construction_params);
+            RegisterInvoker(handle, invoker, problem, config, solver_id);
+            return invoker;
+        }
+    }
+
+    const auto fallback = GetCompileFallbackSolver(problem.GetDirection());
+    if(fallback != solver_id)
+    {
+        const auto solver = fallback.GetSolver();
+        if(solver.IsApplicable(ctx, problem) &&
+           solver.GetWorkspaceSize(ctx, problem) <= workspace_size)
+        {
+            MIOPEN_LOG_I2("Solver " << solver_id.ToString() << " is being built, serving with "
+                                    << fallback.ToString());
+            // The fallback stands in for solver_id only until the build is done, so it is not
+            // recorded as the solution found for its algorithm.
+            auto invoker = handle.GetInvoker(config, fallback);
+            if(!invoker)
+            {
+                const auto solution = FindInvokerSolution(ctx, problem, fallback);
+                invoker =
+                    handle.PrepareInvoker(*solution.invoker_factory, solution.construction_params);
+                handle.RegisterInvoker(*invoker, config, fallback.ToString());
+            }
+            RecordLookup(&handle.GetLookupCounters(),
+                         LookupSource::CompileFallback,
+                         LookupEvent::Hit,
+                         std::chrono::steady_clock::now() - start);
+            return *invoker;
+        }
+    }
+
+    MIOPEN_LOG_I2("No fallback for " << solver_id.ToString() << ", waiting for its build");
+    const auto invoker = pending.Wait(handle, key);
+    RecordLookup(&handle.GetLookupCounters(),
+                 LookupSource::CompileFallback,
+                 LookupEvent::Miss,
+                 std::chrono::steady_clock::now() - start);
+    return register_built(*invoker);
+}
+
 static void
 CompileSolution(solver::Id solver_id, ExecutionContext ctx, const conv::ProblemDescription& problem)
 {
@@ -595,7 +711,8 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
     // On regular path (find-db hit) this was checked during Find().
     Problem::ValidateGroupCount(xDesc, weightsDesc, *this);
 
-    auto interim = std::vector<miopenConvSolution_t>{};
+    const auto start = std::chrono::steady_clock::now();
+    auto interim     = std::vector<miopenConvSolution_t>{};
     interim.reserve(maxSolutionCount); // For speed. In most cases we have less entries than asked.
 
     // TunaNet Fallback
@@ -635,7 +752,8 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
 
     // WTI Fallback
     // if TunaNet is not enabled or produces no applicable solvers then fallback to WTI
-    if(interim.empty())
+    const auto is_ai_ranked = !interim.empty();
+    if(!is_ai_ranked)
     {
         MIOPEN_LOG_I2("Using WTI Fallback");
         const auto wti2time = [](const float& wti) {
@@ -645,6 +763,8 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
             return 10.0f / wti; // Assume WTI == 1.0 (100%) is 10 ms.
         };
 
+        const auto features = conv::GetProblemFeatures(ctx, problem);
+
         for(const auto& solver_id : solver::GetSolversByPrimitive(solver::Primitive::Convolution))
         {
             // solver_id is always valid here, because taken from registry.
@@ -654,7 +774,8 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
                 continue;
             const auto& s = solver_id.GetSolver();
             // Let's allow non-dynamic later, if necessary.
-            if(s.IsEmpty() || !s.IsDynamic() || !s.IsApplicable(ctx, problem))
+            if(s.IsEmpty() || !s.IsDynamic() ||
+               !conv::IsFeatureMatch(features, s.GetFeatureMask()) || !s.IsApplicable(ctx, problem))
                 continue;
             const auto ws = s.GetWorkspaceSize(ctx, problem);
             if(!conv::IsEnoughWorkspace("GetSolutionsFallback WTI", solver_id, ws, invokeParams))
@@ -674,6 +795,10 @@ ConvolutionDescriptor::GetSolutionsFallback(const ExecutionContext& ctx,
     std::sort(begin(interim), end(interim), SolutionTimeComparator{});
     interim.resize(std::min(maxSolutionCount, interim.size()));
 
+    RecordLookup(&ctx.GetStream().GetLookupCounters(),
+                 LookupSource::HeuristicFallback,
+                 is_ai_ranked ? LookupEvent::Hit : LookupEvent::Miss,
+                 std::chrono::steady_clock::now() - start);
     return interim;
 }
 
@@ -840,7 +965,7 @@ void ConvolutionDescriptor::ConvolutionForwardImmediate(Handle& handle,
         const auto problem =
             conv::ProblemDescription{xDesc, wDesc, yDesc, *this, conv::Direction::Forward};
         const auto ctx        = ExecutionContext{&handle};
-        const auto invoker    = LoadOrPrepareInvoker(ctx, problem, solver_id);
+        const auto invoker    = LoadOrPrepareInvokerAsync(ctx, problem, solver_id, workSpaceSize);
         const auto invoke_ctx = conv::DataInvokeParams{
             tensors, workSpace, workSpaceSize, this->attribute.gfx90aFp16alt.GetFwd()};
         invoker(handle, invoke_ctx);
@@ -1047,7 +1172,7 @@ void ConvolutionDescriptor::ConvolutionBackwardImmediate(Handle& handle,
         const auto problem =
             conv::ProblemDescription{dyDesc, wDesc, dxDesc, *this, conv::Direction::BackwardData};
         const auto ctx        = ExecutionContext{&handle};
-        const auto invoker    = LoadOrPrepareInvoker(ctx, problem, solver_id);
+        const auto invoker    = LoadOrPrepareInvokerAsync(ctx, problem, solver_id, workSpaceSize);
         const auto invoke_ctx = conv::DataInvokeParams{
             tensors, workSpace, workSpaceSize, this->attribute.gfx90aFp16alt.GetBwd()};
         invoker(handle, invoke_ctx);
@@ -1249,7 +1374,7 @@ void ConvolutionDescriptor::ConvolutionWrwImmediate(Handle& handle,
         const auto problem = conv::ProblemDescription{
             dyDesc, dwDesc, xDesc, *this, conv::Direction::BackwardWeights};
         const auto ctx        = ExecutionContext{&handle};
-        const auto invoker    = LoadOrPrepareInvoker(ctx, problem, solver_id);
+        const auto invoker    = LoadOrPrepareInvokerAsync(ctx, problem, solver_id, workSpaceSize);
         const auto invoke_ctx = conv::WrWInvokeParams{
             tensors, workSpace, workSpaceSize, this->attribute.gfx90aFp16alt.GetWrW()};
         invoker(handle, invoke_ctx);
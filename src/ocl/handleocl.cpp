@@ -27,7 +27,9 @@
 #include <miopen/handle.hpp>
 
 #include <miopen/binary_cache.hpp>
+#include <miopen/buffer_pool.hpp>
 #include <miopen/config.h>
+#include <miopen/db_prefetch.hpp>
 #include <miopen/env.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/handle_lock.hpp>
@@ -83,6 +85,8 @@ struct HandleImpl
     bool enable_profiling  = false;
     float profiling_result = 0.0;
     TargetProperties target_properties;
+    BufferPool buffer_pool;
+    LookupCounters lookup_counters;
 
     std::string get_device_name() const
     {
@@ -181,6 +185,7 @@ Handle::Handle(miopenAcceleratorQueue_t stream) : impl(new HandleImpl())
     this->SetAllocator(nullptr, nullptr, nullptr);
     this->impl->target_properties.Init(this);
     MIOPEN_LOG_NQI(*this);
+    PrefetchSystemDbs(*this);
 }
 
 static bool PrintOpenCLDeprecateMsg()
@@ -262,10 +267,16 @@ Handle::Handle() : impl(new HandleImpl())
     this->SetAllocator(nullptr, nullptr, nullptr);
     this->impl->target_properties.Init(this);
     MIOPEN_LOG_NQI(*this);
+    PrefetchSystemDbs(*this);
 }
 
 Handle::Handle(Handle&&) noexcept = default;
-Handle::~Handle()                 = default;
+
+Handle::~Handle()
+{
+    if(impl != nullptr)
+        DumpLookupCounters(*this);
+}
 
 void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
 {
@@ -288,6 +299,8 @@ void Handle::ReserveExtraStreamsInPool(int) const
 
 miopenAcceleratorQueue_t Handle::GetStream() const { return impl->queue.get(); }
 
+LookupCounters& Handle::GetLookupCounters() const { return impl->lookup_counters; }
+
 void Handle::SetAllocator(miopenAllocatorFunction allocator,
                           miopenDeallocatorFunction deallocator,
                           void* allocatorContext) const
@@ -301,6 +314,9 @@ void Handle::SetAllocator(miopenAllocatorFunction allocator,
 
     this->impl->allocator.context =
         allocatorContext == nullptr ? this->impl->context.get() : allocatorContext;
+
+    // Cached buffers belong to the previous allocator.
+    this->impl->buffer_pool.Trim();
 }
 
 void Handle::EnableProfiling(bool enable) const { this->impl->enable_profiling = enable; }
@@ -396,8 +412,11 @@ Program Handle::LoadProgram(const std::string& program_name,
     // Binary serialization is not supported on OpenCL anyway
     std::ignore = force_attach_binary;
 
-    auto hsaco = miopen::LoadBinary(
-        this->GetTargetProperties(), this->GetMaxComputeUnits(), program_name, params);
+    auto hsaco = miopen::LoadBinary(this->GetTargetProperties(),
+                                    this->GetMaxComputeUnits(),
+                                    program_name,
+                                    params,
+                                    &impl->lookup_counters);
     if(hsaco.empty())
     {
         CompileTimer ct;
@@ -413,12 +432,17 @@ Program Handle::LoadProgram(const std::string& program_name,
 #if MIOPEN_ENABLE_SQLITE_KERN_CACHE
         std::string binary;
         miopen::GetProgramBinary(p, binary);
-        miopen::SaveBinary(
-            binary, this->GetTargetProperties(), this->GetMaxComputeUnits(), program_name, params);
+        miopen::SaveBinary(binary,
+                           this->GetTargetProperties(),
+                           this->GetMaxComputeUnits(),
+                           program_name,
+                           params,
+                           &impl->lookup_counters);
 #else
         auto path = miopen::GetCachePath(false) / boost::filesystem::unique_path().string();
         miopen::SaveProgramBinary(p, path.string());
-        miopen::SaveBinary(path, this->GetTargetProperties(), program_name, params);
+        miopen::SaveBinary(
+            path, this->GetTargetProperties(), program_name, params, &impl->lookup_counters);
 #endif
         return p;
     }
@@ -436,21 +460,24 @@ Program Handle::LoadProgram(const std::string& program_name,
 
 void Handle::ClearProgram(const std::string& program_name, const std::string& params) const
 {
-    this->impl->cache.ClearProgram(program_name, params);
+    this->impl->cache.ClearProgram(*this, program_name, params);
 }
 
 bool Handle::HasProgram(const std::string& program_name, const std::string& params) const
 {
-    return this->impl->cache.HasProgram(program_name, params);
+    return this->impl->cache.HasProgram(*this, program_name, params);
 }
 
 void Handle::AddProgram(Program prog,
                         const std::string& program_name,
                         const std::string& params) const
 {
-    this->impl->cache.AddProgram(prog, program_name, params);
+    this->impl->cache.AddProgram(*this, prog, program_name, params);
 }
 
+// Programs belong to the OpenCL context, which is created for each handle.
+std::string Handle::GetProgramCacheScope() const { return {}; }
+
 void Handle::Finish() const { clFinish(this->GetStream()); }
 
 void Handle::Flush() const { clFlush(this->GetStream()); }
@@ -515,6 +542,13 @@ Allocator::ManageDataPtr Handle::Create(std::size_t sz) const
     return this->impl->allocator(sz);
 }
 
+Allocator::ManageDataPtr Handle::CreateCached(std::size_t sz) const
+{
+    return this->impl->buffer_pool.Get(this->impl->allocator, sz);
+}
+
+BufferPool& Handle::GetBufferPool() const { return this->impl->buffer_pool; }
+
 Allocator::ManageDataPtr&
 Handle::WriteTo(const void* data, Allocator::ManageDataPtr& ddata, std::size_t sz) const
 {
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/pending_invokers.hpp>
+
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace miopen {
+
+PendingInvokers::PendingInvokers(PendingInvokers&& other) noexcept
+{
+    other.WaitAll();
+    builds = std::move(other.builds);
+}
+
+PendingInvokers& PendingInvokers::operator=(PendingInvokers&& other) noexcept
+{
+    WaitAll();
+    other.WaitAll();
+    builds = std::move(other.builds);
+    return *this;
+}
+
+PendingInvokers::~PendingInvokers() { WaitAll(); }
+
+bool PendingInvokers::Start(const Handle& handle,
+                            const Key& key,
+                            const InvokerFactory& factory,
+                            const std::vector<solver::KernelInfo>& kernels)
+{
+    if(IsPending(key))
+        return true;
+
+    auto missing = std::vector<solver::KernelInfo>{};
+    for(const auto& kernel : kernels)
+    {
+        if(handle.HasProgram(kernel.kernel_file, kernel.comp_options))
+            continue;
+        const auto duplicate = std::any_of(missing.begin(), missing.end(), [&](const auto& k) {
+            return k.kernel_file == kernel.kernel_file && k.comp_options == kernel.comp_options;
+        });
+        if(!duplicate)
+            missing.push_back(kernel);
+    }
+
+    if(missing.empty())
+        return false;
+
+    MIOPEN_LOG_I2("Building " << missing.size() << " program(s) in the background for "
+                              << key.first << " and solver " << key.second);
+
+    // Only the programs are built in the background. They are added to the program cache of the
+    // handle on the calling thread, as PrecompileSolutions() does.
+    auto programs = std::async(std::launch::async, [&handle, missing]() {
+        return solver::PrecompileKernels(handle, missing);
+    });
+
+    builds.emplace(key, Build{factory, kernels, std::move(missing), std::move(programs)});
+    return true;
+}
+
+std::optional<Invoker> PendingInvokers::Take(const Handle& handle, const Key& key)
+{
+    const auto build = builds.find(key);
+    if(build == builds.end())
+        return std::nullopt;
+    if(build->second.programs.wait_for(std::chrono::seconds{0}) != std::future_status::ready)
+        return std::nullopt;
+    return Finish(handle, build);
+}
+
+std::optional<Invoker> PendingInvokers::Wait(const Handle& handle, const Key& key)
+{
+    const auto build = builds.find(key);
+    if(build == builds.end())
+        return std::nullopt;
+    return Finish(handle, build);
+}
+
+void PendingInvokers::WaitAll() const
+{
+    for(const auto& build : builds)
+        build.second.programs.wait();
+}
+
+Invoker PendingInvokers::Finish(const Handle& handle, std::map<Key, Build>::iterator build)
+{
+    // The build is forgotten before getting the programs, so its errors are only thrown once.
+    auto finished = std::move(build->second);
+    builds.erase(build);
+
+    const auto programs = finished.programs.get();
+    for(std::size_t i = 0; i < programs.size(); ++i)
+    {
+        const auto& kernel = finished.built[i];
+        if(!handle.HasProgram(kernel.kernel_file, kernel.comp_options))
+            handle.AddProgram(programs[i], kernel.kernel_file, kernel.comp_options);
+    }
+
+    MIOPEN_LOG_I2("Background build of " << programs.size() << " program(s) has finished");
+    return handle.PrepareInvoker(finished.factory, finished.kernels);
+}
+
+} // namespace miopen
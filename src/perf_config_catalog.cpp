@@ -0,0 +1,216 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/perf_config_catalog.hpp>
+
+#include <miopen/db.hpp>
+#include <miopen/db_path.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/md5.hpp>
+#include <miopen/stringutils.hpp>
+#include <miopen/version.h>
+
+#include <fstream>
+#include <system_error>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_PERF_CONFIG_CATALOG)
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_PERF_CONFIG_CATALOG_PATH)
+
+namespace miopen {
+namespace solver {
+
+namespace {
+
+// Validity rules change between releases, so entries of other versions are ignored.
+const std::string& CatalogVersion()
+{
+    static const std::string version = std::to_string(MIOPEN_VERSION_MAJOR)       //
+                                       + "." + std::to_string(MIOPEN_VERSION_MINOR) //
+                                       + "." + std::to_string(MIOPEN_VERSION_PATCH) //
+                                       + "." + MIOPEN_STRINGIZE(MIOPEN_VERSION_TWEAK);
+    return version;
+}
+
+} // namespace
+
+PerfConfigCatalogEntry::PerfConfigCatalogEntry(bool spare_, std::vector<std::string> configs_)
+    : spare(spare_), configs(std::move(configs_)), index(configs.begin(), configs.end())
+{
+}
+
+PerfConfigCatalog::PerfConfigCatalog(fs::path dir_) : dir(std::move(dir_)) {}
+
+fs::path PerfConfigCatalog::FilePath(const std::string& key) const
+{
+    return dir / (md5(key) + ".txt");
+}
+
+std::shared_ptr<const PerfConfigCatalogEntry> PerfConfigCatalog::Load(const std::string& key) const
+{
+    if(dir.empty())
+        return nullptr;
+
+    // Files are replaced with a rename, so a reader never sees a partially written one.
+    auto in      = std::ifstream{FilePath(key)};
+    auto version = std::string{};
+    auto stored  = std::string{};
+    auto set     = std::string{};
+
+    if(!std::getline(in, version) || !std::getline(in, stored) || !std::getline(in, set))
+        return nullptr;
+    if(version != CatalogVersion() || stored != key || (set != "primary" && set != "spare"))
+    {
+        MIOPEN_LOG_I2("Stale perf config catalog entry for " << key << ": " << FilePath(key));
+        return nullptr;
+    }
+
+    auto configs = std::vector<std::string>{};
+    for(auto line = std::string{}; std::getline(in, line);)
+    {
+        if(!line.empty())
+            configs.emplace_back(std::move(line));
+    }
+
+    return std::make_shared<const PerfConfigCatalogEntry>(set == "spare", std::move(configs));
+}
+
+void PerfConfigCatalog::Save(const std::string& key, const PerfConfigCatalogEntry& entry) const
+{
+    const auto file = FilePath(key);
+    const auto tmp  = fs::path{file.string() + ".tmp"};
+
+    if(!fs::exists(dir))
+        fs::create_directories(dir);
+
+    std::lock_guard<LockFile> lock(LockFile::Get(file.string() + ".lock"));
+    {
+        auto out = std::ofstream{tmp, std::ios::trunc};
+        out << CatalogVersion() << '\n'
+            << key << '\n'
+            << (entry.IsSpare() ? "spare" : "primary") << '\n';
+        for(const auto& config : entry.Configs())
+            out << config << '\n';
+        if(!out)
+            MIOPEN_THROW("Failed to write perf config catalog: " + tmp);
+    }
+    fs::rename(tmp, file);
+}
+
+std::shared_ptr<const PerfConfigCatalogEntry> PerfConfigCatalog::Find(const std::string& key)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        const auto it = entries.find(key);
+        if(it != entries.end())
+            return it->second;
+    }
+
+    auto entry = Load(key);
+    if(entry == nullptr)
+        return nullptr;
+
+    MIOPEN_LOG_I2("Loaded " << entry->Configs().size() << " perf configs of " << key);
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.emplace(key, std::move(entry)).first->second;
+}
+
+std::shared_ptr<const PerfConfigCatalogEntry>
+PerfConfigCatalog::Store(const std::string& key, PerfConfigCatalogEntry entry)
+{
+    auto stored = std::make_shared<const PerfConfigCatalogEntry>(std::move(entry));
+
+    // The entry is still used by this process if it cannot be shared, e.g. on a read-only
+    // file system.
+    if(!dir.empty())
+    {
+        try
+        {
+            Save(key, *stored);
+        }
+        catch(const std::exception& ex)
+        {
+            MIOPEN_LOG_W("Failed to save perf config catalog entry for " << key << ": "
+                                                                          << ex.what());
+        }
+    }
+
+    MIOPEN_LOG_I2("Stored " << stored->Configs().size() << " perf configs of " << key);
+    std::lock_guard<std::mutex> lock(mutex);
+    entries[key] = stored;
+    return stored;
+}
+
+void PerfConfigCatalog::Remove(const std::string& key)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.erase(key);
+    }
+
+    if(dir.empty())
+        return;
+
+    // As in Store, the catalog directory may be read-only. The entry is then enumerated again
+    // by every process, which is slower but correct.
+    const auto file = FilePath(key);
+    auto ec         = std::error_code{};
+    try
+    {
+        std::lock_guard<LockFile> lock(LockFile::Get(file.string() + ".lock"));
+        fs::remove(file, ec);
+    }
+    catch(const std::exception& ex)
+    {
+        MIOPEN_LOG_W("Failed to remove perf config catalog entry for " << key << ": "
+                                                                        << ex.what());
+        return;
+    }
+    if(ec)
+        MIOPEN_LOG_W("Failed to remove perf config catalog entry for " << key << ": "
+                                                                        << ec.message());
+}
+
+PerfConfigCatalog* GetPerfConfigCatalog()
+{
+    if(env::disabled(MIOPEN_DEBUG_PERF_CONFIG_CATALOG))
+        return nullptr;
+
+    static auto catalog = [] {
+        const auto& path = env::value(MIOPEN_PERF_CONFIG_CATALOG_PATH);
+        if(!path.empty())
+            return PerfConfigCatalog{path};
+        if constexpr(DisableUserDbFileIO)
+            return PerfConfigCatalog{fs::path{}};
+        else
+            return PerfConfigCatalog{GetUserDbPath() / "perf_config_catalog"};
+    }();
+    return &catalog;
+}
+
+} // namespace solver
+} // namespace miopen
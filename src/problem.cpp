@@ -135,7 +135,7 @@ static Data_t AllocateTensor(Handle& handle,
         return &owned_scalars.emplace_back(0);
 
     const auto element_size = get_data_size(descriptor.GetType());
-    auto buffer             = handle.Create(descriptor.GetElementSpace() * element_size);
+    auto buffer             = handle.CreateCached(descriptor.GetElementSpace() * element_size);
 
     const auto allocated = buffer.get();
     owned.emplace_back(std::move(buffer));
@@ -502,8 +502,9 @@ std::vector<Solution> Problem::FindSolutionsImpl(Handle& handle,
         auto tmp_ctx             = ExecutionContext{&handle};
         const auto workspace_max = conv_desc.GetWorkSpaceSize(tmp_ctx, conv_problem);
         workspace_size           = std::min(options.workspace_limit, workspace_max);
-        owned_workspace          = workspace_size != 0 ? handle.Create(workspace_size) : nullptr;
-        workspace                = owned_workspace.get();
+        if(workspace_size != 0)
+            owned_workspace = handle.CreateCached(workspace_size);
+        workspace = owned_workspace.get();
     }
 
     auto ctx = ExecutionContext{&handle};
@@ -28,6 +28,17 @@
 #include <miopen/process.hpp>
 #include <string_view>
 
+#ifndef _WIN32
+#include <array>
+#include <algorithm>
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 namespace miopen {
 
 #ifdef _WIN32
@@ -99,6 +110,11 @@ public:
         return status;
     }
 
+    int Pipe(std::string_view, std::string_view, std::string_view, std::vector<char>&)
+    {
+        MIOPEN_THROW("Piping input and output not defined for Windows.");
+    }
+
 private:
     fs::path path;
     PROCESS_INFORMATION processInfo{};
@@ -154,7 +170,126 @@ struct ProcessImpl
         return WEXITSTATUS(status);
     }
 
+    int Pipe(std::string_view args,
+             std::string_view cwd,
+             std::string_view input,
+             std::vector<char>& output)
+    {
+        std::string cmd{path.string()};
+        if(!args.empty())
+            cmd += " " + std::string{args};
+        if(!cwd.empty())
+            cmd.insert(0, "cd " + std::string{cwd} + "; ");
+
+        // The input channel is a socket rather than a pipe: send() with MSG_NOSIGNAL lets us
+        // detect a child that exits without reading its input instead of getting SIGPIPE.
+        // Both are close-on-exec, otherwise children started by other threads meanwhile would
+        // inherit them and keep our output pipe open until they exit.
+        int in_fds[2];
+        int out_fds[2];
+        if(socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, in_fds) != 0)
+            MIOPEN_THROW("Error: socketpair()");
+        if(pipe2(out_fds, O_CLOEXEC) != 0)
+        {
+            close(in_fds[0]);
+            close(in_fds[1]);
+            MIOPEN_THROW("Error: pipe()");
+        }
+
+        const auto pid = fork();
+        if(pid == 0)
+        {
+            // Only async-signal-safe calls are allowed until exec. The copies made by dup2() are
+            // not close-on-exec, the rest of the descriptors are closed by exec.
+            RedirectFd(in_fds[1], STDIN_FILENO);
+            RedirectFd(out_fds[1], STDOUT_FILENO);
+            execl("/bin/sh", "sh", "-c", cmd.c_str(), static_cast<char*>(nullptr));
+            _exit(127);
+        }
+
+        close(in_fds[1]);
+        close(out_fds[1]);
+        if(pid < 0)
+        {
+            close(in_fds[0]);
+            close(out_fds[0]);
+            MIOPEN_THROW("Error: fork()");
+        }
+
+        // Writing and reading are interleaved, otherwise a child which produces output before
+        // consuming all of its input would deadlock with us once both buffers fill up.
+        int to_child   = in_fds[0];
+        int from_child = out_fds[0];
+        fcntl(to_child, F_SETFL, fcntl(to_child, F_GETFL) | O_NONBLOCK);
+        if(input.empty())
+            shutdown(to_child, SHUT_WR);
+
+        std::array<char, 64 * 1024> buffer{};
+        std::size_t written = 0;
+        output.clear();
+
+        while(from_child >= 0)
+        {
+            std::array<pollfd, 2> fds{};
+            fds[0] = {from_child, POLLIN, 0};
+            fds[1] = {written < input.size() ? to_child : -1, POLLOUT, 0};
+
+            if(poll(fds.data(), fds.size(), -1) < 0)
+            {
+                if(errno == EINTR)
+                    continue;
+                break;
+            }
+
+            if(fds[1].revents != 0)
+            {
+                const auto chunk = std::min(input.size() - written, buffer.size());
+                const auto sent  = send(to_child, input.data() + written, chunk, MSG_NOSIGNAL);
+                if(sent > 0)
+                    written += sent;
+                else if(errno != EAGAIN && errno != EINTR)
+                    written = input.size(); // The child does not want the rest of the input.
+                if(written == input.size())
+                    shutdown(to_child, SHUT_WR);
+            }
+
+            if(fds[0].revents != 0)
+            {
+                const auto received = read(from_child, buffer.data(), buffer.size());
+                if(received > 0)
+                {
+                    output.insert(output.end(), buffer.data(), buffer.data() + received);
+                }
+                else if(received == 0 || (errno != EAGAIN && errno != EINTR))
+                {
+                    close(from_child);
+                    from_child = -1;
+                }
+            }
+        }
+
+        if(from_child >= 0)
+            close(from_child);
+        close(to_child);
+
+        int status = 0;
+        while(waitpid(pid, &status, 0) < 0)
+        {
+            if(errno != EINTR)
+                MIOPEN_THROW("Error: waitpid()");
+        }
+        return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    }
+
 private:
+    static void RedirectFd(int fd, int target)
+    {
+        if(fd == target)
+            fcntl(fd, F_SETFD, fcntl(fd, F_GETFD) & ~FD_CLOEXEC);
+        else
+            dup2(fd, target);
+    }
+
     std::ostream* outStream;
     fs::path path;
     FILE* pipe = nullptr;
@@ -175,6 +310,14 @@ int Process::operator()(std::string_view args,
     return impl->Wait();
 }
 
+int Process::Pipe(std::string_view args,
+                  const fs::path& cwd,
+                  std::string_view input,
+                  std::vector<char>& output)
+{
+    return impl->Pipe(args, cwd.string(), input, output);
+}
+
 ProcessAsync::ProcessAsync(const fs::path& cmd,
                            std::string_view args,
                            const fs::path& cwd,
@@ -26,7 +26,9 @@
 
 #include <miopen/ramdb.hpp>
 
+#include <miopen/db_text_parser.hpp>
 #include <miopen/errors.hpp>
+#include <miopen/load_file.hpp>
 #include <miopen/lock_file.hpp>
 #include <miopen/logger.hpp>
 
@@ -58,7 +60,7 @@ static ramdb_clock::time_point GetDbModificationTime(const fs::path& path)
     return ramdb_clock::time_point{ramdb_clock::duration{time}};
 }
 
-static void UpdateDbModificationTime(const fs::path& path)
+void RamDb::UpdateModificationTime(const fs::path& path)
 {
     MIOPEN_LOG_I2("Updating db modification time for " << path);
 
@@ -127,7 +129,10 @@ boost::optional<DbRecord> RamDb::FindRecord(const std::string& problem)
         Prefetch();
     }
 
-    return FindRecordUnsafe(problem);
+    auto record = FindRecordUnsafe(problem);
+    if(auto* const journal = GetJournal())
+        return journal->Apply(problem, std::move(record));
+    return record;
 }
 
 bool RamDb::StoreRecord(const DbRecord& record)
@@ -135,6 +140,13 @@ bool RamDb::StoreRecord(const DbRecord& record)
     const auto& key = record.GetKey();
     MIOPEN_LOG_I2("Trying to store record at key " << key << " in cache for file "
                                                    << GetFileName());
+
+    if(auto* const journal = GetJournal())
+    {
+        journal->Store(record);
+        return true;
+    }
+
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
 
@@ -142,7 +154,7 @@ bool RamDb::StoreRecord(const DbRecord& record)
     {
         if(!StoreRecordUnsafe(record))
             return false;
-        UpdateDbModificationTime(GetFileName());
+        UpdateModificationTime(GetFileName());
     }
 
 #if MIOPEN_DB_CACHE_WRITE_THROUGH
@@ -158,6 +170,16 @@ bool RamDb::UpdateRecord(DbRecord& record)
     const auto& key = record.GetKey();
     MIOPEN_LOG_I2("Trying to update record at key " << key << " in cache for file "
                                                     << GetFileName());
+
+    if(auto* const journal = GetJournal())
+    {
+        const auto old_record = FindRecord(key);
+        journal->Update(record);
+        if(old_record)
+            record.Merge(*old_record);
+        return true;
+    }
+
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
 
@@ -165,7 +187,7 @@ bool RamDb::UpdateRecord(DbRecord& record)
     {
         if(!UpdateRecordUnsafe(record))
             return false;
-        UpdateDbModificationTime(GetFileName());
+        UpdateModificationTime(GetFileName());
     }
 
 #if MIOPEN_DB_CACHE_WRITE_THROUGH
@@ -180,6 +202,13 @@ bool RamDb::RemoveRecord(const std::string& key)
 {
     MIOPEN_LOG_I2("Trying to remove record at key " << key << " from cache for file "
                                                     << GetFileName());
+
+    if(auto* const journal = GetJournal())
+    {
+        journal->Remove(key);
+        return true;
+    }
+
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
 
@@ -191,7 +220,7 @@ bool RamDb::RemoveRecord(const std::string& key)
     {
         if(!RemoveRecordUnsafe(key))
             return false;
-        UpdateDbModificationTime(GetFileName());
+        UpdateModificationTime(GetFileName());
     }
 
 #if MIOPEN_DB_CACHE_WRITE_THROUGH
@@ -211,6 +240,16 @@ bool RamDb::Remove(const std::string& key, const std::string& id)
 {
     MIOPEN_LOG_I2("Trying to remove value at key " << key << " and id " << id
                                                    << " from cache for file " << GetFileName());
+
+    if(auto* const journal = GetJournal())
+    {
+        auto record = FindRecord(key);
+        if(!record || !record->EraseValues(id))
+            return false;
+        journal->Store(*record);
+        return true;
+    }
+
     const auto lock = exclusive_lock(GetLockFile(), GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
 
@@ -227,7 +266,7 @@ bool RamDb::Remove(const std::string& key, const std::string& id)
     {
         if(!StoreRecordUnsafe(*record))
             return false;
-        UpdateDbModificationTime(GetFileName());
+        UpdateModificationTime(GetFileName());
     }
 
 #if MIOPEN_DB_CACHE_WRITE_THROUGH
@@ -318,31 +357,8 @@ void RamDb::Prefetch()
         }
 
         cache.clear();
-        auto line   = std::string{};
-        auto n_line = 0;
-
-        while(std::getline(file, line))
-        {
-            ++n_line;
-
-            if(line.empty())
-                continue;
-
-            const auto key_size = line.find('=');
-            const bool is_key   = (key_size != std::string::npos && key_size != 0);
-
-            if(!is_key)
-            {
-                MIOPEN_LOG_E("Ill-formed record: key not found: " << GetFileName() << "#"
-                                                                  << n_line);
-                continue;
-            }
-
-            const auto key      = line.substr(0, key_size);
-            const auto contents = line.substr(key_size + 1);
-
-            cache.emplace(key, CacheItem{n_line, contents});
-        }
+        const auto mapped = MappedFile{GetFileName()};
+        ParseTextDb(mapped.view(), GetFileName(), cache);
 
         file_read_time = ramdb_clock::now();
     });
@@ -354,7 +370,7 @@ void RamDb::UpdateCacheEntryUnsafe(const DbRecord& record)
     const auto is_valid = ValidateUnsafe();
 
     if constexpr(!DisableUserDbFileIO)
-        UpdateDbModificationTime(GetFileName());
+        UpdateModificationTime(GetFileName());
 
     if(is_valid)
     {
@@ -25,6 +25,8 @@
  *******************************************************************************/
 
 #include <miopen/readonlyramdb.hpp>
+#include <miopen/db_text_parser.hpp>
+#include <miopen/load_file.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/errors.hpp>
 #include <miopen/filesystem.hpp>
@@ -33,9 +35,11 @@
 #include <miopen_data.hpp>
 #endif
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
+#include <future>
 #include <mutex>
-#include <sstream>
 #include <map>
 
 namespace miopen {
@@ -51,6 +55,21 @@ bool& rordb_embed_fs_override()
 
 ReadonlyRamDb&
 ReadonlyRamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool warn_if_unreadable)
+{
+    auto& instance = GetInstance(db_kind_, path, warn_if_unreadable, false);
+    instance.WaitForPrefetch();
+    return instance;
+}
+
+void ReadonlyRamDb::PrefetchAsync(DbKinds db_kind_, const fs::path& path, bool warn_if_unreadable)
+{
+    GetInstance(db_kind_, path, warn_if_unreadable, true);
+}
+
+ReadonlyRamDb& ReadonlyRamDb::GetInstance(DbKinds db_kind_,
+                                          const fs::path& path,
+                                          bool warn_if_unreadable,
+                                          bool async)
 {
     // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
     static std::mutex mutex;
@@ -66,10 +85,42 @@ ReadonlyRamDb::GetCached(DbKinds db_kind_, const fs::path& path, bool warn_if_un
 
     auto& instance =
         *instances.emplace(path, std::make_unique<ReadonlyRamDb>(db_kind_, path)).first->second;
-    instance.Prefetch(warn_if_unreadable);
+
+    if(!async)
+    {
+        instance.Prefetch(warn_if_unreadable);
+        return instance;
+    }
+
+    instance.loading = std::async(std::launch::async, [&instance, warn_if_unreadable]() {
+                           const auto start = std::chrono::steady_clock::now();
+                           instance.Prefetch(warn_if_unreadable);
+                           instance.load_time = std::chrono::steady_clock::now() - start;
+                       }).share();
     return instance;
 }
 
+void ReadonlyRamDb::WaitForPrefetch()
+{
+    if(!loading.valid())
+        return;
+
+    const auto start = std::chrono::steady_clock::now();
+    loading.wait();
+    const auto waited = std::chrono::duration<double, std::milli>{
+        std::chrono::steady_clock::now() - start};
+
+    std::call_once(load_reported, [&]() {
+        const auto hidden = std::max(load_time - waited, decltype(waited){});
+        MIOPEN_LOG_I("Background load of " << db_path << " took " << load_time.count()
+                                           << " ms, first lookup waited " << waited.count()
+                                           << " ms, " << hidden.count() << " ms hidden");
+    });
+
+    // Rethrows the loading error, if any, on every lookup just like the synchronous path would.
+    loading.get();
+}
+
 template <class TFunc>
 static auto Measure(const std::string& funcName, TFunc&& func)
 {
@@ -83,41 +134,7 @@ static auto Measure(const std::string& funcName, TFunc&& func)
                                    << " ms");
 }
 
-void ReadonlyRamDb::ParseAndLoadDb(std::istream& input_stream, bool warn_if_unreadable)
-{
-    if(!input_stream)
-    {
-        const auto log_level = (warn_if_unreadable && !MIOPEN_DISABLE_SYSDB) ? LoggingLevel::Warning
-                                                                             : LoggingLevel::Info;
-        MIOPEN_LOG(log_level, "File is unreadable: " << db_path);
-        return;
-    }
-
-    auto line   = std::string{};
-    auto n_line = 0;
-
-    while(std::getline(input_stream, line))
-    {
-        ++n_line;
-
-        if(line.empty())
-            continue;
-
-        const auto key_size = line.find('=');
-        const bool is_key   = (key_size != std::string::npos && key_size != 0);
-
-        if(!is_key)
-        {
-            MIOPEN_LOG_E("Ill-formed record: key not found: " << db_path << "#" << n_line);
-            continue;
-        }
-
-        const auto key      = line.substr(0, key_size);
-        const auto contents = line.substr(key_size + 1);
-
-        cache.emplace(key, CacheItem{n_line, contents});
-    }
-}
+void ReadonlyRamDb::ParseAndLoadDb(std::string_view text) { ParseTextDb(text, db_path, cache); }
 
 void ReadonlyRamDb::Prefetch(bool warn_if_unreadable)
 {
@@ -139,14 +156,22 @@ void ReadonlyRamDb::Prefetch(bool warn_if_unreadable)
             const auto& p = it_p->second;
             ptrdiff_t sz  = p.second - p.first;
             MIOPEN_LOG_I2("Loading In Memory file: " << filepath);
-            auto input_stream = std::stringstream(std::string(p.first, sz));
-            ParseAndLoadDb(input_stream, warn_if_unreadable);
+            ParseAndLoadDb(std::string_view(p.first, sz));
 #endif
         }
         else
         {
-            auto input_stream = std::ifstream{db_path};
-            ParseAndLoadDb(input_stream, warn_if_unreadable);
+            if(!std::ifstream{db_path})
+            {
+                const auto log_level = (warn_if_unreadable && !MIOPEN_DISABLE_SYSDB)
+                                           ? LoggingLevel::Warning
+                                           : LoggingLevel::Info;
+                MIOPEN_LOG(log_level, "File is unreadable: " << db_path);
+                return;
+            }
+
+            const auto file = MappedFile{db_path};
+            ParseAndLoadDb(file.view());
         }
     });
 }
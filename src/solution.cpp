@@ -31,6 +31,8 @@
 #include <miopen/conv/data_invoke_params.hpp>
 #include <miopen/conv/wrw_invoke_params.hpp>
 #include <miopen/kernel.hpp>
+#include <miopen/load_file.hpp>
+#include <miopen/md5.hpp>
 
 #include <miopen/mha/invoke_params.hpp>
 #include <miopen/mha/problem_description.hpp>
@@ -209,12 +211,17 @@ void Solution::RunImpl(Handle& handle,
         }
     };
 
+    PrepareConvInvoker(handle, problem_, invoke_ctx);
+    (*invoker)(handle, invoke_ctx);
+    checkNumericsOutput_();
+}
+
+void Solution::PrepareConvInvoker(Handle& handle,
+                                  const Problem& problem_,
+                                  const AnyInvokeParams& invoke_ctx)
+{
     if(invoker)
-    {
-        (*invoker)(handle, invoke_ctx);
-        checkNumericsOutput_();
         return;
-    }
 
     const auto conv_problem = problem_.AsConvolution();
 
@@ -227,21 +234,14 @@ void Solution::RunImpl(Handle& handle,
         auto kernel_handles = std::vector<Kernel>{std::begin(kernels), std::end(kernels)};
 
         invoker = invoker_factory(kernel_handles);
-        (*invoker)(handle, invoke_ctx);
-        checkNumericsOutput_();
         return;
     }
 
-    const auto net_cfg       = conv_problem.BuildConfKey();
-    const auto found_invoker = handle.GetInvoker(net_cfg, GetSolver());
+    const auto net_cfg = conv_problem.BuildConfKey();
+    invoker            = handle.GetInvoker(net_cfg, GetSolver());
 
-    if(found_invoker)
-    {
-        invoker = *found_invoker;
-        (*found_invoker)(handle, invoke_ctx);
-        checkNumericsOutput_();
+    if(invoker)
         return;
-    }
 
     auto conv_ctx = ExecutionContext{&handle};
     conv_problem.SetupFloats(conv_ctx);
@@ -253,8 +253,141 @@ void Solution::RunImpl(Handle& handle,
     invoker =
         handle.PrepareInvoker(*conv_solution.invoker_factory, conv_solution.construction_params);
     handle.RegisterInvoker(*invoker, net_cfg, GetSolver().ToString());
-    (*invoker)(handle, invoke_ctx);
-    checkNumericsOutput_();
+}
+
+BoundSolution Solution::Bind(Handle& handle,
+                             const std::vector<miopenTensorArgumentId_t>& arguments,
+                             const std::unordered_map<miopenTensorArgumentId_t, RunInput>& inputs)
+{
+    const auto* problem_casted = std::get_if<Problem>(&problem.item);
+    const auto* conv_desc =
+        problem_casted == nullptr
+            ? nullptr
+            : std::get_if<ConvolutionDescriptor>(&problem_casted->GetOperatorDescriptor());
+
+    if(conv_desc == nullptr)
+        MIOPEN_THROW(miopenStatusNotImplemented, "Only convolution solutions can be bound.");
+
+    const auto get_input_checked = [&](auto name, const std::string& name_str) {
+        const auto& found = inputs.find(name);
+        if(found == inputs.end())
+        {
+            MIOPEN_THROW(miopenStatusInvalidValue,
+                         "Problem is missing " + name_str + " tensor descriptor.");
+        }
+        auto ret = found->second;
+        if(!ret.descriptor.has_value())
+            ret.descriptor = problem_casted->GetTensorDescriptorChecked(name, name_str);
+        return ret;
+    };
+
+    const auto get_slot = [&](auto name, const std::string& name_str) {
+        const auto found = std::find(arguments.begin(), arguments.end(), name);
+        if(found == arguments.end())
+            MIOPEN_THROW(miopenStatusInvalidValue, "Missing " + name_str + " argument.");
+        return std::distance(arguments.begin(), found);
+    };
+
+    auto x       = get_input_checked(miopenTensorConvolutionX, "miopenTensorConvolutionX");
+    const auto w = get_input_checked(miopenTensorConvolutionW, "miopenTensorConvolutionW");
+    auto y       = get_input_checked(miopenTensorConvolutionY, "miopenTensorConvolutionY");
+
+    auto x_slot       = get_slot(miopenTensorConvolutionX, "miopenTensorConvolutionX");
+    const auto w_slot = get_slot(miopenTensorConvolutionW, "miopenTensorConvolutionW");
+    auto y_slot       = get_slot(miopenTensorConvolutionY, "miopenTensorConvolutionY");
+
+    const auto problem_ = conv_desc->mode == miopenTranspose
+                              ? Transpose(*problem_casted, &x, w, &y)
+                              : *problem_casted;
+    if(conv_desc->mode == miopenTranspose)
+        std::swap(x_slot, y_slot);
+
+    if(problem_.GetDirection() == miopenProblemDirectionBackward &&
+       y.descriptor->GetLengths()[1] != w.descriptor->GetLengths()[0])
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+
+    Problem::ValidateGroupCount(*x.descriptor, *w.descriptor, *conv_desc);
+
+    auto invoke_ctx = MakeInvokeParams(problem_, *conv_desc, x, w, y, nullptr, 0);
+    PrepareConvInvoker(handle, problem_, invoke_ctx);
+
+    const auto patch = [&]() -> BoundSolution::Patch {
+        switch(problem_.GetDirection())
+        {
+        case miopenProblemDirectionForward:
+            return [=](auto& params, auto buffers, auto workspace, auto workspace_size) {
+                auto& data         = params.template CastTo<conv::DataInvokeParams>();
+                data.tensors.in    = buffers[x_slot];
+                data.tensors.w     = buffers[w_slot];
+                data.tensors.out   = buffers[y_slot];
+                data.workSpace     = workspace;
+                data.workSpaceSize = workspace_size;
+            };
+        case miopenProblemDirectionBackward:
+            return [=](auto& params, auto buffers, auto workspace, auto workspace_size) {
+                auto& data         = params.template CastTo<conv::DataInvokeParams>();
+                data.tensors.in    = buffers[y_slot];
+                data.tensors.w     = buffers[w_slot];
+                data.tensors.out   = buffers[x_slot];
+                data.workSpace     = workspace;
+                data.workSpaceSize = workspace_size;
+            };
+        case miopenProblemDirectionBackwardWeights:
+            return [=](auto& params, auto buffers, auto workspace, auto workspace_size) {
+                auto& data         = params.template CastTo<conv::WrWInvokeParams>();
+                data.tensors.dy    = buffers[y_slot];
+                data.tensors.x     = buffers[x_slot];
+                data.tensors.dw    = buffers[w_slot];
+                data.workSpace     = workspace;
+                data.workSpaceSize = workspace_size;
+            };
+        default: MIOPEN_THROW(miopenStatusNotImplemented);
+        }
+    }();
+
+    return {arguments, *invoker, std::move(invoke_ctx), patch, workspace_required};
+}
+
+BoundSolution::BoundSolution(std::vector<miopenTensorArgumentId_t> arguments_,
+                             Invoker invoker_,
+                             AnyInvokeParams invoke_params_,
+                             Patch patch_,
+                             std::size_t workspace_required_)
+    : arguments(std::move(arguments_)),
+      invoker(std::move(invoker_)),
+      invoke_params(std::move(invoke_params_)),
+      patch(std::move(patch_)),
+      workspace_required(workspace_required_)
+{
+}
+
+void BoundSolution::Run(Handle& handle,
+                        const Data_t* buffers,
+                        std::size_t buffers_count,
+                        Data_t workspace,
+                        std::size_t workspace_size) const
+{
+    if(buffers_count != arguments.size())
+    {
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "Bound solution expects " + std::to_string(arguments.size()) +
+                         " buffers, while " + std::to_string(buffers_count) + " were provided");
+    }
+
+    if(workspace_size < workspace_required)
+    {
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "Bound solution requires at least " + std::to_string(workspace_required) +
+                         " workspace, while " + std::to_string(workspace_size) +
+                         " was provided");
+    }
+
+    // The bound solution may be run from several threads, so the buffers go into a copy.
+    auto params = invoke_params;
+    patch(params, buffers, workspace, workspace_size);
+    invoker(handle, params);
 }
 
 void Solution::RunImpl(Handle& handle,
@@ -731,29 +864,30 @@ struct SerializedSolutionKernelInfo
     }
 };
 
-void to_json(nlohmann::json& json, const Solution& solution)
+std::vector<Program> Solution::SerializeMetadata(nlohmann::json& json) const
 {
     json = nlohmann::json{
         {fields::Header, Solution::SerializationMetadata::Current()},
-        {fields::Time, solution.time},
-        {fields::Workspace, solution.workspace_required},
-        {fields::Solver, solution.solver.ToString()},
-        {fields::Problem, solution.problem},
+        {fields::Time, time},
+        {fields::Workspace, workspace_required},
+        {fields::Solver, solver.ToString()},
+        {fields::Problem, problem},
     };
 
-    if(solution.perf_cfg.has_value())
-        json[fields::PerfCfg] = *solution.perf_cfg;
+    if(perf_cfg.has_value())
+        json[fields::PerfCfg] = *perf_cfg;
 
-    if(solution.kernels.empty())
+    if(kernels.empty())
     {
         MIOPEN_LOG_I2("Solution lacks kernels information. This would slowdown the first "
                       "miopenRunSolution call after miopenLoadSolution.");
-        return;
+        return {};
     }
 
     {
-        const auto& first_program = solution.kernels.front().program;
-        if(!first_program.IsCodeObjectInMemory() && !first_program.IsCodeObjectInFile())
+        const auto& first_program = kernels.front().program;
+        if(!first_program.IsCodeObjectInMemory() && !first_program.IsCodeObjectInFile() &&
+           !first_program.IsCodeObjectMapped())
             MIOPEN_THROW(miopenStatusInvalidValue,
                          "Subsequent serialization of a deserialized solution is not supported.");
     }
@@ -761,8 +895,8 @@ void to_json(nlohmann::json& json, const Solution& solution)
     auto programs         = std::vector<Program>{};
     auto prepared_kernels = std::vector<SerializedSolutionKernelInfo>{};
 
-    std::transform(solution.kernels.begin(),
-                   solution.kernels.end(),
+    std::transform(kernels.begin(),
+                   kernels.end(),
                    std::back_inserter(programs),
                    [](const Solution::KernelInfo& sol) { return sol.program; });
 
@@ -770,7 +904,7 @@ void to_json(nlohmann::json& json, const Solution& solution)
     std::sort(programs.begin(), programs.end(), sorter);
     programs.erase(std::unique(programs.begin(), programs.end()), programs.end());
 
-    for(const auto& kernel : solution.kernels)
+    for(const auto& kernel : kernels)
     {
         const auto program_it        = std::find(programs.begin(), programs.end(), kernel.program);
         auto prepared_kernel         = SerializedSolutionKernelInfo{};
@@ -783,7 +917,16 @@ void to_json(nlohmann::json& json, const Solution& solution)
     }
 
     json[fields::Kernels] = prepared_kernels;
-    auto programs_json    = nlohmann::json{};
+    return programs;
+}
+
+void to_json(nlohmann::json& json, const Solution& solution)
+{
+    const auto programs = solution.SerializeMetadata(json);
+    if(programs.empty())
+        return;
+
+    auto programs_json = nlohmann::json{};
 
     for(const auto& program : programs)
     {
@@ -800,6 +943,16 @@ void to_json(nlohmann::json& json, const Solution& solution)
 
             MIOPEN_LOG_I2("Serialized binary to solution blob, " << chars.size() << " bytes");
         }
+        else if(program.IsCodeObjectMapped())
+        {
+            // Programs that have been loaded from a solution bundle.
+
+            const auto chars = program.GetMappedCodeObject();
+            binary.resize(chars.size());
+            std::memcpy(binary.data(), chars.data(), chars.size());
+
+            MIOPEN_LOG_I2("Serialized binary to solution blob, " << chars.size() << " bytes");
+        }
         else if(program.IsCodeObjectInFile())
         {
             // Programs that have been loaded from file cache are internally interpreted
@@ -830,7 +983,8 @@ void to_json(nlohmann::json& json, const Solution& solution)
     json[fields::Binaries] = std::move(programs_json);
 }
 
-void from_json(const nlohmann::json& json, Solution& solution)
+void Solution::DeserializeMetadata(const nlohmann::json& json,
+                                   const std::vector<Program>& programs)
 {
     {
         const auto header = json.at(fields::Header).get<Solution::SerializationMetadata>();
@@ -849,42 +1003,344 @@ void from_json(const nlohmann::json& json, Solution& solution)
         }
     }
 
-    json.at(fields::Time).get_to(solution.time);
-    json.at(fields::Workspace).get_to(solution.workspace_required);
-    solution.solver = json.at(fields::Solver).get<std::string>();
-    json.at(fields::Problem).get_to(solution.problem);
+    json.at(fields::Time).get_to(time);
+    json.at(fields::Workspace).get_to(workspace_required);
+    solver = json.at(fields::Solver).get<std::string>();
+    json.at(fields::Problem).get_to(problem);
 
     const auto perf_cfg_json = json.find(fields::PerfCfg);
-    solution.perf_cfg        = perf_cfg_json != json.end()
+    perf_cfg                 = perf_cfg_json != json.end()
                                    ? std::optional{perf_cfg_json->get<std::string>()}
                                    : std::nullopt;
 
-    solution.kernels.clear();
-    if(const auto binaries_json = json.find(fields::Binaries); binaries_json != json.end())
+    kernels.clear();
+    const auto kernels_json = json.find(fields::Kernels);
+    if(programs.empty() || kernels_json == json.end())
+        return;
+
+    auto kernel_infos = kernels_json->get<std::vector<SerializedSolutionKernelInfo>>();
+    kernels.reserve(kernel_infos.size());
+
+    for(auto&& serialized_kernel_info : kernel_infos)
     {
-        auto programs = std::vector<HIPOCProgram>{};
+        if(serialized_kernel_info.program < 0 ||
+           serialized_kernel_info.program >= static_cast<int>(programs.size()))
+            MIOPEN_THROW(miopenStatusInvalidValue,
+                         "Invalid binary index in a serialized solution.");
+
+        auto kernel_info             = Solution::KernelInfo{};
+        kernel_info.program          = programs[serialized_kernel_info.program];
+        kernel_info.local_work_dims  = std::move(serialized_kernel_info.local_work_dims);
+        kernel_info.global_work_dims = std::move(serialized_kernel_info.global_work_dims);
+        kernel_info.kernel_name      = std::move(serialized_kernel_info.kernel_name);
+        kernel_info.program_name     = std::move(serialized_kernel_info.program_name);
+        kernels.emplace_back(std::move(kernel_info));
+    }
+}
+
+void from_json(const nlohmann::json& json, Solution& solution)
+{
+    auto programs = std::vector<Program>{};
 
+    if(const auto binaries_json = json.find(fields::Binaries); binaries_json != json.end())
+    {
         for(const auto& bin : *binaries_json)
         {
             const auto& binary = bin.get_ref<const nlohmann::json::binary_t&>();
             MIOPEN_LOG_I2("Derializing binary from solution blob, " << binary.size() << " bytes");
             programs.emplace_back(HIPOCProgram{"", binary});
         }
+    }
+
+    solution.DeserializeMetadata(json, programs);
+}
+
+namespace {
+
+// Layout of a solution bundle, all integers are in the host byte order:
+//   BundleHeader
+//   BundleEntry[solution_count]         msgpack records of the solutions without code objects
+//   BundleBinaryEntry[binary_count]     code objects referred to by the kernels of the records
+//   records...
+//   code objects..., each aligned to BundleBinaryAlignment
+constexpr std::array<char, 8> BundleMagic   = {'M', 'I', 'O', 'P', 'S', 'B', 'N', 'D'};
+constexpr std::uint64_t BundleVersion       = 1;
+constexpr std::size_t BundleBinaryAlignment = 256;
+
+struct BundleHeader
+{
+    std::array<char, 8> magic;
+    std::uint64_t version;
+    std::uint64_t validation_number;
+    std::uint64_t solution_count;
+    std::uint64_t binary_count;
+};
+
+struct BundleEntry
+{
+    std::uint64_t offset;
+    std::uint64_t size;
+};
+
+struct BundleBinaryEntry
+{
+    std::uint64_t offset;
+    std::uint64_t size;
+    std::array<char, 32> hash;
+};
+
+struct BundleBinary
+{
+    std::string_view data;
+    std::shared_ptr<const MappedFile> storage;
+    std::string hash;
+};
+
+BundleBinary MakeBundleBinary(const Program& program)
+{
+    auto binary = BundleBinary{};
+
+    if(program.IsCodeObjectInMemory())
+    {
+        const auto& chars = program.GetCodeObjectBlob();
+        binary.data       = {chars.data(), chars.size()};
+    }
+    else if(program.IsCodeObjectMapped())
+    {
+        binary.data = program.GetMappedCodeObject();
+    }
+    else if(program.IsCodeObjectInFile())
+    {
+        binary.storage = std::make_shared<const MappedFile>(program.GetCodeObjectPathname());
+        binary.data    = binary.storage->view();
+    }
+    else
+    {
+        MIOPEN_THROW(miopenStatusInternalError);
+    }
+
+    binary.hash = md5(binary.data.data(), binary.data.size());
+    return binary;
+}
+
+template <class T>
+const T& ReadBundleStruct(const MappedFile& file, std::size_t offset, const fs::path& path)
+{
+    if(offset > file.size() || sizeof(T) > file.size() - offset)
+        MIOPEN_THROW(miopenStatusInvalidValue, path.string() + ": truncated solution bundle");
+    // Offsets of all the structures are multiples of 8 and the mapping is page aligned.
+    return *reinterpret_cast<const T*>(file.data() + offset);
+}
+
+template <class T>
+void WriteBundleStruct(std::ostream& out, const T& value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
 
-        auto kernel_infos =
-            json.at(fields::Kernels).get<std::vector<SerializedSolutionKernelInfo>>();
-        solution.kernels.reserve(kernel_infos.size());
+BundleHeader MakeBundleHeader(std::size_t solution_count, std::size_t binary_count)
+{
+    return {BundleMagic,
+            BundleVersion,
+            Solution::SerializationMetadata::Current().validation_number,
+            solution_count,
+            binary_count};
+}
+
+void CheckBundleHeader(const BundleHeader& header, const fs::path& path)
+{
+    if(header.magic != BundleMagic ||
+       header.validation_number != Solution::SerializationMetadata::Current().validation_number)
+        MIOPEN_THROW(miopenStatusInvalidValue, path.string() + " is not a solution bundle");
+    if(header.version != BundleVersion)
+        MIOPEN_THROW(miopenStatusVersionMismatch,
+                     path.string() + ": solution bundle of a wrong version");
+}
+
+} // namespace
 
-        for(auto&& serialized_kernel_info : kernel_infos)
+void SolutionBundle::Save(const fs::path& path, const std::vector<const Solution*>& solutions)
+{
+    auto records  = std::vector<std::vector<std::uint8_t>>{};
+    auto binaries = std::vector<BundleBinary>{};
+    // Different programs may hold the same code object, e.g. when loaded from separate blobs.
+    auto by_program = std::unordered_map<const void*, std::size_t>{};
+    auto by_hash    = std::unordered_map<std::string, std::size_t>{};
+
+    records.reserve(solutions.size());
+
+    for(const auto* solution : solutions)
+    {
+        auto json           = nlohmann::json{};
+        const auto programs = solution->SerializeMetadata(json);
+        auto indices        = std::vector<std::size_t>{};
+
+        for(const auto& program : programs)
         {
-            auto kernel_info             = Solution::KernelInfo{};
-            kernel_info.program          = programs[serialized_kernel_info.program];
-            kernel_info.local_work_dims  = std::move(serialized_kernel_info.local_work_dims);
-            kernel_info.global_work_dims = std::move(serialized_kernel_info.global_work_dims);
-            kernel_info.kernel_name      = std::move(serialized_kernel_info.kernel_name);
-            kernel_info.program_name     = std::move(serialized_kernel_info.program_name);
-            solution.kernels.emplace_back(std::move(kernel_info));
+            auto found = by_program.find(program.impl.get());
+            if(found == by_program.end())
+            {
+                auto binary         = MakeBundleBinary(program);
+                const auto inserted = by_hash.emplace(binary.hash, binaries.size());
+                if(inserted.second)
+                    binaries.emplace_back(std::move(binary));
+                found = by_program.emplace(program.impl.get(), inserted.first->second).first;
+            }
+            indices.push_back(found->second);
         }
+
+        if(!programs.empty())
+        {
+            for(auto& kernel : json.at(fields::Kernels))
+            {
+                auto& program = kernel.at(fields::kernels::Program);
+                program       = indices.at(program.get<std::size_t>());
+            }
+        }
+
+        records.emplace_back(nlohmann::json::to_msgpack(json));
+    }
+
+    const auto align = [](std::size_t value, std::size_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    };
+
+    auto offset = sizeof(BundleHeader) + records.size() * sizeof(BundleEntry) +
+                  binaries.size() * sizeof(BundleBinaryEntry);
+
+    auto record_entries = std::vector<BundleEntry>{};
+    for(const auto& record : records)
+    {
+        record_entries.push_back({offset, record.size()});
+        offset = align(offset + record.size(), alignof(std::uint64_t));
+    }
+
+    auto binary_entries = std::vector<BundleBinaryEntry>{};
+    for(const auto& binary : binaries)
+    {
+        offset       = align(offset, BundleBinaryAlignment);
+        auto& entry  = binary_entries.emplace_back();
+        entry.offset = offset;
+        entry.size   = binary.data.size();
+        std::copy_n(binary.hash.begin(), entry.hash.size(), entry.hash.begin());
+        offset += binary.data.size();
     }
+
+    // Code objects of loaded solutions may still be mapped from the destination, and programs of
+    // other solutions may run from it, so the file is replaced rather than rewritten in place.
+    const auto tmp = fs::path{path.string() + ".tmp"};
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if(!out.is_open())
+            MIOPEN_THROW(miopenStatusInvalidValue, tmp.string() + ": file opening error");
+
+        WriteBundleStruct(out, MakeBundleHeader(records.size(), binaries.size()));
+        for(const auto& entry : record_entries)
+            WriteBundleStruct(out, entry);
+        for(const auto& entry : binary_entries)
+            WriteBundleStruct(out, entry);
+
+        const auto pad_to = [&](std::size_t target) {
+            static constexpr std::array<char, BundleBinaryAlignment> zeros = {};
+            const auto position = static_cast<std::size_t>(out.tellp());
+            out.write(zeros.data(), target - position);
+        };
+
+        for(std::size_t i = 0; i < records.size(); ++i)
+        {
+            pad_to(record_entries[i].offset);
+            out.write(reinterpret_cast<const char*>(records[i].data()), records[i].size());
+        }
+
+        for(std::size_t i = 0; i < binaries.size(); ++i)
+        {
+            pad_to(binary_entries[i].offset);
+            out.write(binaries[i].data.data(), binaries[i].data.size());
+        }
+
+        if(out.flush().fail())
+        {
+            out.close();
+            auto ec = std::error_code{};
+            fs::remove(tmp, ec);
+            MIOPEN_THROW(miopenStatusInternalError, tmp.string() + ": file writing error");
+        }
+    }
+    fs::rename(tmp, path);
+
+    MIOPEN_LOG_I2("Saved " << records.size() << " solutions with " << binaries.size()
+                           << " distinct binaries to " << path);
 }
+
+std::vector<Solution> SolutionBundle::Load(const fs::path& path)
+{
+    const auto file    = std::make_shared<const MappedFile>(path);
+    const auto& header = ReadBundleStruct<BundleHeader>(*file, 0, path);
+    CheckBundleHeader(header, path);
+
+    const auto throw_truncated = [&]() {
+        MIOPEN_THROW(miopenStatusInvalidValue, path.string() + ": truncated solution bundle");
+    };
+
+    // The counts come from the file, so they are checked against its size before anything is
+    // allocated or any offset is computed from them.
+    const auto records_offset = sizeof(BundleHeader);
+    if(header.solution_count > (file->size() - records_offset) / sizeof(BundleEntry))
+        throw_truncated();
+    const auto binaries_offset = records_offset + header.solution_count * sizeof(BundleEntry);
+    if(header.binary_count > (file->size() - binaries_offset) / sizeof(BundleBinaryEntry))
+        throw_truncated();
+
+    const auto get_data = [&](std::uint64_t offset, std::uint64_t size) {
+        if(offset > file->size() || size > file->size() - offset)
+            throw_truncated();
+        return file->data() + offset;
+    };
+
+    auto programs = std::vector<Program>{};
+    programs.reserve(header.binary_count);
+
+    for(std::size_t i = 0; i < header.binary_count; ++i)
+    {
+        const auto& entry = ReadBundleStruct<BundleBinaryEntry>(
+            *file, binaries_offset + i * sizeof(BundleBinaryEntry), path);
+        const auto* data = get_data(entry.offset, entry.size);
+        const auto hash  = md5(data, entry.size);
+        if(!std::equal(entry.hash.begin(), entry.hash.end(), hash.begin(), hash.end()))
+            MIOPEN_THROW(miopenStatusInvalidValue,
+                         path.string() + ": corrupt code object #" + std::to_string(i) +
+                             " in the solution bundle");
+        programs.emplace_back(HIPOCProgram{"", std::string_view{data, entry.size}, file});
+    }
+
+    auto solutions = std::vector<Solution>{};
+    solutions.reserve(header.solution_count);
+
+    for(std::size_t i = 0; i < header.solution_count; ++i)
+    {
+        const auto& entry =
+            ReadBundleStruct<BundleEntry>(*file, records_offset + i * sizeof(BundleEntry), path);
+        const auto* data =
+            reinterpret_cast<const std::uint8_t*>(get_data(entry.offset, entry.size));
+        const auto json = nlohmann::json::from_msgpack(data, data + entry.size);
+        solutions.emplace_back().DeserializeMetadata(json, programs);
+    }
+
+    MIOPEN_LOG_I2("Loaded " << solutions.size() << " solutions with " << programs.size()
+                            << " distinct binaries from " << path);
+    return solutions;
+}
+
+std::size_t SolutionBundle::GetSize(const fs::path& path)
+{
+    auto header = BundleHeader{};
+    std::ifstream in(path, std::ios::binary);
+    if(!in.is_open())
+        MIOPEN_THROW(miopenStatusInvalidValue, path.string() + ": file opening error");
+    if(in.read(reinterpret_cast<char*>(&header), sizeof(header)).fail())
+        MIOPEN_THROW(miopenStatusInvalidValue, path.string() + ": truncated solution bundle");
+    CheckBundleHeader(header, path);
+    return header.solution_count;
+}
+
 } // namespace miopen
@@ -519,6 +519,26 @@ bool ConvAsm1x1U::IsValidPerformanceConfig(const ExecutionContext&,
     return config.IsValidValue() && config.IsValid(problem);
 }
 
+std::uint64_t ConvAsm1x1U::GetFeatureMask() const
+{
+    using miopen::conv::ProblemFeature;
+    return miopen::conv::FeatureMask({ProblemFeature::Spatial2d,
+                                      ProblemFeature::DirectionForward,
+                                      ProblemFeature::DirectionBackwardData,
+                                      ProblemFeature::LayoutDefault,
+                                      ProblemFeature::TypeFp32,
+                                      ProblemFeature::TypeFp16,
+                                      ProblemFeature::GroupsOne,
+                                      ProblemFeature::DilationOne,
+                                      ProblemFeature::Filter1x1,
+                                      ProblemFeature::TargetGfx900,
+                                      ProblemFeature::TargetGfx906,
+                                      ProblemFeature::TargetGfx908,
+                                      ProblemFeature::TargetGfx90a,
+                                      ProblemFeature::TargetGfx94x,
+                                      ProblemFeature::TargetGfx9Other});
+}
+
 bool ConvAsm1x1U::IsApplicable(const ExecutionContext& ctx, const ProblemDescription& problem) const
 {
     if(env::disabled(MIOPEN_DEBUG_CONV_DIRECT_ASM_1X1U))
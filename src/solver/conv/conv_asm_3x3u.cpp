@@ -171,6 +171,24 @@ bool ConvAsm3x3U::IsValidPerformanceConfig(const ExecutionContext&,
     return config.IsValidValue() && config.IsValid(problem);
 }
 
+std::uint64_t ConvAsm3x3U::GetFeatureMask() const
+{
+    using miopen::conv::ProblemFeature;
+    return miopen::conv::FeatureMask({ProblemFeature::Spatial2d,
+                                      ProblemFeature::DirectionForward,
+                                      ProblemFeature::DirectionBackwardData,
+                                      ProblemFeature::LayoutDefault,
+                                      ProblemFeature::StrideOne,
+                                      ProblemFeature::DilationOne,
+                                      ProblemFeature::Filter3x3,
+                                      ProblemFeature::TargetGfx8,
+                                      ProblemFeature::TargetGfx900,
+                                      ProblemFeature::TargetGfx906,
+                                      ProblemFeature::TargetGfx908,
+                                      ProblemFeature::TargetGfx90a,
+                                      ProblemFeature::TargetGfx9Other});
+}
+
 bool ConvAsm3x3U::IsApplicable(const ExecutionContext& ctx, const ProblemDescription& problem) const
 {
     if(env::disabled(MIOPEN_DEBUG_CONV_DIRECT_ASM_3X3U))
@@ -40,6 +40,22 @@ namespace conv {
 
 using ProblemDescription = miopen::conv::ProblemDescription;
 
+std::uint64_t ConvAsm5x10u2v2f1::GetFeatureMask() const
+{
+    using miopen::conv::ProblemFeature;
+    return miopen::conv::FeatureMask({ProblemFeature::Spatial2d,
+                                      ProblemFeature::DirectionForward,
+                                      ProblemFeature::LayoutDefault,
+                                      ProblemFeature::StrideOther,
+                                      ProblemFeature::DilationOne,
+                                      ProblemFeature::FilterOther,
+                                      ProblemFeature::TargetGfx8,
+                                      ProblemFeature::TargetGfx900,
+                                      ProblemFeature::TargetGfx906,
+                                      ProblemFeature::TargetGfx908,
+                                      ProblemFeature::TargetGfx9Other});
+}
+
 bool ConvAsm5x10u2v2f1::IsApplicable(const ExecutionContext& ctx,
                                      const ProblemDescription& problem) const
 {
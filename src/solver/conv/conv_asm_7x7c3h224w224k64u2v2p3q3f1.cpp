@@ -41,6 +41,24 @@ namespace conv {
 
 using ProblemDescription = miopen::conv::ProblemDescription;
 
+std::uint64_t ConvAsm7x7c3h224w224k64u2v2p3q3f1::GetFeatureMask() const
+{
+    using miopen::conv::ProblemFeature;
+    return miopen::conv::FeatureMask({ProblemFeature::Spatial2d,
+                                      ProblemFeature::DirectionForward,
+                                      ProblemFeature::LayoutDefault,
+                                      ProblemFeature::TypeFp32,
+                                      ProblemFeature::GroupsOne,
+                                      ProblemFeature::StrideOther,
+                                      ProblemFeature::DilationOne,
+                                      ProblemFeature::FilterOther,
+                                      ProblemFeature::TargetGfx8,
+                                      ProblemFeature::TargetGfx900,
+                                      ProblemFeature::TargetGfx906,
+                                      ProblemFeature::TargetGfx908,
+                                      ProblemFeature::TargetGfx9Other});
+}
+
 bool ConvAsm7x7c3h224w224k64u2v2p3q3f1::IsApplicable(const ExecutionContext& ctx,
                                                      const ProblemDescription& problem) const
 {
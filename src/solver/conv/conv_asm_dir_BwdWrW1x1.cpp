@@ -472,6 +472,27 @@ bool ConvAsmBwdWrW1x1::IsValidPerformanceConfig(
     return config.IsValidValue() && config.IsValid(ctx, problem);
 }
 
+std::uint64_t ConvAsmBwdWrW1x1::GetFeatureMask() const
+{
+    using miopen::conv::ProblemFeature;
+    return miopen::conv::FeatureMask({ProblemFeature::Spatial2d,
+                                      ProblemFeature::DirectionBackwardWrW,
+                                      ProblemFeature::LayoutDefault,
+                                      ProblemFeature::TypeFp32,
+                                      ProblemFeature::TypeFp16,
+                                      ProblemFeature::TypeBfp16,
+                                      ProblemFeature::GroupsOne,
+                                      ProblemFeature::DilationOne,
+                                      ProblemFeature::Filter1x1,
+                                      ProblemFeature::TargetGfx8,
+                                      ProblemFeature::TargetGfx900,
+                                      ProblemFeature::TargetGfx906,
+                                      ProblemFeature::TargetGfx908,
+                                      ProblemFeature::TargetGfx90a,
+                                      ProblemFeature::TargetGfx94x,
+                                      ProblemFeature::TargetGfx9Other});
+}
+
 bool ConvAsmBwdWrW1x1::IsApplicable(const ExecutionContext& ctx,
                                     const ProblemDescription& problem) const
 {
@@ -388,6 +388,25 @@ bool ConvAsmBwdWrW3x3::IsValidPerformanceConfig(
     return config.IsValidValue() && config.IsValid(ctx, problem);
 }
 
+std::uint64_t ConvAsmBwdWrW3x3::GetFeatureMask() const
+{
+    using miopen::conv::ProblemFeature;
+    return miopen::conv::FeatureMask({ProblemFeature::Spatial2d,
+                                      ProblemFeature::DirectionBackwardWrW,
+                                      ProblemFeature::LayoutDefault,
+                                      ProblemFeature::TypeFp32,
+                                      ProblemFeature::TypeFp16,
+                                      ProblemFeature::DilationOne,
+                                      ProblemFeature::Filter3x3,
+                                      ProblemFeature::TargetGfx8,
+                                      ProblemFeature::TargetGfx900,
+                                      ProblemFeature::TargetGfx906,
+                                      ProblemFeature::TargetGfx908,
+                                      ProblemFeature::TargetGfx90a,
+                                      ProblemFeature::TargetGfx94x,
+                                      ProblemFeature::TargetGfx9Other});
+}
+
 bool ConvAsmBwdWrW3x3::IsApplicable(const ExecutionContext& ctx,
                                     const ProblemDescription& problem) const
 {
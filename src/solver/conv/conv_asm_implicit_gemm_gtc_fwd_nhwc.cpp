@@ -859,6 +859,19 @@ size_t ConvAsmImplicitGemmGTCDynamicFwdXdlopsNHWC::GetWorkspaceSize(
     return workspace_size;
 }
 
+std::uint64_t ConvAsmImplicitGemmGTCDynamicFwdXdlopsNHWC::GetFeatureMask() const
+{
+    using miopen::conv::ProblemFeature;
+    return miopen::conv::FeatureMask({ProblemFeature::Spatial2d,
+                                      ProblemFeature::DirectionForward,
+                                      ProblemFeature::TypeFp32,
+                                      ProblemFeature::TypeFp16,
+                                      ProblemFeature::TypeBfp16,
+                                      ProblemFeature::TargetGfx908,
+                                      ProblemFeature::TargetGfx90a,
+                                      ProblemFeature::TargetGfx94x});
+}
+
 bool ConvAsmImplicitGemmGTCDynamicFwdXdlopsNHWC::IsApplicable(
     const ExecutionContext& ctx, const ProblemDescription& problem) const
 {
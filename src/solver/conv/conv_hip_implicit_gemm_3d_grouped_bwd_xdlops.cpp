@@ -503,6 +503,22 @@ ConvHipImplicitGemm3DGroupBwdXdlops::Search(const ExecutionContext& ctx,
     return GenericSearch(*this, ctx, problem, invoke_ctx);
 }
 
+std::uint64_t ConvHipImplicitGemm3DGroupBwdXdlops::GetFeatureMask() const
+{
+    using miopen::conv::ProblemFeature;
+    return miopen::conv::FeatureMask({ProblemFeature::Spatial3d,
+                                      ProblemFeature::DirectionBackwardData,
+                                      ProblemFeature::LayoutDefault,
+                                      ProblemFeature::LayoutNHWC,
+                                      ProblemFeature::TypeFp32,
+                                      ProblemFeature::TypeFp16,
+                                      ProblemFeature::TypeBfp16,
+                                      ProblemFeature::TypeInt8,
+                                      ProblemFeature::TargetGfx908,
+                                      ProblemFeature::TargetGfx90a,
+                                      ProblemFeature::TargetGfx94x});
+}
+
 bool ConvHipImplicitGemm3DGroupBwdXdlops::IsApplicable(
     [[maybe_unused]] const ExecutionContext& ctx,
     [[maybe_unused]] const ProblemDescription& problem) const
@@ -40,6 +40,21 @@ namespace conv {
 
 using ProblemDescription = miopen::conv::ProblemDescription;
 
+std::uint64_t ConvOclDirectFwd11x11::GetFeatureMask() const
+{
+    using miopen::conv::ProblemFeature;
+    return miopen::conv::FeatureMask({ProblemFeature::Spatial2d,
+                                      ProblemFeature::DirectionForward,
+                                      ProblemFeature::LayoutDefault,
+                                      ProblemFeature::TypeFp32,
+                                      ProblemFeature::TypeFp16,
+                                      ProblemFeature::TypeBfp16,
+                                      ProblemFeature::GroupsOne,
+                                      ProblemFeature::StrideOther,
+                                      ProblemFeature::DilationOne,
+                                      ProblemFeature::FilterOther});
+}
+
 bool ConvOclDirectFwd11x11::IsApplicable(const ExecutionContext& ctx,
                                          const ProblemDescription& problem) const
 {
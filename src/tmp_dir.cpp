@@ -33,6 +33,7 @@
 #include <boost/filesystem/operations.hpp>
 
 #include <thread>
+#include <utility>
 #include <string_view>
 
 MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DEBUG_SAVE_TEMP_DIR)
@@ -92,4 +93,56 @@ TmpDir::~TmpDir()
     }
 }
 
+TmpDirPool::Lease::Lease(TmpDirPool& pool_, TmpDir dir_) : pool(&pool_), dir(std::move(dir_)) {}
+
+TmpDirPool::Lease::Lease(Lease&& other) noexcept
+    : pool(other.pool), dir(std::exchange(other.dir, std::nullopt))
+{
+}
+
+TmpDirPool::Lease::~Lease()
+{
+    if(dir)
+        pool->Release(std::move(*dir));
+}
+
+TmpDirPool::TmpDirPool(std::string_view prefix_,
+                       std::function<void(const TmpDir&)> init_,
+                       std::size_t max_idle_)
+    : prefix(prefix_), init(std::move(init_)), max_idle(max_idle_)
+{
+}
+
+TmpDirPool::Lease TmpDirPool::Acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if(!idle.empty())
+        {
+            auto dir = std::move(idle.back());
+            idle.pop_back();
+            return {*this, std::move(dir)};
+        }
+    }
+
+    // Initialization may be slow and is done outside of the lock.
+    auto dir = TmpDir{prefix};
+    if(init)
+        init(dir);
+    return {*this, std::move(dir)};
+}
+
+std::size_t TmpDirPool::IdleCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return idle.size();
+}
+
+void TmpDirPool::Release(TmpDir dir)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if(idle.size() < max_idle)
+        idle.emplace_back(std::move(dir));
+}
+
 } // namespace miopen
@@ -0,0 +1,305 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/tuning_queue.hpp>
+
+#include <miopen/errors.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/stringutils.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <fstream>
+#include <mutex>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <signal.h>
+#include <unistd.h>
+#endif
+
+namespace miopen {
+namespace solver {
+
+namespace {
+
+constexpr std::array<const char*, 5> state_names = {
+    "pending", "compiling", "compiled", "running", "done"};
+
+const char* ToString(TuningUnitState state) { return state_names[static_cast<int>(state)]; }
+
+TuningUnitState ParseState(const std::string& name)
+{
+    const auto it = std::find(state_names.begin(), state_names.end(), name);
+    if(it == state_names.end())
+        MIOPEN_THROW("Unknown tuning unit state: " + name);
+    return static_cast<TuningUnitState>(std::distance(state_names.begin(), it));
+}
+
+std::string GetHostName()
+{
+#ifdef _WIN32
+    return "localhost";
+#else
+    char name[256] = {};
+    if(::gethostname(name, sizeof(name) - 1) != 0)
+        return "localhost";
+    return name;
+#endif
+}
+
+std::string GetOwner()
+{
+#ifdef _WIN32
+    return GetHostName() + ':' + std::to_string(_getpid());
+#else
+    return GetHostName() + ':' + std::to_string(::getpid());
+#endif
+}
+
+bool IsOwnerAlive(const std::string& owner)
+{
+    const auto colon = owner.rfind(':');
+    if(colon == std::string::npos || owner.substr(0, colon) != GetHostName())
+        return true; // Processes of other hosts are only expired by the timeout.
+#ifdef _WIN32
+    // Without a reliable check claims are only expired by the timeout.
+    return true;
+#else
+    const auto pid = std::stol(owner.substr(colon + 1));
+    return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno == EPERM;
+#endif
+}
+
+std::int64_t GetTime()
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+} // namespace
+
+TuningQueue::TuningQueue(fs::path file_, std::chrono::seconds claim_timeout_)
+    : file(std::move(file_)), lock_path(file.string() + ".lock"), claim_timeout(claim_timeout_)
+{
+    if(file.has_parent_path() && !fs::exists(file.parent_path()))
+        fs::create_directories(file.parent_path());
+}
+
+std::vector<TuningUnit> TuningQueue::Read() const
+{
+    auto units = std::vector<TuningUnit>{};
+    auto in    = std::ifstream{file};
+    auto line  = std::string{};
+
+    for(auto n = 1; std::getline(in, line); ++n)
+    {
+        if(line.empty())
+            continue;
+
+        // key, chunk, state, time, best, owner, claimed, configs
+        const auto fields = SplitDelim(line, '\t');
+        if(fields.size() != 8)
+        {
+            MIOPEN_LOG_E("Malformed tuning unit at " << file << ':' << n);
+            continue;
+        }
+
+        auto unit    = TuningUnit{};
+        unit.key     = fields[0];
+        unit.chunk   = std::stoull(fields[1]);
+        unit.state   = ParseState(fields[2]);
+        unit.time    = std::stof(fields[3]);
+        unit.best    = fields[4];
+        unit.owner   = fields[5];
+        unit.claimed = std::stoll(fields[6]);
+        unit.configs = SplitDelim(fields[7], ';');
+        units.emplace_back(std::move(unit));
+    }
+
+    return units;
+}
+
+void TuningQueue::Write(const std::vector<TuningUnit>& units) const
+{
+    // Other processes read the queue only under the lock, but a worker may be killed while
+    // writing. Replacing the file keeps the previous contents intact in that case.
+    const auto tmp = fs::path{file.string() + ".tmp"};
+    {
+        auto out = std::ofstream{tmp, std::ios::trunc};
+        for(const auto& unit : units)
+        {
+            out << unit.key << '\t' << unit.chunk << '\t' << ToString(unit.state) << '\t'
+                << unit.time << '\t' << unit.best << '\t' << unit.owner << '\t' << unit.claimed
+                << '\t' << JoinStrings(unit.configs, ";") << '\n';
+        }
+        if(!out)
+            MIOPEN_THROW("Failed to write tuning queue: " + tmp);
+    }
+    fs::rename(tmp, file);
+}
+
+std::size_t TuningQueue::Enqueue(const std::string& key,
+                                 const std::vector<std::string>& configs,
+                                 std::size_t chunk_size)
+{
+    if(chunk_size == 0)
+        MIOPEN_THROW(miopenStatusBadParm, "Tuning unit size must not be zero");
+
+    std::lock_guard<LockFile> lock(LockFile::Get(lock_path));
+    auto units = Read();
+
+    if(std::any_of(units.begin(), units.end(), [&](auto&& unit) { return unit.key == key; }))
+        return 0;
+
+    auto added = std::size_t{0};
+    for(auto first = configs.begin(); first != configs.end(); ++added)
+    {
+        const auto last = configs.end() - first > static_cast<std::ptrdiff_t>(chunk_size)
+                              ? first + chunk_size
+                              : configs.end();
+        auto unit    = TuningUnit{};
+        unit.key     = key;
+        unit.chunk   = added;
+        unit.configs = {first, last};
+        units.emplace_back(std::move(unit));
+        first = last;
+    }
+
+    Write(units);
+    MIOPEN_LOG_I2("Enqueued " << added << " tuning units for " << key);
+    return added;
+}
+
+std::size_t TuningQueue::RequeueAbandoned(std::vector<TuningUnit>& units) const
+{
+    const auto now    = GetTime();
+    auto requeued     = std::size_t{0};
+    const auto expiry = static_cast<std::int64_t>(claim_timeout.count());
+
+    for(auto& unit : units)
+    {
+        if(unit.state != TuningUnitState::Compiling && unit.state != TuningUnitState::Running)
+            continue;
+
+        const auto expired = expiry != 0 && now - unit.claimed > expiry;
+        if(!expired && IsOwnerAlive(unit.owner))
+            continue;
+
+        // A unit claimed from compiled may not have been compiled by the same host, so it is
+        // compiled again. The kernels are likely in the binary cache already.
+        MIOPEN_LOG_W("Requeued tuning unit #" << unit.chunk << " of " << unit.key
+                                              << " abandoned by " << unit.owner);
+        unit.state   = TuningUnitState::Pending;
+        unit.owner   = {};
+        unit.claimed = 0;
+        ++requeued;
+    }
+
+    return requeued;
+}
+
+std::optional<TuningUnit> TuningQueue::Claim(const std::string& key, bool compile_only)
+{
+    std::lock_guard<LockFile> lock(LockFile::Get(lock_path));
+    auto units          = Read();
+    const auto requeued = RequeueAbandoned(units);
+
+    const auto find = [&](TuningUnitState state) {
+        return std::find_if(units.begin(), units.end(), [&](auto&& unit) {
+            return unit.key == key && unit.state == state;
+        });
+    };
+
+    auto it = units.end();
+    if(!compile_only)
+        it = find(TuningUnitState::Compiled);
+    if(it == units.end())
+        it = find(TuningUnitState::Pending);
+    if(it == units.end())
+    {
+        if(requeued != 0)
+            Write(units);
+        return std::nullopt;
+    }
+
+    it->state   = compile_only ? TuningUnitState::Compiling : TuningUnitState::Running;
+    it->owner   = GetOwner();
+    it->claimed = GetTime();
+    Write(units);
+    return *it;
+}
+
+void TuningQueue::Complete(const TuningUnit& unit)
+{
+    std::lock_guard<LockFile> lock(LockFile::Get(lock_path));
+    auto units = Read();
+
+    const auto it = std::find_if(units.begin(), units.end(), [&](auto&& stored) {
+        return stored.key == unit.key && stored.chunk == unit.chunk;
+    });
+    if(it == units.end())
+        MIOPEN_THROW("Tuning unit " + std::to_string(unit.chunk) + " of " + unit.key +
+                     " is not in " + file);
+
+    it->state   = unit.state;
+    it->time    = unit.time;
+    it->best    = unit.best;
+    it->owner   = {};
+    it->claimed = 0;
+    Write(units);
+}
+
+std::optional<TuningUnit> TuningQueue::Best(const std::string& key) const
+{
+    std::lock_guard<LockFile> lock(LockFile::Get(lock_path));
+    std::optional<TuningUnit> best;
+
+    for(auto&& unit : Read())
+    {
+        if(unit.key != key || unit.state != TuningUnitState::Done || unit.best.empty())
+            continue;
+        if(!best || unit.time < best->time)
+            best = std::move(unit);
+    }
+
+    return best;
+}
+
+std::size_t TuningQueue::Count(const std::string& key, std::optional<TuningUnitState> state) const
+{
+    std::lock_guard<LockFile> lock(LockFile::Get(lock_path));
+    const auto units = Read();
+    return std::count_if(units.begin(), units.end(), [&](auto&& unit) {
+        return unit.key == key && (!state || unit.state == *state);
+    });
+}
+
+} // namespace solver
+} // namespace miopen
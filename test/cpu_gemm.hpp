@@ -0,0 +1,294 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_GEMM_HPP
+#define GUARD_CPU_GEMM_HPP
+
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// Host reference GEMM used by the RNN, LSTM and GRU verification code:
+//   C[i][j] = beta * C[i][j] + alpha * sum_k op(A)[i][k] * op(B)[k][j]
+// All matrices are row-major with leading dimensions lda, ldb and ldc. op(A) is m x k and op(B)
+// is k x n, transposition is expressed through the access order only.
+//
+// Blocks of A and B are converted to double and packed into contiguous panels, and the product
+// is accumulated in double by an MR x NR register tile. Every element is still summed in the
+// order of k, so the results match a naive double-precision loop regardless of the blocking.
+// Large problems and batches are split across threads by blocks of C.
+namespace cpu_gemm_detail {
+
+constexpr std::size_t MR = 4;   // rows of the register tile
+constexpr std::size_t NR = 8;   // columns of the register tile
+constexpr std::size_t MC = 64;  // rows of C per thread block
+constexpr std::size_t NC = 128; // columns of C per thread block
+constexpr std::size_t KC = 256; // depth of a packed panel
+
+// Below this amount of multiply-adds spawning threads costs more than it saves.
+constexpr std::size_t ParallelThreshold = std::size_t{1} << 18;
+
+template <std::size_t Rows, std::size_t Cols>
+inline void MicroKernel(std::size_t kc,
+                        const double* a,
+                        const double* b,
+                        std::size_t ldb,
+                        double* acc,
+                        std::size_t ldacc)
+{
+    double r[Rows][Cols];
+    for(std::size_t i = 0; i < Rows; ++i)
+        for(std::size_t j = 0; j < Cols; ++j)
+            r[i][j] = acc[i * ldacc + j];
+
+    for(std::size_t p = 0; p < kc; ++p)
+    {
+        for(std::size_t i = 0; i < Rows; ++i)
+        {
+            const auto ai = a[p * MR + i];
+            for(std::size_t j = 0; j < Cols; ++j)
+                r[i][j] += ai * b[p * ldb + j];
+        }
+    }
+
+    for(std::size_t i = 0; i < Rows; ++i)
+        for(std::size_t j = 0; j < Cols; ++j)
+            acc[i * ldacc + j] = r[i][j];
+}
+
+inline void EdgeKernel(std::size_t mr,
+                       std::size_t nr,
+                       std::size_t kc,
+                       const double* a,
+                       const double* b,
+                       std::size_t ldb,
+                       double* acc,
+                       std::size_t ldacc)
+{
+    for(std::size_t i = 0; i < mr; ++i)
+    {
+        for(std::size_t j = 0; j < nr; ++j)
+        {
+            auto r = acc[i * ldacc + j];
+            for(std::size_t p = 0; p < kc; ++p)
+                r += a[p * MR + i] * b[p * ldb + j];
+            acc[i * ldacc + j] = r;
+        }
+    }
+}
+
+template <class T>
+struct Problem
+{
+    bool trans_a;
+    bool trans_b;
+    std::size_t m;
+    std::size_t n;
+    std::size_t k;
+    double alpha;
+    const T* a;
+    std::size_t lda;
+    const T* b;
+    std::size_t ldb;
+    double beta;
+    T* c;
+    std::size_t ldc;
+
+    double A(std::size_t i, std::size_t p) const
+    {
+        return static_cast<double>(trans_a ? a[p * lda + i] : a[i * lda + p]);
+    }
+
+    double B(std::size_t p, std::size_t j) const
+    {
+        return static_cast<double>(trans_b ? b[j * ldb + p] : b[p * ldb + j]);
+    }
+};
+
+template <class T>
+void RunBlock(const Problem<T>& pr, std::size_t i0, std::size_t j0)
+{
+    const auto mc = std::min(MC, pr.m - i0);
+    const auto nc = std::min(NC, pr.n - j0);
+
+    thread_local std::vector<double> a_pack;
+    thread_local std::vector<double> b_pack;
+    thread_local std::vector<double> acc;
+
+    acc.assign(mc * nc, 0.0);
+    a_pack.resize(((mc + MR - 1) / MR) * MR * KC);
+    b_pack.resize(KC * nc);
+
+    for(std::size_t k0 = 0; k0 < pr.k; k0 += KC)
+    {
+        const auto kc = std::min(KC, pr.k - k0);
+
+        for(std::size_t p = 0; p < kc; ++p)
+            for(std::size_t j = 0; j < nc; ++j)
+                b_pack[p * nc + j] = pr.B(k0 + p, j0 + j);
+
+        // A is packed as MR-row panels stored column by column, padded with zeros.
+        for(std::size_t ir = 0; ir < mc; ir += MR)
+        {
+            auto* const panel = &a_pack[ir * KC];
+            const auto mr     = std::min(MR, mc - ir);
+            for(std::size_t p = 0; p < kc; ++p)
+                for(std::size_t i = 0; i < MR; ++i)
+                    panel[p * MR + i] = i < mr ? pr.A(i0 + ir + i, k0 + p) : 0.0;
+        }
+
+        for(std::size_t ir = 0; ir < mc; ir += MR)
+        {
+            const auto mr = std::min(MR, mc - ir);
+            for(std::size_t jr = 0; jr < nc; jr += NR)
+            {
+                const auto nr = std::min(NR, nc - jr);
+                auto* const c = &acc[ir * nc + jr];
+                if(mr == MR && nr == NR)
+                    MicroKernel<MR, NR>(kc, &a_pack[ir * KC], &b_pack[jr], nc, c, nc);
+                else
+                    EdgeKernel(mr, nr, kc, &a_pack[ir * KC], &b_pack[jr], nc, c, nc);
+            }
+        }
+    }
+
+    for(std::size_t i = 0; i < mc; ++i)
+    {
+        for(std::size_t j = 0; j < nc; ++j)
+        {
+            auto& c = pr.c[(i0 + i) * pr.ldc + j0 + j];
+            c = static_cast<T>(pr.beta * static_cast<double>(c) + pr.alpha * acc[i * nc + j]);
+        }
+    }
+}
+
+} // namespace cpu_gemm_detail
+
+template <class T>
+void cpu_gemm_batched(bool trans_a,
+                      bool trans_b,
+                      std::size_t m,
+                      std::size_t n,
+                      std::size_t k,
+                      double alpha,
+                      const T* a,
+                      std::size_t lda,
+                      std::size_t stride_a,
+                      const T* b,
+                      std::size_t ldb,
+                      std::size_t stride_b,
+                      double beta,
+                      T* c,
+                      std::size_t ldc,
+                      std::size_t stride_c,
+                      std::size_t batch_count)
+{
+    using namespace cpu_gemm_detail;
+
+    if(m == 0 || n == 0 || batch_count == 0)
+        return;
+
+    // Batches that write the same C have to be applied one after another.
+    if(stride_c == 0 && batch_count > 1)
+    {
+        for(std::size_t batch = 0; batch < batch_count; ++batch)
+        {
+            cpu_gemm_batched(trans_a,
+                             trans_b,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             a + batch * stride_a,
+                             lda,
+                             0,
+                             b + batch * stride_b,
+                             ldb,
+                             0,
+                             beta,
+                             c,
+                             ldc,
+                             0,
+                             1);
+        }
+        return;
+    }
+
+    const auto row_blocks = (m + MC - 1) / MC;
+    const auto col_blocks = (n + NC - 1) / NC;
+    const auto blocks     = row_blocks * col_blocks;
+    const auto tasks      = blocks * batch_count;
+
+    const auto run = [&](std::size_t task) {
+        const auto batch = task / blocks;
+        const auto block = task % blocks;
+        const auto pr    = Problem<T>{trans_a,
+                                   trans_b,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   a + batch * stride_a,
+                                   lda,
+                                   b + batch * stride_b,
+                                   ldb,
+                                   beta,
+                                   c + batch * stride_c,
+                                   ldc};
+        RunBlock(pr, (block / col_blocks) * MC, (block % col_blocks) * NC);
+    };
+
+    if(tasks > 1 && m * n * k * batch_count >= ParallelThreshold)
+    {
+        miopen::par_for(tasks, miopen::max_threads{tasks}, run);
+    }
+    else
+    {
+        for(std::size_t task = 0; task < tasks; ++task)
+            run(task);
+    }
+}
+
+template <class T>
+void cpu_gemm(bool trans_a,
+              bool trans_b,
+              std::size_t m,
+              std::size_t n,
+              std::size_t k,
+              double alpha,
+              const T* a,
+              std::size_t lda,
+              const T* b,
+              std::size_t ldb,
+              double beta,
+              T* c,
+              std::size_t ldc)
+{
+    cpu_gemm_batched(trans_a, trans_b, m, n, k, alpha, a, lda, 0, b, ldb, 0, beta, c, ldc, 0, 1);
+}
+
+#endif
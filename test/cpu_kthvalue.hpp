@@ -26,11 +26,14 @@
 
 #pragma once
 
+#include "cpu_tensor_walk.hpp"
 #include "tensor_holder.hpp"
 #include "tensor_view.hpp"
 
 #include <miopen/tensor_view_utils.hpp>
 
+#include <algorithm>
+#include <numeric>
 #include <vector>
 
 template <typename TIO>
@@ -41,7 +44,6 @@ void cpu_kthvalue(tensor<TIO> input,
                   size_t k,
                   int dim)
 {
-    size_t inputSize       = input.desc.GetElementSize();
     size_t dimSize         = input.desc.GetLengths()[dim];
     size_t dimStride       = input.desc.GetStrides()[dim];
     auto inputTv           = miopen::get_inner_expanded_tv<5>(input.desc);
@@ -49,33 +51,30 @@ void cpu_kthvalue(tensor<TIO> input,
     auto outputTv          = miopen::get_inner_expanded_tv<5>(outputHost.desc);
     auto indicesTv         = miopen::get_inner_expanded_tv<5>(indiceDesc);
 
-    size_t numSlice = inputSize / dimSize;
+    // The output either keeps the dimension with a length of 1, or drops it and is padded with a
+    // trailing 1. Removing that dimension gives the views the shape of the slices.
+    const auto keepDim       = outputHost.desc.GetNumDims() == input.desc.GetNumDims();
+    const auto outDim        = keepDim ? dim : 4;
+    auto outputTvWithoutDim  = miopen::get_tv_without_dim<5>(outputTv, outDim);
+    auto indicesTvWithoutDim = miopen::get_tv_without_dim<5>(indicesTv, outDim);
 
-    std::vector<float> elements;
-    std::vector<size_t> ids(dimSize);
-    for(int i = 0; i < dimSize; ++i)
-    {
-        ids[i] = i;
-    }
+    tensor_walk(std::array{inputTvWithoutDim, outputTvWithoutDim, indicesTvWithoutDim},
+                [&](const auto& pos) {
+                    thread_local std::vector<float> elements;
+                    thread_local std::vector<size_t> ids;
+                    elements.resize(dimSize);
+                    ids.resize(dimSize);
 
-    for(int slideID = 0; slideID < numSlice; ++slideID)
-    {
-        elements.clear();
-        tensor_layout_t<4> layout(inputTvWithoutDim, slideID);
-        auto idx = inputTvWithoutDim.get_tensor_view_idx(layout);
+                    for(size_t j = 0; j < dimSize; ++j)
+                        elements[j] = static_cast<float>(input.data[pos.offset[0] + j * dimStride]);
+                    std::iota(ids.begin(), ids.end(), 0);
 
-        for(int j = 0; j < dimSize; ++j)
-        {
-            elements.push_back(static_cast<float>(input[idx + j * dimStride]));
-        }
-
-        std::sort(ids.begin(), ids.end(), [=](size_t x, size_t y) -> bool {
-            return elements[x] < elements[y];
-        });
-        auto output_layout  = tensor_layout_t<5>(outputTv, slideID);
-        auto indices_layout = tensor_layout_t<5>(indicesTv, slideID);
-        outputHost[outputTv.get_tensor_view_idx(output_layout)] =
-            static_cast<TIO>(elements[ids[k - 1]]);
-        indices[indicesTv.get_tensor_view_idx(indices_layout)] = ids[k - 1];
-    }
+                    std::nth_element(
+                        ids.begin(), ids.begin() + (k - 1), ids.end(), [&](size_t x, size_t y) {
+                            return elements[x] < elements[y] ||
+                                   (elements[x] == elements[y] && x < y);
+                        });
+                    outputHost.data[pos.offset[1]] = static_cast<TIO>(elements[ids[k - 1]]);
+                    indices[pos.offset[2]]         = ids[k - 1];
+                });
 }
@@ -27,6 +27,7 @@
 #pragma once
 
 #include "miopen/miopen.h"
+#include "cpu_tensor_walk.hpp"
 #include "tensor_holder.hpp"
 #include <miopen/tensor_view_utils.hpp>
 
@@ -45,32 +46,49 @@ void cpu_multimarginloss_forward(const tensor<T>& input,
     auto O_tv = miopen::get_inner_expanded_tv<1>(ref_output.desc);
     auto N = I_tv.size[0], C = I_tv.size[1];
 
-    double sum = 0;
-    for(size_t n = 0; n < N; n++)
-    {
+    // One row of the input per sample.
+    auto rows_tv      = tensor_view_t<1>{};
+    rows_tv.size[0]   = N;
+    rows_tv.stride[0] = I_tv.stride[0];
+
+    const auto* x       = input.data.data();
+    const auto c_stride = I_tv.stride[1];
+
+    const auto sample_loss = [&](const auto& pos) {
         double loss = 0;
-        uint64_t y  = target[T_tv.get_tensor_view_idx({n})];
+        uint64_t y  = target.data[pos.offset[1]];
         if(y >= C)
-            continue;
+            return loss;
+        const auto* row = x + pos.offset[0];
+        const double xy = static_cast<double>(row[y * c_stride]);
+        const double wy = static_cast<double>(weight.data[W_tv.get_tensor_view_idx({y})]);
         for(size_t c = 0; c < C; c++)
         {
             if(y == c)
                 continue;
-            double t = margin - static_cast<double>(input[I_tv.get_tensor_view_idx({n, y})]) +
-                       static_cast<double>(input[I_tv.get_tensor_view_idx({n, c})]);
+            double t = margin - xy + static_cast<double>(row[c * c_stride]);
 
             if(t < 0)
                 continue;
             if(p == 2)
                 t = t * t;
-            t = static_cast<double>(weight[W_tv.get_tensor_view_idx({y})]) * t;
+            t = wy * t;
             loss += t / C;
         }
-        if(reduction_mode == MIOPEN_LOSS_REDUCTION_NONE)
-            ref_output[O_tv.get_tensor_view_idx({n})] = loss;
-        else
-            sum += loss;
+        return loss;
+    };
+
+    if(reduction_mode == MIOPEN_LOSS_REDUCTION_NONE)
+    {
+        tensor_walk(std::array{rows_tv, T_tv, O_tv}, [&](const auto& pos) {
+            // Samples with an invalid target keep their output.
+            if(target.data[pos.offset[1]] < C)
+                ref_output.data[pos.offset[2]] = sample_loss(pos);
+        });
+        return;
     }
+
+    const auto sum = tensor_walk_sum(std::array{rows_tv, T_tv}, sample_loss);
     if(reduction_mode == MIOPEN_LOSS_REDUCTION_MEAN)
     {
         ref_output[0] = static_cast<T>(sum / N);
@@ -0,0 +1,175 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_NORM_HPP
+#define GUARD_CPU_NORM_HPP
+
+#include <miopen/par_for.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+// Host reference statistics for the normalization operators (batch, group, layer norm and their
+// variants). Every statistic is the mean and the biased variance of a group of values:
+//   batch norm spatial:        one group per channel, made of N segments of D*H*W values
+//   batch norm per-activation: one group per C*D*H*W position, made of N values
+//   group and layer norm:      one group per row of the normalized dimensions
+//
+// Values are read once. They are staged in blocks small enough to stay in L1, and the mean and
+// the sum of squared deviations of each block are computed by two plain, vectorizable loops over
+// it. Blocks, segments and pieces of segments are then combined with the pairwise update of Chan
+// et al., which unlike sum(x^2)/n - mean^2 doesn't lose precision when the mean is large
+// compared to the deviation. Groups and segments, or pieces of long segments when there are too
+// few of them, are spread across threads; partial results are merged in a fixed order, so the
+// statistics don't depend on the number of threads.
+namespace cpu_norm_detail {
+
+constexpr std::size_t BlockSize = 256;
+
+// Pieces of segments are not made shorter than this.
+constexpr std::size_t MinPieceSize = std::size_t{1} << 14;
+
+// Below this amount of values spawning threads costs more than it saves.
+constexpr std::size_t ParallelThreshold = std::size_t{1} << 16;
+
+template <class F>
+void ForEach(std::size_t n, std::size_t values, F f)
+{
+    if(n > 1 && values >= ParallelThreshold)
+    {
+        miopen::par_for(n, miopen::max_threads{n}, f);
+    }
+    else
+    {
+        for(std::size_t i = 0; i < n; ++i)
+            f(i);
+    }
+}
+
+} // namespace cpu_norm_detail
+
+struct welford_moments
+{
+    double count = 0;
+    double mean  = 0;
+    double m2    = 0; // sum of squared deviations from the mean
+
+    double variance() const { return count == 0 ? 0 : m2 / count; }
+
+    // Chan, Golub and LeVeque, "Updating formulae and a pairwise algorithm for computing sample
+    // variances", 1979.
+    void merge(const welford_moments& other)
+    {
+        if(other.count == 0)
+            return;
+        const auto total = count + other.count;
+        const auto delta = other.mean - mean;
+        mean += delta * (other.count / total);
+        m2 += other.m2 + delta * delta * (count * other.count / total);
+        count = total;
+    }
+};
+
+// Moments of load(i) for i in [begin, end).
+template <class Load>
+welford_moments welford_accumulate(std::size_t begin, std::size_t end, Load load)
+{
+    using cpu_norm_detail::BlockSize;
+
+    auto result = welford_moments{};
+    double block[BlockSize];
+
+    for(auto first = begin; first < end; first += BlockSize)
+    {
+        const auto n = std::min(BlockSize, end - first);
+
+        auto sum = 0.0;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            block[i] = static_cast<double>(load(first + i));
+            sum += block[i];
+        }
+
+        const auto mean = sum / n;
+        auto m2         = 0.0;
+        for(std::size_t i = 0; i < n; ++i)
+        {
+            const auto deviation = block[i] - mean;
+            m2 += deviation * deviation;
+        }
+
+        result.merge({static_cast<double>(n), mean, m2});
+    }
+
+    return result;
+}
+
+// Moments of each of `groups` groups made of `segments` segments of `length` values, where
+// load(group, segment, i) returns the i-th value of a segment.
+template <class Load>
+std::vector<welford_moments>
+cpu_norm_moments(std::size_t groups, std::size_t segments, std::size_t length, Load load)
+{
+    using cpu_norm_detail::MinPieceSize;
+
+    const auto threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    const auto parts   = groups * segments;
+
+    auto pieces = std::size_t{1};
+    if(parts != 0 && parts < threads)
+    {
+        pieces = std::min((threads + parts - 1) / parts,
+                          std::max<std::size_t>(length / MinPieceSize, 1));
+    }
+    const auto piece_length = (length + pieces - 1) / pieces;
+
+    auto partial = std::vector<welford_moments>(parts * pieces);
+    cpu_norm_detail::ForEach(partial.size(), parts * length, [&](std::size_t task) {
+        const auto group   = task / (segments * pieces);
+        const auto segment = task / pieces % segments;
+        const auto begin   = std::min(length, task % pieces * piece_length);
+        const auto end     = std::min(length, begin + piece_length);
+
+        partial[task] =
+            welford_accumulate(begin, end, [&](std::size_t i) { return load(group, segment, i); });
+    });
+
+    auto result = std::vector<welford_moments>(groups);
+    for(std::size_t task = 0; task < partial.size(); ++task)
+        result[task / (segments * pieces)].merge(partial[task]);
+    return result;
+}
+
+// Calls f(i) for i in [0, n) on multiple threads when the total amount of values is large
+// enough, e.g. to apply the normalization once the statistics are known.
+template <class F>
+void cpu_norm_for_each(std::size_t n, std::size_t values, F f)
+{
+    cpu_norm_detail::ForEach(n, values, f);
+}
+
+#endif // GUARD_CPU_NORM_HPP
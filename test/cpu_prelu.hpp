@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include "cpu_tensor_walk.hpp"
 #include "tensor_holder.hpp"
 #include <miopen/tensor_view_utils.hpp>
 
@@ -47,27 +48,28 @@ void cpu_prelu_backward(const tensor<T> input,
 
     auto weight_grad_collector = std::vector<float>(N);
 
-    par_ford(N)([&](int gid) {
-        auto tensor_layout = tensor_layout_t<5>(input_tv, gid);
-        float input_v      = static_cast<float>(input[input_tv.get_tensor_view_idx(tensor_layout)]);
-        float grad_v =
-            static_cast<float>(output_grad[output_grad_tv.get_tensor_view_idx(tensor_layout)]);
+    const auto* x       = input.data.data();
+    const auto* w       = weight.data.data();
+    const auto* dy      = output_grad.data.data();
+    auto* dx            = ref_input_grad.data.data();
+    auto* dw            = weight_grad_collector.data();
+    const auto single_w = weight.desc.GetElementSize() == 1;
+    const auto w_stride = weight_tv.stride[0];
+
+    tensor_walk(std::array{input_tv, output_grad_tv, input_grad_tv}, [&](const auto& pos) {
+        float input_v = static_cast<float>(x[pos.offset[0]]);
+        float grad_v  = static_cast<float>(dy[pos.offset[1]]);
 
         if(has_dinput)
         {
-            float weight_v;
-            weight_v = static_cast<float>(
-                weight[weight.desc.GetElementSize() == 1
-                           ? 0
-                           : weight_tv.get_tensor_view_idx({tensor_layout.layout[1]})]);
+            float weight_v = static_cast<float>(w[single_w ? 0 : pos.layout.layout[1] * w_stride]);
 
             float input_grad_v = input_v > 0 ? grad_v : weight_v * grad_v;
-            ref_input_grad[input_grad_tv.get_tensor_view_idx(tensor_layout)] =
-                static_cast<T>(input_grad_v);
+            dx[pos.offset[2]]  = static_cast<T>(input_grad_v);
         }
         if(has_dweight)
         {
-            weight_grad_collector[gid] = input_v > 0 ? 0 : input_v * grad_v;
+            dw[pos.index] = input_v > 0 ? 0 : input_v * grad_v;
         }
     });
 
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "miopen/miopen.h"
+#include "cpu_tensor_walk.hpp"
 #include "tensor_holder.hpp"
 #include <miopen/tensor_view_utils.hpp>
 
@@ -40,18 +41,26 @@ void cpu_softmarginloss_forward(const tensor<T>& input,
     auto t_tv        = miopen::get_inner_expanded_tv<5>(target.desc);
     auto o_tv        = miopen::get_inner_expanded_tv<5>(ref_output.desc);
 
-    double sum_loss = 0;
-    for(size_t gid = 0; gid < input_numel; gid++)
+    const auto* x = input.data.data();
+    const auto* y = target.data.data();
+    auto* out     = ref_output.data.data();
+
+    if(reduction_mode == MIOPEN_LOSS_REDUCTION_NONE)
     {
-        tensor_layout_t<5> idx(i_tv, gid);
-        // Convert to double for better precision
-        double i = input[i_tv.get_tensor_view_idx(idx)];
-        double t = target[t_tv.get_tensor_view_idx(idx)];
-        if(reduction_mode == MIOPEN_LOSS_REDUCTION_NONE)
-            ref_output[o_tv.get_tensor_view_idx(idx)] = log1p(exp(-i * t));
-        else
-            sum_loss += log1p(exp(-i * t));
-    };
+        tensor_walk(std::array{i_tv, t_tv, o_tv}, [&](const auto& pos) {
+            // Convert to double for better precision
+            double i           = x[pos.offset[0]];
+            double t           = y[pos.offset[1]];
+            out[pos.offset[2]] = log1p(exp(-i * t));
+        });
+        return;
+    }
+
+    double sum_loss = tensor_walk_sum(std::array{i_tv, t_tv}, [&](const auto& pos) {
+        double i = x[pos.offset[0]];
+        double t = y[pos.offset[1]];
+        return log1p(exp(-i * t));
+    });
 
     if(reduction_mode == MIOPEN_LOSS_REDUCTION_MEAN)
         ref_output[0] = sum_loss / input_numel;
@@ -72,15 +81,18 @@ void cpu_softmarginloss_backward(const tensor<T>& input,
     auto dO_tv       = miopen::get_inner_expanded_tv<5>(dO.desc);
     auto dI_tv       = miopen::get_inner_expanded_tv<5>(ref_dI.desc);
 
-    par_ford(input_numel)([&](size_t gid) {
-        tensor_layout_t<5> idx(i_tv, gid);
+    const auto* x  = input.data.data();
+    const auto* y  = target.data.data();
+    const auto* dy = dO.data.data();
+    auto* dx       = ref_dI.data.data();
+
+    const double divisor = reduction_mode != MIOPEN_LOSS_REDUCTION_MEAN ? 1.0 : input_numel;
+
+    tensor_walk(std::array{i_tv, t_tv, dO_tv, dI_tv}, [&](const auto& pos) {
         // Convert to double for better precision
-        double i   = input[i_tv.get_tensor_view_idx(idx)];
-        double t   = target[t_tv.get_tensor_view_idx(idx)];
-        double _dO = dO[dO_tv.get_tensor_view_idx(idx)];
-        if(reduction_mode != MIOPEN_LOSS_REDUCTION_MEAN)
-            ref_dI[dI_tv.get_tensor_view_idx(idx)] = -t / (exp(i * t) + 1) * _dO;
-        else
-            ref_dI[dI_tv.get_tensor_view_idx(idx)] = -t / (exp(i * t) + 1) * _dO / input_numel;
+        double i          = x[pos.offset[0]];
+        double t          = y[pos.offset[1]];
+        double _dO        = dy[pos.offset[2]];
+        dx[pos.offset[3]] = -t / (exp(i * t) + 1) * _dO / divisor;
     });
 }
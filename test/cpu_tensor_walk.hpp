@@ -0,0 +1,200 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CPU_TENSOR_WALK_HPP
+#define GUARD_CPU_TENSOR_WALK_HPP
+
+#include <miopen/par_for.hpp>
+#include <miopen/tensor_view_utils.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Iteration over N-d strided tensor views for the host references.
+//
+// tensor_walk visits the elements of the shape of the first view in row-major order and gives the
+// callback the linear index, the coordinates and the offset of the element in every view. Only
+// the first element of a range has its coordinates computed with the div/mod chain of
+// tensor_layout_t; the next ones are reached by adding the strides of the innermost dimension
+// and carrying into the outer ones. Runs along the innermost dimension are plain loops, with a
+// separate unit stride version that the compiler can vectorize.
+//
+// The range is split into chunks of a fixed size, which are spread across threads once there are
+// enough elements. tensor_walk_sum merges the per-chunk sums in order, so its result doesn't
+// depend on the number of threads.
+namespace cpu_tensor_walk_detail {
+
+constexpr std::uint64_t ChunkSize = std::uint64_t{1} << 14;
+
+template <int N, std::size_t M>
+struct position
+{
+    std::uint64_t index;
+    tensor_layout_t<N> layout;
+    std::array<std::uint64_t, M> offset;
+};
+
+template <int N, std::size_t M>
+std::uint64_t element_count(const std::array<tensor_view_t<N>, M>& views)
+{
+    auto count = std::uint64_t{1};
+    for(auto i = 0; i < N; ++i)
+        count *= views[0].size[i];
+    return count;
+}
+
+template <int N, std::size_t M, class F>
+void walk_range(const std::array<tensor_view_t<N>, M>& views,
+                std::uint64_t begin,
+                std::uint64_t end,
+                F& f)
+{
+    constexpr auto inner = N - 1;
+    const auto& shape    = views[0];
+    if(begin >= end)
+        return;
+
+    auto pos = position<N, M>{begin, tensor_layout_t<N>(shape, begin), {}};
+    for(std::size_t k = 0; k < M; ++k)
+    {
+        for(auto d = 0; d < N; ++d)
+            pos.offset[k] += views[k].stride[d] * pos.layout.layout[d];
+    }
+
+    const auto unit_stride = std::all_of(
+        views.begin(), views.end(), [](const auto& view) { return view.stride[inner] == 1; });
+
+    while(pos.index < end)
+    {
+        const auto run =
+            std::min<std::uint64_t>(shape.size[inner] - pos.layout.layout[inner], end - pos.index);
+        const auto start = pos;
+
+        if(unit_stride)
+        {
+            for(std::uint64_t j = 0; j < run; ++j)
+            {
+                pos.index                = start.index + j;
+                pos.layout.layout[inner] = start.layout.layout[inner] + j;
+                for(std::size_t k = 0; k < M; ++k)
+                    pos.offset[k] = start.offset[k] + j;
+                f(pos);
+            }
+        }
+        else
+        {
+            for(std::uint64_t j = 0; j < run; ++j)
+            {
+                pos.index                = start.index + j;
+                pos.layout.layout[inner] = start.layout.layout[inner] + j;
+                for(std::size_t k = 0; k < M; ++k)
+                    pos.offset[k] = start.offset[k] + j * views[k].stride[inner];
+                f(pos);
+            }
+        }
+
+        pos = start;
+        pos.index += run;
+        pos.layout.layout[inner] += run;
+        for(std::size_t k = 0; k < M; ++k)
+            pos.offset[k] += run * views[k].stride[inner];
+
+        for(auto d = inner; d > 0 && pos.layout.layout[d] == shape.size[d]; --d)
+        {
+            pos.layout.layout[d] = 0;
+            ++pos.layout.layout[d - 1];
+            for(std::size_t k = 0; k < M; ++k)
+                pos.offset[k] += views[k].stride[d - 1] - shape.size[d] * views[k].stride[d];
+        }
+    }
+}
+
+} // namespace cpu_tensor_walk_detail
+
+// Position of an element during a walk: its linear index in the shape of the first view, its
+// coordinates, and its offset in each of the views.
+template <int N, std::size_t M>
+using tensor_walk_position = cpu_tensor_walk_detail::position<N, M>;
+
+// Calls f(const tensor_walk_position<N, M>&) for every element of the shape of views[0]. Chunks of
+// elements are processed concurrently, so f must not write where another element also does.
+template <int N, std::size_t M, class F>
+void tensor_walk(const std::array<tensor_view_t<N>, M>& views, F f)
+{
+    using namespace cpu_tensor_walk_detail;
+
+    const auto count  = element_count(views);
+    const auto chunks = (count + ChunkSize - 1) / ChunkSize;
+    if(chunks <= 1)
+    {
+        walk_range(views, 0, count, f);
+        return;
+    }
+
+    miopen::par_for(chunks, miopen::max_threads{chunks}, [&](std::size_t chunk) {
+        walk_range(views, chunk * ChunkSize, std::min(count, (chunk + 1) * ChunkSize), f);
+    });
+}
+
+// Same as tensor_walk, but on the calling thread and strictly in order, for the references which
+// accumulate into shared outputs.
+template <int N, std::size_t M, class F>
+void tensor_walk_serial(const std::array<tensor_view_t<N>, M>& views, F f)
+{
+    cpu_tensor_walk_detail::walk_range(views, 0, cpu_tensor_walk_detail::element_count(views), f);
+}
+
+// Sum of f(const tensor_walk_position<N, M>&) over every element of the shape of views[0].
+template <int N, std::size_t M, class F>
+double tensor_walk_sum(const std::array<tensor_view_t<N>, M>& views, F f)
+{
+    using namespace cpu_tensor_walk_detail;
+
+    const auto count  = element_count(views);
+    const auto chunks = (count + ChunkSize - 1) / ChunkSize;
+    auto sums         = std::vector<double>(std::max<std::uint64_t>(chunks, 1), 0.0);
+
+    const auto sum_chunk = [&](std::size_t chunk) {
+        auto sum = 0.0;
+        auto add = [&](const auto& pos) { sum += f(pos); };
+        walk_range(views, chunk * ChunkSize, std::min(count, (chunk + 1) * ChunkSize), add);
+        sums[chunk] = sum;
+    };
+
+    if(chunks <= 1)
+        sum_chunk(0);
+    else
+        miopen::par_for(chunks, miopen::max_threads{chunks}, sum_chunk);
+
+    auto sum = 0.0;
+    for(const auto partial : sums)
+        sum += partial;
+    return sum;
+}
+
+#endif // GUARD_CPU_TENSOR_WALK_HPP
@@ -36,6 +36,7 @@
 #include <miopen/solution.hpp>
 
 #include <miopen/solver_id.hpp>
+#include <miopen/tmp_dir.hpp>
 
 #include <nlohmann/json.hpp>
 
@@ -128,6 +129,7 @@ private:
         const auto solutions = TestFindSolutionsWithOptions(handle, problem);
 
         TestSolutionAttributes(solutions);
+        TestSolutionBundle(handle, solutions);
         TestRunSolutions(handle, solutions);
 
         EXPECT_EQUAL(miopenDestroyProblem(problem), miopenStatusSuccess);
@@ -278,6 +280,49 @@ private:
         std::cerr << "Finished testing miopenGetSolution<Attribute>." << std::endl;
     }
 
+    void TestSolutionBundle(miopenHandle_t handle, const std::vector<miopenSolution_t>& solutions)
+    {
+        std::cerr << "Testing miopenSaveSolutionBundle..." << std::endl;
+
+        const TmpDir dir{"find_2_conv"};
+        const auto path = (dir / "solutions.bundle").string();
+
+        EXPECT_EQUAL(miopenSaveSolutionBundle(path.c_str(), solutions.data(), solutions.size()),
+                     miopenStatusSuccess);
+
+        std::size_t bundle_size;
+        EXPECT_EQUAL(miopenGetSolutionBundleSize(path.c_str(), &bundle_size), miopenStatusSuccess);
+        EXPECT_EQUAL(bundle_size, solutions.size());
+
+        std::cerr << "Testing miopenLoadSolutionBundle..." << std::endl;
+        auto read_solutions = std::vector<miopenSolution_t>(bundle_size);
+        std::size_t read_count;
+        EXPECT_EQUAL(miopenLoadSolutionBundle(
+                         path.c_str(), read_solutions.data(), &read_count, read_solutions.size()),
+                     miopenStatusSuccess);
+        EXPECT_EQUAL(read_count, solutions.size());
+
+        miopenTensorDescriptor_t x_desc = &x.desc, w_desc = &w.desc, y_desc = &y.desc;
+        miopenTensorArgumentId_t names[3] = {
+            miopenTensorConvolutionX, miopenTensorConvolutionW, miopenTensorConvolutionY};
+        void* buffers[3]                        = {x_dev.get(), w_dev.get(), y_dev.get()};
+        miopenTensorDescriptor_t descriptors[3] = {x_desc, w_desc, y_desc};
+
+        for(auto i = 0; i < read_count; ++i)
+        {
+            uint64_t solver_id, read_solver_id;
+            EXPECT_EQUAL(miopenGetSolutionSolverId(solutions[i], &solver_id), miopenStatusSuccess);
+            EXPECT_EQUAL(miopenGetSolutionSolverId(read_solutions[i], &read_solver_id),
+                         miopenStatusSuccess);
+            EXPECT_EQUAL(solver_id, read_solver_id);
+
+            TestRunSolution(handle, read_solutions[i], 3, names, descriptors, buffers);
+            EXPECT_EQUAL(miopenDestroySolution(read_solutions[i]), miopenStatusSuccess);
+        }
+
+        std::cerr << "Finished testing solution bundles." << std::endl;
+    }
+
     void TestRunSolutions(miopenHandle_t handle, const std::vector<miopenSolution_t>& solutions)
     {
         std::cerr << "Testing solution functions..." << std::endl;
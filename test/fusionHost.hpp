@@ -36,6 +36,7 @@
 #include <miopen/miopen.h>
 #include <miopen/tensor.hpp>
 #include <utility>
+#include "cpu_norm.hpp"
 #include "get_handle.hpp"
 #include "tensor_holder.hpp"
 #include "verify.hpp"
@@ -220,33 +221,19 @@ void batchNormSpatialHostFwdTrain(const tensor<T>& input,
     std::tie(n_batch, channels, height, width) = miopen::tien<4>(input.desc.GetLengths());
     const auto nhw                             = double(height * width * n_batch);
 
+    const auto moments = cpu_norm_moments(
+        channels, n_batch, height * width, [&](std::size_t cidx, std::size_t bidx, std::size_t i) {
+            return static_cast<double>(input(bidx, cidx, i / width, i % width));
+        });
+
     par_for(channels, 1, [&](int cidx) {
         double elemStd        = 0.;
-        double variance_accum = 0.;
-        double mean_accum     = 0.;
+        double variance_accum = moments[cidx].variance();
+        double mean_accum     = moments[cidx].mean;
         double invVar         = 0.;
         double newRunMean     = 0.;
         double adjust         = 0.;
 
-        // process the batch per channel
-        for(int bidx = 0; bidx < n_batch; bidx++)
-        { // via mini_batch
-            for(int row = 0; row < height; row++)
-            { // via rows
-                for(int column = 0; column < width; column++)
-                { // via columns
-                    // #1 calculate the mean
-                    // iterating through the stack of images in the mini_batch
-                    auto inval = static_cast<double>(input(bidx, cidx, row, column));
-                    mean_accum += inval;
-                    variance_accum += inval * inval;
-                } // end for (column)
-            }     // end for (row)
-        }         // end for (n)
-
-        mean_accum /= nhw;
-        variance_accum /= nhw;
-        variance_accum += (-mean_accum * mean_accum);
         invVar = 1.0 / sqrt(variance_accum + epsilon);
 
         // #4 apply the normalization
@@ -501,6 +488,12 @@ void batchNormPerActHostFwdTrain(const tensor<T>& input,
     std::tie(n_batch, channels, height, width) = miopen::tien<4>(input.desc.GetLengths());
     const auto n                               = double(n_batch);
 
+    const auto moments = cpu_norm_moments(
+        channels * height * width, 1, n_batch, [&](std::size_t pos, std::size_t, std::size_t bidx) {
+            return static_cast<double>(
+                input(bidx, pos / (height * width), pos / width % height, pos % width));
+        });
+
     par_for(channels, 1, [&](int cidx) {
         double mean_accum     = 0.;
         double variance_accum = 0.;
@@ -516,20 +509,10 @@ void batchNormPerActHostFwdTrain(const tensor<T>& input,
             for(int column = 0; column < width; column++)
             { // via columns
 
-                mean_accum     = 0.;
-                variance_accum = 0.;
-                for(int bidx = 0; bidx < n_batch; bidx++)
-                { // via mini_batch
-                    // #1 calculate the mean :: iterating through the stack of images in the
-                    // mini_batch
-                    auto intval = static_cast<double>(input(bidx, cidx, row, column));
-                    mean_accum += intval;
-                    variance_accum += intval * intval;
-                }
-                mean_accum /= n;
-                variance_accum /= n;
-                variance_accum = variance_accum - (mean_accum * mean_accum);
-                elemInvVar     = 1.0 / double(sqrt(variance_accum + epsilon));
+                const auto& stats = moments[(cidx * height + row) * width + column];
+                mean_accum        = stats.mean;
+                variance_accum    = stats.variance();
+                elemInvVar        = 1.0 / double(sqrt(variance_accum + epsilon));
 
                 // #4 apply the normalization :: x_hat = (x_i - mean) / sqrt(variance_accum -
                 // epsilon)
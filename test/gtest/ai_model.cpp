@@ -0,0 +1,292 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/config.h>
+#if MIOPEN_ENABLE_AI_IMMED_MODE_FALLBACK || MIOPEN_ENABLE_AI_KERNEL_TUNING
+#include <miopen/conv/heuristics/ai_model.hpp>
+#include <miopen/conv/heuristics/ai_model_format.hpp>
+#include <miopen/db_path.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace format = miopen::ai::model_format;
+
+namespace {
+
+format::Node MakeNode(format::LayerType type,
+                      std::vector<format::NodeOutput> inputs,
+                      std::vector<std::uint32_t> params)
+{
+    auto node       = format::Node{};
+    node.type       = type;
+    node.num_inputs = static_cast<std::uint32_t>(inputs.size());
+    std::copy(inputs.begin(), inputs.end(), node.inputs);
+    std::copy(params.begin(), params.end(), node.params);
+    std::fill(std::begin(node.weights), std::end(node.weights), format::NoWeights);
+    return node;
+}
+
+void WriteModel(const miopen::fs::path& path,
+                const std::vector<format::Node>& nodes,
+                const std::vector<format::NodeOutput>& outputs,
+                const std::vector<float>& data)
+{
+    auto header = format::Header{};
+    std::copy(std::begin(format::Magic), std::end(format::Magic), header.magic);
+    header.version     = format::Version;
+    header.num_nodes   = static_cast<std::uint32_t>(nodes.size());
+    header.num_outputs = static_cast<std::uint32_t>(outputs.size());
+    header.data_offset = (sizeof(header) + nodes.size() * sizeof(format::Node) +
+                          outputs.size() * sizeof(format::NodeOutput) + format::DataAlignment - 1) /
+                         format::DataAlignment * format::DataAlignment;
+    header.data_size   = data.size();
+
+    auto bytes = std::vector<char>(header.data_offset + data.size() * sizeof(float));
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    std::memcpy(bytes.data() + sizeof(header), nodes.data(), nodes.size() * sizeof(nodes[0]));
+    std::memcpy(bytes.data() + sizeof(header) + nodes.size() * sizeof(nodes[0]),
+                outputs.data(),
+                outputs.size() * sizeof(outputs[0]));
+    std::memcpy(bytes.data() + header.data_offset, data.data(), data.size() * sizeof(float));
+
+    auto file = std::ofstream{path, std::ios::binary};
+    file.write(bytes.data(), bytes.size());
+}
+
+std::vector<float> DecodeFloats(const nlohmann::json& chunks)
+{
+    constexpr auto alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    auto bytes              = std::vector<char>{};
+    auto value              = 0u;
+    auto bits               = 0;
+    for(const auto& chunk : chunks)
+    {
+        for(const auto c : chunk.get<std::string>())
+        {
+            const auto digit = std::strchr(alphabet, c);
+            if(c == '=' || digit == nullptr)
+                break;
+            value = (value << 6) | static_cast<unsigned>(digit - alphabet);
+            bits += 6;
+            if(bits >= 8)
+            {
+                bits -= 8;
+                bytes.push_back(static_cast<char>((value >> bits) & 0xFF));
+            }
+        }
+    }
+    auto floats = std::vector<float>(bytes.size() / sizeof(float));
+    std::memcpy(floats.data(), bytes.data(), floats.size() * sizeof(float));
+    return floats;
+}
+
+} // namespace
+
+TEST(CPU_AiModel_NONE, PredictsSmallNetwork)
+{
+    const miopen::TmpDir dir{"ai_model"};
+    // y = relu(x * W + b) + x
+    const auto nodes = std::vector<format::Node>{
+        MakeNode(format::LayerType::Input, {}, {1, 2}),
+        [] {
+            auto dense       = MakeNode(format::LayerType::Dense, {{0, 0}}, {2, 2});
+            dense.weights[0] = 0;
+            dense.weights[1] = 4;
+            return dense;
+        }(),
+        MakeNode(format::LayerType::ReLU, {{1, 0}}, {}),
+        MakeNode(format::LayerType::Add, {{2, 0}, {0, 0}}, {}),
+    };
+    WriteModel(dir / "model.bin", nodes, {{3, 0}, {1, 0}}, {1, 2, 3, 4, 0.5f, -10});
+
+    const auto network = miopen::ai::Network{dir / "model.bin"};
+    const auto outputs = network.Predict({{1, -1}});
+    ASSERT_EQ(outputs.size(), 2);
+    EXPECT_EQ(outputs[0], (std::vector<float>{1, -1}));
+    EXPECT_EQ(outputs[1], (std::vector<float>{-1.5f, -12}));
+    EXPECT_ANY_THROW(std::ignore = network.Predict({{1, 2, 3}}));
+}
+
+TEST(CPU_AiModel_NONE, PredictsLstm)
+{
+    const miopen::TmpDir dir{"ai_model"};
+    auto lstm       = MakeNode(format::LayerType::LSTM, {{0, 0}}, {1, 1, 1});
+    lstm.weights[0] = 0;
+    lstm.weights[1] = 4;
+    lstm.weights[2] = 8;
+    const auto w    = std::vector<float>{0.5f, -0.25f, 1.5f, 0.75f};
+    const auto u    = std::vector<float>{-1.0f, 0.5f, 0.25f, 2.0f};
+    const auto b    = std::vector<float>{0.1f, 1.0f, -0.2f, 0.3f};
+    auto data       = w;
+    data.insert(data.end(), u.begin(), u.end());
+    data.insert(data.end(), b.begin(), b.end());
+    WriteModel(dir / "model.bin",
+               {MakeNode(format::LayerType::Input, {}, {3, 1}), lstm},
+               {{1, 0}, {1, 2}},
+               data);
+
+    const auto x = std::vector<float>{1.0f, -2.0f, 0.5f};
+    auto h       = 0.0f;
+    auto c       = 0.0f;
+    auto hs      = std::vector<float>{};
+    for(const auto xt : x)
+    {
+        const auto sigmoid = [](float v) { return 1.0f / (1.0f + std::exp(-v)); };
+        const auto i       = sigmoid(xt * w[0] + h * u[0] + b[0]);
+        const auto f       = sigmoid(xt * w[1] + h * u[1] + b[1]);
+        const auto g       = std::tanh(xt * w[2] + h * u[2] + b[2]);
+        const auto o       = sigmoid(xt * w[3] + h * u[3] + b[3]);
+        c                  = f * c + i * g;
+        h                  = o * std::tanh(c);
+        hs.push_back(h);
+    }
+
+    const auto network = miopen::ai::Network{dir / "model.bin"};
+    EXPECT_EQ(network.GetInputSizes(), std::vector<std::size_t>{3});
+    const auto outputs = network.Predict({x});
+    ASSERT_EQ(outputs.size(), 2);
+    ASSERT_EQ(outputs[0].size(), 3);
+    ASSERT_EQ(outputs[1].size(), 1);
+    for(auto t = std::size_t{0}; t < x.size(); ++t)
+        EXPECT_NEAR(outputs[0][t], hs[t], 1e-6f);
+    EXPECT_NEAR(outputs[1][0], c, 1e-6f);
+}
+
+TEST(CPU_AiModel_NONE, PredictsConcurrently)
+{
+    const miopen::TmpDir dir{"ai_model"};
+    auto dense       = MakeNode(format::LayerType::Dense, {{0, 0}}, {64, 48});
+    dense.weights[0] = 0;
+    auto weights     = std::vector<float>(64 * 48);
+    for(auto i = std::size_t{0}; i < weights.size(); ++i)
+        weights[i] = static_cast<float>(i % 7) - 3.0f;
+    WriteModel(dir / "model.bin",
+               {MakeNode(format::LayerType::Input, {}, {2, 64}),
+                dense,
+                MakeNode(format::LayerType::ReLU, {{1, 0}}, {})},
+               {{2, 0}},
+               weights);
+
+    const auto network = miopen::ai::Network{dir / "model.bin"};
+    const auto input   = [](int seed) {
+        auto values = std::vector<float>(2 * 64);
+        for(auto i = std::size_t{0}; i < values.size(); ++i)
+            values[i] = static_cast<float>((i + seed) % 5) * 0.5f - 1.0f;
+        return values;
+    };
+
+    auto expected = std::vector<std::vector<float>>{};
+    for(auto seed = 0; seed < 4; ++seed)
+        expected.push_back(network.Predict({input(seed)}).front());
+
+    auto threads = std::vector<std::thread>{};
+    auto results = std::vector<std::vector<float>>(expected.size());
+    for(auto seed = 0; seed < 4; ++seed)
+    {
+        threads.emplace_back([&, seed]() {
+            for(auto i = 0; i < 100; ++i)
+                results[seed] = network.Predict({input(seed)}).front();
+        });
+    }
+    for(auto& thread : threads)
+        thread.join();
+    EXPECT_EQ(results, expected);
+}
+
+TEST(CPU_AiModel_NONE, RejectsInvalidModels)
+{
+    const miopen::TmpDir dir{"ai_model"};
+    {
+        auto file = std::ofstream{dir / "text.bin", std::ios::binary};
+        file << "not a model, but long enough for the header of one";
+    }
+    EXPECT_ANY_THROW(miopen::ai::Network{dir / "text.bin"});
+
+    // The weights of the layer are past the end of the data.
+    auto dense       = MakeNode(format::LayerType::Dense, {{0, 0}}, {2, 2});
+    dense.weights[0] = 2;
+    WriteModel(dir / "model.bin",
+               {MakeNode(format::LayerType::Input, {}, {1, 2}), dense},
+               {{1, 0}},
+               {1, 2, 3, 4});
+    const auto network = miopen::ai::Network{dir / "model.bin"};
+    EXPECT_ANY_THROW(std::ignore = network.Predict({{1, 2}}));
+    // The layers are resolved again, from scratch, by the next prediction.
+    EXPECT_ANY_THROW(std::ignore = network.Predict({{1, 2}}));
+}
+
+TEST(CPU_AiModel_NONE, MatchesKerasTestVectors)
+{
+    auto num_models = 0;
+    for(const auto& entry : miopen::fs::directory_iterator{miopen::GetSystemDbPath()})
+    {
+        const auto& path = entry.path();
+        if(path.extension() != ".bin" ||
+           (path.stem().extension() != ".tn" && path.stem().extension() != ".ktn"))
+            continue;
+        auto json_path = path;
+        json_path.replace_extension(".model");
+        const auto model = nlohmann::json::parse(std::ifstream{json_path});
+        if(!model.contains("tests"))
+            continue;
+
+        const auto network = miopen::ai::Network{path};
+        for(const auto& test : model["tests"])
+        {
+            auto inputs = std::vector<std::vector<float>>{};
+            for(const auto& input : test["inputs"])
+                inputs.push_back(DecodeFloats(input["values"]));
+            const auto outputs = network.Predict(inputs);
+
+            ASSERT_EQ(outputs.size(), test["outputs"].size()) << path;
+            for(auto i = std::size_t{0}; i < outputs.size(); ++i)
+            {
+                const auto expected = DecodeFloats(test["outputs"][i]["values"]);
+                ASSERT_EQ(outputs[i].size(), expected.size()) << path;
+                for(auto j = std::size_t{0}; j < expected.size(); ++j)
+                    EXPECT_NEAR(outputs[i][j], expected[j], 1e-4f + 1e-4f * std::abs(expected[j]))
+                        << path << ", output " << i << ", element " << j;
+            }
+        }
+        ++num_models;
+    }
+    if(num_models == 0)
+        GTEST_SKIP() << "No binary models in " << miopen::GetSystemDbPath();
+}
+#endif
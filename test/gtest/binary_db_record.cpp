@@ -0,0 +1,129 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/binary_db_record.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <tuple>
+
+namespace {
+
+const std::string TextRecord = "1-16-16-3x3-64-16-16-1-1x1-1x1-1x1-0-NCHW-FP32-F="
+                               "ConvOclDirectFwd:0.0305,0,miopenConvolutionFwdAlgoDirect;"
+                               "GemmFwd1x1_0_1:0.1,4096,miopenConvolutionFwdAlgoGEMM;"
+                               "ConvBinWinograd3x3U:0.0175,0,miopenConvolutionFwdAlgoWinograd;"
+                               "Custom:not,find,db,data,0.12345678";
+
+std::string ReadFile(const miopen::fs::path& path)
+{
+    auto file = std::ifstream{path, std::ios::binary};
+    return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+} // namespace
+
+TEST(CPU_BinaryDbRecord_NONE, RoundTrip)
+{
+    const auto record = miopen::BinaryDbRecord::ParseText(TextRecord);
+    ASSERT_TRUE(record);
+
+    const auto payload = miopen::BinaryDbRecord::Encode(*record);
+    EXPECT_LT(payload.size(), TextRecord.size());
+
+    const auto decoded = miopen::BinaryDbRecord::Decode(record->GetKey(), payload);
+    ASSERT_TRUE(decoded);
+    EXPECT_EQ(decoded->GetSize(), 4);
+
+    // The encoding sorts the IDs, so it does not depend on the order of the text.
+    EXPECT_EQ(miopen::BinaryDbRecord::Encode(*decoded), payload);
+
+    const auto text = miopen::BinaryDbRecord::ToText(*decoded);
+    EXPECT_NE(text.find("Custom:not,find,db,data,0.12345678"), std::string::npos);
+    EXPECT_NE(text.find("ConvOclDirectFwd:0.0305,0,miopenConvolutionFwdAlgoDirect"),
+              std::string::npos);
+}
+
+TEST(CPU_BinaryDbRecord_NONE, LazyAccess)
+{
+    const auto payload =
+        miopen::BinaryDbRecord::Encode(*miopen::BinaryDbRecord::ParseText(TextRecord));
+    const auto binary = miopen::BinaryDbRecord{payload};
+    ASSERT_TRUE(binary.IsValid());
+    EXPECT_EQ(binary.GetSize(), 4);
+    EXPECT_EQ(binary.GetId(0), "ConvBinWinograd3x3U");
+
+    auto data = miopen::FindDbData{};
+    ASSERT_TRUE(binary.GetValues("GemmFwd1x1_0_1", data));
+    EXPECT_EQ(data.time, 0.1f);
+    EXPECT_EQ(data.workspace, 4096);
+    EXPECT_EQ(data.algorithm, "miopenConvolutionFwdAlgoGEMM");
+
+    auto text = std::string{};
+    ASSERT_TRUE(binary.GetValues("ConvOclDirectFwd", text));
+    EXPECT_EQ(text, "0.0305,0,miopenConvolutionFwdAlgoDirect");
+    ASSERT_TRUE(binary.GetValues("Custom", text));
+    EXPECT_EQ(text, "not,find,db,data,0.12345678");
+
+    EXPECT_FALSE(binary.Contains("Missing"));
+    EXPECT_FALSE(binary.GetValues("Missing", text));
+}
+
+TEST(CPU_BinaryDbRecord_NONE, RejectsInvalidPayload)
+{
+    EXPECT_FALSE(miopen::BinaryDbRecord{""}.IsValid());
+    EXPECT_FALSE(miopen::BinaryDbRecord{"\x02\x01\x00"}.IsValid());
+
+    auto payload =
+        miopen::BinaryDbRecord::Encode(*miopen::BinaryDbRecord::ParseText(TextRecord));
+    payload.resize(payload.size() / 2);
+    const auto truncated = miopen::BinaryDbRecord{payload};
+
+    auto text = std::string{};
+    for(std::size_t i = 0; truncated.IsValid() && i < truncated.GetSize(); ++i)
+        std::ignore = truncated.GetValues(truncated.GetId(i), text);
+    EXPECT_FALSE(miopen::BinaryDbRecord::Decode("key", payload));
+}
+
+TEST(CPU_BinaryDbRecord_NONE, ConvertsFiles)
+{
+    const miopen::TmpDir dir{"binary_db_record"};
+    const auto text = TextRecord + "\nkey=id:values\n";
+    {
+        auto file = std::ofstream{dir / "db.txt", std::ios::binary};
+        file << text;
+    }
+
+    ASSERT_TRUE(miopen::BinaryDbRecord::ConvertTextToBinary(dir / "db.txt", dir / "db.bin"));
+    ASSERT_TRUE(miopen::BinaryDbRecord::ConvertBinaryToText(dir / "db.bin", dir / "db2.txt"));
+    ASSERT_TRUE(miopen::BinaryDbRecord::ConvertTextToBinary(dir / "db2.txt", dir / "db2.bin"));
+
+    EXPECT_EQ(ReadFile(dir / "db.bin"), ReadFile(dir / "db2.bin"));
+    EXPECT_LT(ReadFile(dir / "db.bin").size(), text.size());
+}
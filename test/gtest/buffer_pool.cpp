@@ -0,0 +1,169 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/buffer_pool.hpp>
+#include <miopen/handle.hpp>
+
+#include <gtest/gtest.h>
+
+#include "get_handle.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+struct CountingAllocator
+{
+    std::size_t allocated = 0;
+    std::size_t freed     = 0;
+
+    miopen::Allocator Get()
+    {
+        return {[](void* context, std::size_t size) {
+                    ++static_cast<CountingAllocator*>(context)->allocated;
+                    return std::malloc(size);
+                },
+                [](void* context, void* ptr) {
+                    ++static_cast<CountingAllocator*>(context)->freed;
+                    std::free(ptr);
+                },
+                this};
+    }
+};
+
+} // namespace
+
+TEST(CPU_BufferPool_NONE, SizeClasses)
+{
+    using miopen::BufferPool;
+
+    EXPECT_EQ(BufferPool::GetSizeClass(1), 256u);
+    EXPECT_EQ(BufferPool::GetSizeClass(256), 256u);
+    EXPECT_EQ(BufferPool::GetSizeClass(4096), 4096u);
+    EXPECT_EQ(BufferPool::GetSizeClass(4097), 5120u);
+    EXPECT_EQ(BufferPool::GetSizeClass(1000 * 1000), 1048576u);
+
+    for(std::size_t size = 1; size < 1000 * 1000; size = size * 3 + 1)
+    {
+        EXPECT_GE(BufferPool::GetSizeClass(size), size);
+        if(size > 1024)
+            EXPECT_LE(BufferPool::GetSizeClass(size), size + size / 4);
+    }
+}
+
+TEST(CPU_BufferPool_NONE, Recycles)
+{
+    CountingAllocator counting;
+    const auto allocator = counting.Get();
+    miopen::BufferPool pool{1024 * 1024};
+
+    void* first_ptr = nullptr;
+    {
+        auto first = pool.Get(allocator, 1000);
+        first_ptr  = first.get();
+    }
+    {
+        // Same size class, served from the idle buffer.
+        auto second = pool.Get(allocator, 900);
+        EXPECT_EQ(second.get(), first_ptr);
+        // Different size class.
+        auto third = pool.Get(allocator, 100 * 1000);
+        EXPECT_NE(third.get(), first_ptr);
+    }
+
+    const auto counters = pool.GetCounters();
+    EXPECT_EQ(counters.allocations, 2u);
+    EXPECT_EQ(counters.hits, 1u);
+    EXPECT_EQ(counters.misses, 2u);
+    EXPECT_EQ(counters.deallocations, 0u);
+    EXPECT_EQ(counters.in_use_bytes, 0u);
+    EXPECT_EQ(counting.allocated, 2u);
+    EXPECT_EQ(counting.freed, 0u);
+}
+
+TEST(CPU_BufferPool_NONE, RespectsCapacity)
+{
+    CountingAllocator counting;
+    const auto allocator = counting.Get();
+    miopen::BufferPool pool{8 * 1024};
+
+    {
+        auto small = pool.Get(allocator, 4 * 1024);
+        auto large = pool.Get(allocator, 16 * 1024);
+    }
+
+    // The buffer over the capacity is freed right away.
+    EXPECT_EQ(counting.freed, 1u);
+    EXPECT_EQ(pool.GetCounters().idle_bytes, 4u * 1024);
+
+    pool.SetCapacity(0);
+    EXPECT_EQ(counting.freed, 2u);
+    EXPECT_EQ(pool.GetCounters().idle_bytes, 0u);
+}
+
+TEST(CPU_BufferPool_NONE, Trims)
+{
+    CountingAllocator counting;
+    const auto allocator = counting.Get();
+    miopen::BufferPool pool{1024 * 1024};
+
+    {
+        auto buffers = std::vector<miopen::Allocator::ManageDataPtr>{};
+        for(std::size_t size : {1024, 2048, 4096})
+            buffers.push_back(pool.Get(allocator, size));
+    }
+    EXPECT_EQ(pool.GetCounters().idle_bytes, 7u * 1024);
+
+    // The largest buffers go first.
+    pool.Trim(4 * 1024);
+    EXPECT_EQ(pool.GetCounters().idle_bytes, 3u * 1024);
+    EXPECT_EQ(counting.freed, 1u);
+
+    pool.Trim();
+    EXPECT_EQ(counting.freed, 3u);
+    EXPECT_EQ(pool.GetCounters().deallocations, 3u);
+}
+
+TEST(CPU_BufferPool_NONE, Handle)
+{
+    auto&& handle = get_handle();
+    auto& pool    = handle.GetBufferPool();
+    pool.Trim();
+
+    const auto before = pool.GetCounters();
+    {
+        auto buffer = handle.CreateCached(1024);
+        ASSERT_NE(buffer.get(), nullptr);
+    }
+    {
+        auto buffer = handle.CreateCached(1024);
+    }
+    const auto after = pool.GetCounters();
+
+    EXPECT_EQ(after.allocations - before.allocations, 1u);
+    EXPECT_EQ(after.hits - before.hits, 1u);
+}
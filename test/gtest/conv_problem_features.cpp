@@ -0,0 +1,171 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/any_solver.hpp>
+#include <miopen/conv/problem_description.hpp>
+#include <miopen/conv/problem_features.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/solver_id.hpp>
+
+#include <gtest/gtest.h>
+
+#include "get_handle.hpp"
+
+#include <vector>
+
+namespace {
+
+using miopen::conv::FeatureBits;
+using miopen::conv::FeatureMask;
+using miopen::conv::IsFeatureMatch;
+using miopen::conv::ProblemFeature;
+
+struct FeaturesTestCase
+{
+    std::vector<std::size_t> in;
+    std::vector<std::size_t> wei;
+    std::vector<int> pads;
+    std::vector<int> strides;
+    std::vector<int> dilations;
+    int groups;
+};
+
+miopen::conv::ProblemDescription MakeProblem(const FeaturesTestCase& tc,
+                                             miopenDataType_t type,
+                                             miopenTensorLayout_t layout,
+                                             miopen::conv::Direction direction)
+{
+    const auto conv = miopen::ConvolutionDescriptor{
+        tc.pads, tc.strides, tc.dilations, std::vector<int>(tc.pads.size(), 0), tc.groups};
+    const auto x = miopen::TensorDescriptor{type, layout, tc.in};
+    const auto w = miopen::TensorDescriptor{type, layout, tc.wei};
+    const auto y = conv.GetForwardOutputTensorWithLayout(x, w, x.GetLayout_str(), type);
+
+    if(direction == miopen::conv::Direction::BackwardWeights)
+        return {y, w, x, conv, direction};
+    return {x, w, y, conv, direction};
+}
+
+std::vector<FeaturesTestCase> GetTestCases()
+{
+    // clang-format off
+    return {
+        {{2, 16, 14, 14}, {32, 16, 1, 1}, {0, 0}, {1, 1}, {1, 1}, 1},
+        {{2, 16, 14, 14}, {32, 16, 3, 3}, {1, 1}, {1, 1}, {1, 1}, 1},
+        {{2, 16, 14, 14}, {32, 16, 3, 3}, {1, 1}, {2, 2}, {1, 1}, 1},
+        {{2, 16, 14, 14}, {32, 16, 3, 3}, {2, 2}, {1, 1}, {2, 2}, 1},
+        {{2, 16, 14, 14}, {32,  4, 3, 3}, {1, 1}, {1, 1}, {1, 1}, 4},
+        {{2,  3, 32, 32}, {64,  3, 7, 7}, {3, 3}, {2, 2}, {1, 1}, 1},
+        {{2, 16, 4, 14, 14}, {32, 16, 3, 3, 3}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}, 1},
+        {{2, 16, 4, 14, 14}, {32, 16, 1, 1, 1}, {0, 0, 0}, {1, 1, 1}, {1, 1, 1}, 1},
+    };
+    // clang-format on
+}
+
+} // namespace
+
+TEST(CPU_ConvProblemFeatures_NONE, FeatureMask)
+{
+    const auto mask = FeatureMask(
+        {ProblemFeature::Spatial2d, ProblemFeature::TypeFp32, ProblemFeature::TypeFp16});
+
+    const auto fp32_2d = FeatureBits({ProblemFeature::Spatial2d,
+                                      ProblemFeature::TypeFp32,
+                                      ProblemFeature::LayoutNHWC,
+                                      ProblemFeature::TargetGfx11});
+    EXPECT_TRUE(IsFeatureMatch(fp32_2d, mask));
+    EXPECT_TRUE(IsFeatureMatch(0, mask));
+    EXPECT_TRUE(IsFeatureMatch(fp32_2d, miopen::conv::AnyFeatures));
+
+    const auto fp32_3d = FeatureBits({ProblemFeature::Spatial3d, ProblemFeature::TypeFp32});
+    EXPECT_FALSE(IsFeatureMatch(fp32_3d, mask));
+
+    // Mixed types are only accepted if all of them are.
+    const auto mixed = FeatureBits(
+        {ProblemFeature::Spatial2d, ProblemFeature::TypeFp16, ProblemFeature::TypeFp8});
+    EXPECT_FALSE(IsFeatureMatch(mixed, mask));
+}
+
+TEST(CPU_ConvProblemFeatures_NONE, Classify)
+{
+    const auto test_case = FeaturesTestCase{
+        {2, 16, 14, 14}, {32, 16, 3, 3}, {1, 1}, {1, 1}, {1, 1}, 1};
+    const auto problem =
+        MakeProblem(test_case, miopenHalf, miopenTensorNHWC, miopen::conv::Direction::Forward);
+
+    const auto expected = FeatureBits({ProblemFeature::LayoutNHWC,
+                                       ProblemFeature::TypeFp16,
+                                       ProblemFeature::Spatial2d,
+                                       ProblemFeature::DirectionForward,
+                                       ProblemFeature::GroupsOne,
+                                       ProblemFeature::StrideOne,
+                                       ProblemFeature::DilationOne,
+                                       ProblemFeature::Filter3x3,
+                                       ProblemFeature::TargetGfx90a});
+    EXPECT_EQ(miopen::conv::GetProblemFeatures(problem, "gfx90a"), expected);
+}
+
+/// The pre-filter must never reject a problem which the Solver would accept.
+TEST(GPU_ConvProblemFeatures_FP32, MaskIsNecessary)
+{
+    auto&& handle = get_handle();
+
+    const auto directions = {miopen::conv::Direction::Forward,
+                             miopen::conv::Direction::BackwardData,
+                             miopen::conv::Direction::BackwardWeights};
+
+    for(const auto& test_case : GetTestCases())
+    {
+        const auto is3d = test_case.in.size() == 5;
+        for(const auto type : {miopenFloat, miopenHalf, miopenBFloat16})
+        {
+            for(const auto layout : {is3d ? miopenTensorNCDHW : miopenTensorNCHW,
+                                     is3d ? miopenTensorNDHWC : miopenTensorNHWC})
+            {
+                for(const auto direction : directions)
+                {
+                    const auto problem = MakeProblem(test_case, type, layout, direction);
+                    const auto ctx     = [&] {
+                        auto tmp = miopen::ExecutionContext{&handle};
+                        problem.SetupFloats(tmp);
+                        return tmp;
+                    }();
+                    const auto features = miopen::conv::GetProblemFeatures(ctx, problem);
+
+                    for(const auto& id : miopen::solver::GetSolversByPrimitive(
+                            miopen::solver::Primitive::Convolution))
+                    {
+                        const auto solver = id.GetSolver();
+                        if(solver.IsEmpty() || !solver.IsApplicable(ctx, problem))
+                            continue;
+                        EXPECT_TRUE(IsFeatureMatch(features, solver.GetFeatureMask()))
+                            << id.ToString() << " rejected by its mask";
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,226 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "../rnn_util.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+struct GemmCase
+{
+    bool trans_a;
+    bool trans_b;
+    std::size_t m;
+    std::size_t n;
+    std::size_t k;
+
+    friend std::ostream& operator<<(std::ostream& os, const GemmCase& c)
+    {
+        return os << (c.trans_a ? "T" : "N") << (c.trans_b ? "T" : "N") << " m=" << c.m
+                  << " n=" << c.n << " k=" << c.k;
+    }
+};
+
+std::vector<float> RandomMatrix(std::size_t size, unsigned seed)
+{
+    auto gen  = std::mt19937{seed};
+    auto dist = std::uniform_real_distribution<float>{-1.0f, 1.0f};
+    auto data = std::vector<float>(size);
+    for(auto& x : data)
+        x = dist(gen);
+    return data;
+}
+
+void NaiveGemm(const GemmCase& c,
+               const float* a,
+               std::size_t lda,
+               const float* b,
+               std::size_t ldb,
+               float* out,
+               std::size_t ldc,
+               double alpha,
+               double beta)
+{
+    for(std::size_t i = 0; i < c.m; ++i)
+    {
+        for(std::size_t j = 0; j < c.n; ++j)
+        {
+            double acc = 0;
+            for(std::size_t p = 0; p < c.k; ++p)
+            {
+                const auto av = c.trans_a ? a[p * lda + i] : a[i * lda + p];
+                const auto bv = c.trans_b ? b[j * ldb + p] : b[p * ldb + j];
+                acc += static_cast<double>(av) * static_cast<double>(bv);
+            }
+            auto& x = out[i * ldc + j];
+            x       = static_cast<float>(beta * static_cast<double>(x) + alpha * acc);
+        }
+    }
+}
+
+void ExpectNear(const std::vector<float>& result, const std::vector<float>& expected)
+{
+    ASSERT_EQ(result.size(), expected.size());
+    for(std::size_t i = 0; i < result.size(); ++i)
+        ASSERT_NEAR(result[i], expected[i], 1e-5 * (1.0 + std::abs(expected[i]))) << "at " << i;
+}
+
+} // namespace
+
+class CPU_RnnCpuGemm_FP32 : public ::testing::TestWithParam<GemmCase>
+{
+};
+
+TEST_P(CPU_RnnCpuGemm_FP32, MatchesNaive)
+{
+    const auto c     = GetParam();
+    const auto a_row = c.trans_a ? c.k : c.m;
+    const auto a_col = c.trans_a ? c.m : c.k;
+    const auto b_row = c.trans_b ? c.n : c.k;
+    const auto b_col = c.trans_b ? c.k : c.n;
+    // Padded leading dimensions make sure the strides are honoured.
+    const auto lda = a_col + 3;
+    const auto ldb = b_col + 1;
+    const auto ldc = c.n + 2;
+
+    const auto a       = RandomMatrix(a_row * lda, 1);
+    const auto b       = RandomMatrix(b_row * ldb, 2);
+    auto result        = RandomMatrix(c.m * ldc, 3);
+    auto expected      = result;
+    const double alpha = 0.75;
+    const double beta  = 0.5;
+    const auto a_flags = c.trans_a ? RNN_MM_TRANSPOSE : 0;
+    const auto b_flags = c.trans_b ? RNN_MM_TRANSPOSE : 0;
+
+    NaiveGemm(c, a.data(), lda, b.data(), ldb, expected.data(), ldc, alpha, beta);
+    RNN_mm_cpu(a.data(),
+               a_col,
+               a_row,
+               lda,
+               a_flags,
+               b.data(),
+               b_col,
+               b_row,
+               ldb,
+               b_flags,
+               result.data(),
+               c.n,
+               c.m,
+               ldc,
+               0,
+               alpha,
+               beta);
+
+    ExpectNear(result, expected);
+}
+
+TEST_P(CPU_RnnCpuGemm_FP32, MatchesNaiveBatched)
+{
+    const auto c       = GetParam();
+    const auto a_row   = c.trans_a ? c.k : c.m;
+    const auto a_col   = c.trans_a ? c.m : c.k;
+    const auto b_row   = c.trans_b ? c.n : c.k;
+    const auto b_col   = c.trans_b ? c.k : c.n;
+    const auto batches = std::size_t{3};
+    const auto a_size  = a_row * a_col + 5;
+    const auto b_size  = b_row * b_col + 7;
+    const auto c_size  = c.m * c.n + 1;
+
+    const auto a       = RandomMatrix(a_size * batches, 4);
+    const auto b       = RandomMatrix(b_size * batches, 5);
+    auto result        = RandomMatrix(c_size * batches, 6);
+    auto expected      = result;
+    const auto a_flags = c.trans_a ? RNN_MM_TRANSPOSE : 0;
+    const auto b_flags = c.trans_b ? RNN_MM_TRANSPOSE : 0;
+
+    for(std::size_t i = 0; i < batches; ++i)
+    {
+        NaiveGemm(c,
+                  &a[i * a_size],
+                  a_col,
+                  &b[i * b_size],
+                  b_col,
+                  &expected[i * c_size],
+                  c.n,
+                  1.0,
+                  1.0);
+    }
+
+    RNN_mm_cpu_batched(a.data(),
+                       a_col,
+                       a_row,
+                       a_col,
+                       a_size,
+                       a_flags,
+                       b.data(),
+                       b_col,
+                       b_row,
+                       b_col,
+                       b_size,
+                       b_flags,
+                       result.data(),
+                       c.n,
+                       c.m,
+                       c.n,
+                       c_size,
+                       0,
+                       static_cast<int>(batches),
+                       1.0,
+                       1.0);
+
+    ExpectNear(result, expected);
+}
+
+TEST(CPU_RnnCpuGemmDims_FP32, RejectsMismatchedDimensions)
+{
+    const auto a = std::vector<float>(6, 1.0f);
+    const auto b = std::vector<float>(6, 1.0f);
+    auto result  = std::vector<float>(4, 2.0f);
+
+    // A is 2x3, B is 2x3: the inner dimensions do not match, so C has to stay untouched.
+    RNN_mm_cpu(a.data(), 3, 2, 3, 0, b.data(), 3, 2, 3, 0, result.data(), 2, 2, 2, 0, 1.0, 0.0);
+    for(auto x : result)
+        EXPECT_EQ(x, 2.0f);
+}
+
+INSTANTIATE_TEST_SUITE_P(Unit,
+                         CPU_RnnCpuGemm_FP32,
+                         testing::Values(GemmCase{false, false, 1, 1, 1},
+                                         GemmCase{false, false, 5, 7, 0},
+                                         GemmCase{false, false, 37, 61, 19},
+                                         GemmCase{true, false, 37, 61, 19},
+                                         GemmCase{false, true, 37, 61, 19},
+                                         GemmCase{true, true, 37, 61, 19},
+                                         GemmCase{false, false, 130, 300, 600},
+                                         GemmCase{true, false, 130, 300, 600},
+                                         GemmCase{false, true, 130, 300, 600},
+                                         GemmCase{true, true, 130, 300, 600}));
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "../cpu_norm.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct NormCase
+{
+    std::size_t groups;
+    std::size_t segments;
+    std::size_t length;
+
+    friend std::ostream& operator<<(std::ostream& os, const NormCase& c)
+    {
+        return os << "groups=" << c.groups << " segments=" << c.segments << " length=" << c.length;
+    }
+};
+
+// Values far from zero compared to their spread, where sum(x^2)/n - mean^2 breaks down.
+std::vector<float> RandomValues(std::size_t size, unsigned seed)
+{
+    auto gen  = std::mt19937{seed};
+    auto dist = std::uniform_real_distribution<float>{-1.0f, 1.0f};
+    auto data = std::vector<float>(size);
+    for(auto& x : data)
+        x = 1000.0f + dist(gen);
+    return data;
+}
+
+} // namespace
+
+class CPU_CpuNormMoments_FP32 : public testing::TestWithParam<NormCase>
+{
+};
+
+TEST_P(CPU_CpuNormMoments_FP32, MatchesTwoPass)
+{
+    const auto c    = GetParam();
+    const auto data = RandomValues(c.groups * c.segments * c.length, 7);
+
+    // Segments of a group are interleaved with the other groups like the batches of channels.
+    const auto at = [&](std::size_t group, std::size_t segment, std::size_t i) {
+        return data[(segment * c.groups + group) * c.length + i];
+    };
+
+    const auto moments = cpu_norm_moments(c.groups, c.segments, c.length, at);
+    ASSERT_EQ(moments.size(), c.groups);
+
+    for(std::size_t group = 0; group < c.groups; ++group)
+    {
+        long double sum = 0;
+        for(std::size_t segment = 0; segment < c.segments; ++segment)
+            for(std::size_t i = 0; i < c.length; ++i)
+                sum += at(group, segment, i);
+        const auto count = static_cast<long double>(c.segments * c.length);
+        const auto mean  = sum / count;
+
+        long double m2 = 0;
+        for(std::size_t segment = 0; segment < c.segments; ++segment)
+            for(std::size_t i = 0; i < c.length; ++i)
+                m2 += (at(group, segment, i) - mean) * (at(group, segment, i) - mean);
+        const auto variance = m2 / count;
+
+        EXPECT_EQ(moments[group].count, count) << "group " << group;
+        EXPECT_NEAR(moments[group].mean, mean, 1e-9 * std::abs(mean)) << "group " << group;
+        EXPECT_NEAR(moments[group].variance(), variance, 1e-9 * variance) << "group " << group;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Unit,
+                         CPU_CpuNormMoments_FP32,
+                         testing::Values(NormCase{1, 1, 1},
+                                         NormCase{1, 1, 255},
+                                         NormCase{3, 1, 257},
+                                         NormCase{64, 16, 49},
+                                         NormCase{2, 1, 200000},
+                                         NormCase{4096, 1, 3},
+                                         NormCase{5, 3, 1}));
+
+TEST(CPU_CpuNormMerge_NONE, MergeMatchesWhole)
+{
+    const auto data = RandomValues(1000, 11);
+    const auto at   = [&](std::size_t i) { return data[i]; };
+
+    auto merged = welford_accumulate(0, 123, at);
+    merged.merge(welford_accumulate(123, 1000, at));
+    merged.merge(welford_moments{});
+    const auto whole = welford_accumulate(0, 1000, at);
+
+    EXPECT_EQ(merged.count, whole.count);
+    EXPECT_NEAR(merged.mean, whole.mean, 1e-12 * whole.mean);
+    EXPECT_NEAR(merged.variance(), whole.variance(), 1e-9 * whole.variance());
+
+    auto from_empty = welford_moments{};
+    from_empty.merge(whole);
+    EXPECT_EQ(from_empty.mean, whole.mean);
+    EXPECT_EQ(from_empty.m2, whole.m2);
+}
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include "cpu_tensor_walk.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+template <int N>
+using Dims = std::array<std::uint64_t, N>;
+
+// Row-major strides with `pad` unused elements after every row of each dimension.
+template <int N>
+tensor_view_t<N> RowMajor(const Dims<N>& size, std::uint64_t inner_stride, std::uint64_t pad)
+{
+    auto view          = tensor_view_t<N>{};
+    view.stride[N - 1] = inner_stride;
+    view.size[N - 1]   = size[N - 1];
+    for(auto d = N - 2; d >= 0; --d)
+    {
+        view.size[d]   = size[d];
+        view.stride[d] = view.stride[d + 1] * size[d + 1] + pad;
+    }
+    return view;
+}
+
+// Column-major strides, so the innermost dimension has the largest stride.
+template <int N>
+tensor_view_t<N> ColumnMajor(const Dims<N>& size)
+{
+    auto view      = tensor_view_t<N>{};
+    view.stride[0] = 1;
+    view.size[0]   = size[0];
+    for(auto d = 1; d < N; ++d)
+    {
+        view.size[d]   = size[d];
+        view.stride[d] = view.stride[d - 1] * size[d - 1] + 1;
+    }
+    return view;
+}
+
+template <int N>
+struct Expected
+{
+    Dims<N> coords;
+    std::array<std::uint64_t, 2> offset;
+};
+
+// The coordinates and offsets of every element, from the linear index alone.
+template <int N>
+std::vector<Expected<N>> NaiveWalk(const std::array<tensor_view_t<N>, 2>& views)
+{
+    auto count = std::uint64_t{1};
+    for(auto d = 0; d < N; ++d)
+        count *= views[0].size[d];
+
+    auto expected = std::vector<Expected<N>>(count);
+    for(std::uint64_t index = 0; index < count; ++index)
+    {
+        auto& e   = expected[index];
+        auto rest = index;
+        for(auto d = N - 1; d >= 0; --d)
+        {
+            e.coords[d] = rest % views[0].size[d];
+            rest /= views[0].size[d];
+        }
+        for(std::size_t k = 0; k < 2; ++k)
+        {
+            e.offset[k] = 0;
+            for(auto d = 0; d < N; ++d)
+                e.offset[k] += views[k].stride[d] * e.coords[d];
+        }
+    }
+    return expected;
+}
+
+template <int N>
+void CheckWalk(const std::array<tensor_view_t<N>, 2>& views)
+{
+    const auto expected = NaiveWalk(views);
+    const auto count    = expected.size();
+
+    auto visits = std::vector<std::atomic<int>>(count);
+    auto seen   = std::vector<Expected<N>>(count);
+    tensor_walk(views, [&](const tensor_walk_position<N, 2>& pos) {
+        ASSERT_LT(pos.index, count);
+        ++visits[pos.index];
+        for(auto d = 0; d < N; ++d)
+            seen[pos.index].coords[d] = pos.layout.layout[d];
+        seen[pos.index].offset = pos.offset;
+    });
+
+    for(std::size_t i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(visits[i], 1) << "index " << i;
+        ASSERT_EQ(seen[i].coords, expected[i].coords) << "index " << i;
+        ASSERT_EQ(seen[i].offset, expected[i].offset) << "index " << i;
+    }
+
+    auto next = std::uint64_t{0};
+    tensor_walk_serial(views, [&](const tensor_walk_position<N, 2>& pos) {
+        ASSERT_EQ(pos.index, next);
+        ASSERT_EQ(pos.offset, expected[next].offset);
+        ++next;
+    });
+    EXPECT_EQ(next, count);
+
+    // The offsets are small integers, so both sums are exact.
+    auto naive_sum = 0.0;
+    for(const auto& e : expected)
+        naive_sum += static_cast<double>(e.offset[0] + 2 * e.offset[1]);
+    const auto sum = tensor_walk_sum(views, [](const tensor_walk_position<N, 2>& pos) {
+        return static_cast<double>(pos.offset[0] + 2 * pos.offset[1]);
+    });
+    EXPECT_EQ(sum, naive_sum);
+}
+
+} // namespace
+
+using cpu_tensor_walk_detail::ChunkSize;
+
+TEST(CPU_TensorWalk_NONE, SingleChunk)
+{
+    const auto size = Dims<4>{5, 7, 11, 13};
+    ASSERT_LT(std::uint64_t{5 * 7 * 11 * 13}, ChunkSize);
+    CheckWalk<4>({RowMajor<4>(size, 1, 3), RowMajor<4>(size, 1, 0)});
+    CheckWalk<4>({RowMajor<4>(size, 2, 1), ColumnMajor<4>(size)});
+}
+
+TEST(CPU_TensorWalk_NONE, ChunksSplitRows)
+{
+    // The chunk boundaries fall inside rows and planes, so the walk starts there.
+    const auto size = Dims<3>{3, 37, 151};
+    ASSERT_GT(std::uint64_t{3 * 37 * 151}, ChunkSize);
+    ASSERT_NE(ChunkSize % 151, 0u);
+    CheckWalk<3>({RowMajor<3>(size, 1, 5), RowMajor<3>(size, 1, 0)});
+    CheckWalk<3>({ColumnMajor<3>(size), RowMajor<3>(size, 3, 2)});
+}
+
+TEST(CPU_TensorWalk_NONE, CarriesAcrossDimensions)
+{
+    // Rows of one element carry on every step; several chunks of a 5-d shape.
+    CheckWalk<5>({RowMajor<5>({3, 5, 7, 61, 1}, 1, 1), ColumnMajor<5>({3, 5, 7, 61, 1})});
+    const auto size = Dims<4>{2, 9, 31, 67};
+    ASSERT_GT(std::uint64_t{2 * 9 * 31 * 67}, 2 * ChunkSize);
+    CheckWalk<4>({RowMajor<4>(size, 3, 1), ColumnMajor<4>(size)});
+}
+
+TEST(CPU_TensorWalk_NONE, OneDimension)
+{
+    const auto size = Dims<1>{ChunkSize * 2 + 17};
+    CheckWalk<1>({RowMajor<1>(size, 1, 0), RowMajor<1>(size, 1, 0)});
+    CheckWalk<1>({RowMajor<1>(size, 3, 0), RowMajor<1>(size, 1, 0)});
+}
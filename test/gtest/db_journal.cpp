@@ -0,0 +1,204 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/db.hpp>
+#include <miopen/db_journal.hpp>
+#include <miopen/env.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/ramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+MIOPEN_DECLARE_ENV_VAR_BOOL(MIOPEN_DB_JOURNAL)
+MIOPEN_DECLARE_ENV_VAR_UINT64(MIOPEN_DB_JOURNAL_THRESHOLD, 256)
+
+namespace env = miopen::env;
+
+using namespace std::string_literals;
+
+namespace {
+
+constexpr auto Kind = miopen::DbKinds::PerfDb;
+
+struct Value
+{
+    std::string value;
+
+    void Serialize(std::ostream& stream) const { stream << value; }
+
+    bool Deserialize(const std::string& str)
+    {
+        value = str;
+        return true;
+    }
+};
+
+miopen::DbRecord MakeRecord(const std::string& key, const std::string& id, const std::string& v)
+{
+    auto record = miopen::DbRecord{Kind, key};
+    record.SetValues(id, Value{v});
+    return record;
+}
+
+std::string GetValue(const boost::optional<miopen::DbRecord>& record, const std::string& id)
+{
+    auto value = Value{};
+    if(!record || !record->GetValues(id, value))
+        return "<none>";
+    return value.value;
+}
+
+std::string ReadFile(const miopen::fs::path& path)
+{
+    auto file = std::ifstream{path};
+    return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+class CPU_DbJournal_NONE : public ::testing::Test
+{
+protected:
+    void SetUp() override { env::update(MIOPEN_DB_JOURNAL, true); }
+
+    void TearDown() override
+    {
+        env::clear(MIOPEN_DB_JOURNAL);
+        env::clear(MIOPEN_DB_JOURNAL_THRESHOLD);
+    }
+
+    miopen::TmpDir dir{"db_journal"};
+};
+
+} // namespace
+
+TEST_F(CPU_DbJournal_NONE, SeesOwnWrites)
+{
+    const auto path = dir / "user.udb";
+    auto db         = miopen::PlainTextDb{Kind, path};
+
+    ASSERT_TRUE(db.StoreRecord(MakeRecord("key", "solver", "1")));
+    EXPECT_EQ(GetValue(db.FindRecord("key"s), "solver"), "1");
+    EXPECT_FALSE(miopen::fs::exists(path));
+
+    auto* const journal = miopen::DbJournal::Get(Kind, path);
+    ASSERT_NE(journal, nullptr);
+    EXPECT_TRUE(miopen::fs::exists(journal->GetPath()));
+    EXPECT_EQ(journal->GetPendingCount(), 1);
+
+    ASSERT_TRUE(journal->Flush());
+    EXPECT_EQ(journal->GetPendingCount(), 0);
+    EXPECT_FALSE(miopen::fs::exists(journal->GetPath()));
+    EXPECT_EQ(ReadFile(path), "key=solver:1\n");
+
+    env::clear(MIOPEN_DB_JOURNAL);
+    EXPECT_EQ(GetValue(miopen::PlainTextDb{Kind, path}.FindRecord("key"s), "solver"), "1");
+}
+
+TEST_F(CPU_DbJournal_NONE, FoldsUpdatesAndRemovals)
+{
+    const auto path = dir / "user.udb";
+    {
+        env::clear(MIOPEN_DB_JOURNAL);
+        auto db = miopen::PlainTextDb{Kind, path};
+        ASSERT_TRUE(db.StoreRecord(MakeRecord("a", "x", "1")));
+        ASSERT_TRUE(db.StoreRecord(MakeRecord("b", "x", "2")));
+        ASSERT_TRUE(db.StoreRecord(MakeRecord("c", "x", "3")));
+        env::update(MIOPEN_DB_JOURNAL, true);
+    }
+
+    auto db     = miopen::PlainTextDb{Kind, path};
+    auto update = MakeRecord("a", "y", "4");
+    ASSERT_TRUE(db.UpdateRecord(update));
+    EXPECT_EQ(GetValue(boost::make_optional(update), "x"), "1");
+    ASSERT_TRUE(db.RemoveRecord("b"s));
+    ASSERT_TRUE(db.Remove("c"s, "x"));
+    ASSERT_TRUE(db.StoreRecord(MakeRecord("d", "x", "5")));
+
+    const auto a = db.FindRecord("a"s);
+    EXPECT_EQ(GetValue(a, "x"), "1");
+    EXPECT_EQ(GetValue(a, "y"), "4");
+    EXPECT_FALSE(db.FindRecord("b"s));
+    EXPECT_FALSE(db.FindRecord("c"s));
+    EXPECT_EQ(GetValue(db.FindRecord("d"s), "x"), "5");
+
+    ASSERT_TRUE(miopen::DbJournal::Get(Kind, path)->Flush());
+    EXPECT_EQ(ReadFile(path), "a=x:1;y:4\nd=x:5\n");
+}
+
+TEST_F(CPU_DbJournal_NONE, FlushesOnThreshold)
+{
+    env::update(MIOPEN_DB_JOURNAL_THRESHOLD, 2);
+
+    const auto path = dir / "user.udb";
+    auto db         = miopen::PlainTextDb{Kind, path};
+
+    ASSERT_TRUE(db.StoreRecord(MakeRecord("a", "x", "1")));
+    EXPECT_FALSE(miopen::fs::exists(path));
+    ASSERT_TRUE(db.StoreRecord(MakeRecord("b", "x", "2")));
+    EXPECT_EQ(ReadFile(path), "a=x:1\nb=x:2\n");
+    EXPECT_EQ(miopen::DbJournal::Get(Kind, path)->GetPendingCount(), 0);
+}
+
+TEST_F(CPU_DbJournal_NONE, RecoversOrphans)
+{
+    // The journal of another db in the same directory tells the naming of this host.
+    const auto own_journal = miopen::DbJournal::Get(Kind, dir / "other.udb")->GetPath();
+    const auto own_name    = own_journal.filename().string();
+    const auto host_part   = own_name.substr(0, own_name.rfind('.') + 1);
+    const auto orphan_name = "user.udb" + host_part.substr(std::string{"other.udb"}.size());
+    {
+        // No process can have such an id, so the journal is considered abandoned.
+        auto orphan = std::ofstream{dir / (orphan_name + "999999999")};
+        orphan << "S a=x:1\n";
+        orphan << "U a=y:2\n";
+        orphan << "S b=x:3";
+    }
+
+    const auto path = dir / "user.udb";
+    auto db         = miopen::PlainTextDb{Kind, path};
+
+    EXPECT_EQ(ReadFile(path), "a=x:1;y:2\nb=x:3\n");
+    EXPECT_FALSE(miopen::fs::exists(dir / (orphan_name + "999999999")));
+    EXPECT_EQ(GetValue(db.FindRecord("a"s), "y"), "2");
+}
+
+TEST_F(CPU_DbJournal_NONE, RamDb)
+{
+    const auto path = dir / "user.udb";
+    auto& db        = miopen::RamDb::GetCached(Kind, path, false);
+
+    ASSERT_TRUE(db.StoreRecord(MakeRecord("a", "x", "1")));
+    EXPECT_EQ(GetValue(db.FindRecord("a"s), "x"), "1");
+    EXPECT_FALSE(miopen::fs::exists(path));
+
+    ASSERT_TRUE(miopen::DbJournal::Get(Kind, path)->Flush());
+    EXPECT_EQ(ReadFile(path), "a=x:1\n");
+    EXPECT_TRUE(miopen::fs::exists(miopen::RamDb::GetTimeFilePath(path)));
+    EXPECT_EQ(GetValue(db.FindRecord("a"s), "x"), "1");
+}
@@ -0,0 +1,244 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/db_merge.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#if MIOPEN_ENABLE_SQLITE
+#include <miopen/kern_db.hpp>
+#include <miopen/sqlite_db.hpp>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace {
+
+void WriteFile(const miopen::fs::path& path, const std::string& contents)
+{
+    auto file = std::ofstream{path};
+    file << contents;
+}
+
+std::string ReadFile(const miopen::fs::path& path)
+{
+    auto file = std::ifstream{path};
+    return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+miopen::DbMergeOptions MakeOptions(miopen::DbKinds kind,
+                                   const std::vector<miopen::fs::path>& inputs,
+                                   const miopen::fs::path& output)
+{
+    auto options             = miopen::DbMergeOptions{};
+    options.kind             = kind;
+    options.inputs           = inputs;
+    options.output           = output;
+    options.validate_solvers = false;
+    options.jobs             = 2;
+    return options;
+}
+
+#if MIOPEN_ENABLE_SQLITE
+void Exec(const miopen::SQLite& sql,
+          const std::string& query,
+          const std::vector<std::string>& values = {})
+{
+    auto stmt = miopen::SQLite::Statement{sql, query, values};
+    ASSERT_EQ(stmt.Step(sql), SQLITE_DONE);
+}
+
+void AddKernel(const miopen::SQLite& sql, const std::string& name, const std::string& hash)
+{
+    auto stmt = miopen::SQLite::Statement{sql,
+                                          "INSERT INTO kern_db(kernel_name, kernel_args, "
+                                          "kernel_blob, kernel_hash, uncompressed_size) "
+                                          "VALUES(?, ?, ?, ?, ?);"};
+    stmt.BindText(1, name);
+    stmt.BindText(2, "-DMIOPEN_USE_FP32=1 -mcpu=gfx90a");
+    stmt.BindBlob(3, std::vector<char>(hash.begin(), hash.end()));
+    stmt.BindText(4, hash);
+    stmt.BindInt64(5, 0);
+    ASSERT_EQ(stmt.Step(sql), SQLITE_DONE);
+}
+#endif
+
+} // namespace
+
+TEST(CPU_DbMerge_NONE, FindDbKeepsBestTime)
+{
+    const miopen::TmpDir dir{"db_merge"};
+    WriteFile(dir.path / "a.ufdb.txt",
+              "2-8-8-3x3-2-8-8-1-1x1-1x1-1x1-0-NCHW-FP32-F="
+              "ConvDirectNaiveConvFwd:2.5,0,miopenConvolutionFwdAlgoDirect;"
+              "GemmFwdRest:1,64,miopenConvolutionFwdAlgoGEMM\n");
+    WriteFile(dir.path / "b.ufdb.txt",
+              "2-8-8-3x3-2-8-8-1-1x1-1x1-1x1-0-NCHW-FP32-F="
+              "ConvDirectNaiveConvFwd:0.5,0,miopenConvolutionFwdAlgoDirect;"
+              "GemmFwdRest:3,64,miopenConvolutionFwdAlgoGEMM\n"
+              "1-8-8-3x3-2-8-8-1-1x1-1x1-1x1-0-NCHW-FP32-F="
+              "GemmFwdRest:1,64,miopenConvolutionFwdAlgoGEMM\n");
+
+    const auto output = dir.path / "merged.fdb.txt";
+    const auto stats  = miopen::MergeDbs(MakeOptions(
+        miopen::DbKinds::FindDb, {dir.path / "a.ufdb.txt", dir.path / "b.ufdb.txt"}, output));
+
+    EXPECT_EQ(stats.inputs, 2u);
+    EXPECT_EQ(stats.read, 5u);
+    EXPECT_EQ(stats.conflicts, 2u);
+    EXPECT_EQ(stats.records, 2u);
+    EXPECT_EQ(stats.written, 3u);
+    EXPECT_EQ(ReadFile(output),
+              "1-8-8-3x3-2-8-8-1-1x1-1x1-1x1-0-NCHW-FP32-F="
+              "GemmFwdRest:1,64,miopenConvolutionFwdAlgoGEMM\n"
+              "2-8-8-3x3-2-8-8-1-1x1-1x1-1x1-0-NCHW-FP32-F="
+              "ConvDirectNaiveConvFwd:0.5,0,miopenConvolutionFwdAlgoDirect;"
+              "GemmFwdRest:1,64,miopenConvolutionFwdAlgoGEMM\n");
+}
+
+TEST(CPU_DbMerge_NONE, PerfDbLastInputWins)
+{
+    const miopen::TmpDir dir{"db_merge"};
+    WriteFile(dir.path / "a.updb.txt", "key1=SolverA:1,2;SolverB:3\nkey2=SolverA:4\n");
+    WriteFile(dir.path / "b.updb.txt", "key1=SolverA:5,6;SolverB:3\nbroken_record\nkey3=:7\n");
+
+    const auto output = dir.path / "merged.txt";
+    const auto stats  = miopen::MergeDbs(MakeOptions(
+        miopen::DbKinds::PerfDb, {dir.path / "a.updb.txt", dir.path / "b.updb.txt"}, output));
+
+    EXPECT_EQ(stats.read, 5u);
+    EXPECT_EQ(stats.duplicates, 1u);
+    EXPECT_EQ(stats.conflicts, 1u);
+    EXPECT_EQ(stats.ill_formed, 1u);
+    EXPECT_EQ(ReadFile(output), "key1=SolverA:5,6;SolverB:3\nkey2=SolverA:4\n");
+}
+
+TEST(CPU_DbMerge_NONE, DropsUnknownSolvers)
+{
+    const miopen::TmpDir dir{"db_merge"};
+    WriteFile(dir.path / "a.updb.txt", "key=ConvDirectNaiveConvFwd:1;NoSuchSolver:2\n");
+
+    auto options = MakeOptions(
+        miopen::DbKinds::PerfDb, {dir.path / "a.updb.txt"}, dir.path / "merged.txt");
+    options.validate_solvers = true;
+    const auto stats         = miopen::MergeDbs(options);
+
+    EXPECT_EQ(stats.unknown_solvers, 1u);
+    EXPECT_EQ(ReadFile(options.output), "key=ConvDirectNaiveConvFwd:1\n");
+}
+
+TEST(CPU_DbMerge_NONE, ReportsUnreadableInputs)
+{
+    const miopen::TmpDir dir{"db_merge"};
+    WriteFile(dir.path / "a.updb.txt", "key=SolverA:1\n");
+
+    const auto stats = miopen::MergeDbs(
+        MakeOptions(miopen::DbKinds::PerfDb,
+                    {dir.path / "a.updb.txt", dir.path / "missing.updb.txt"},
+                    dir.path / "merged.txt"));
+
+    EXPECT_EQ(stats.inputs, 2u);
+    EXPECT_EQ(stats.unreadable_inputs, 1u);
+    EXPECT_EQ(stats.written, 1u);
+}
+
+TEST(CPU_DbMerge_NONE, RejectsMixedFormats)
+{
+    const miopen::TmpDir dir{"db_merge"};
+    EXPECT_ANY_THROW(miopen::MergeDbs(MakeOptions(
+        miopen::DbKinds::PerfDb, {dir.path / "a.udb"}, dir.path / "merged.txt")));
+    EXPECT_ANY_THROW(miopen::MergeDbs(MakeOptions(
+        miopen::DbKinds::FindDb, {dir.path / "a.ufdb.txt"}, dir.path / "merged.db")));
+}
+
+#if MIOPEN_ENABLE_SQLITE
+TEST(CPU_DbMerge_NONE, SQLitePerfDb)
+{
+    const miopen::TmpDir dir{"db_merge"};
+    const auto schema = "CREATE TABLE `config` (`id` INTEGER PRIMARY KEY ASC, "
+                        "`layout` TEXT NOT NULL, `in_channels` INT NOT NULL);"
+                        "CREATE UNIQUE INDEX `idx_config` ON config(layout, in_channels);"
+                        "CREATE TABLE `perf_db` (`id` INTEGER PRIMARY KEY ASC, "
+                        "`solver` TEXT NOT NULL, `config` INTEGER NOT NULL, "
+                        "`params` TEXT NOT NULL);"
+                        "CREATE UNIQUE INDEX `idx_perf_db` ON perf_db(solver, config);";
+
+    for(const auto& [name, params] : {std::make_pair("a.udb", "1,2"), {"b.udb", "3,4"}})
+    {
+        const auto sql = miopen::SQLite{dir.path / name, false};
+        sql.Exec(schema);
+        Exec(sql, "INSERT INTO config(id, layout, in_channels) VALUES(7, 'NCHW', 16);");
+        Exec(sql,
+             "INSERT INTO perf_db(solver, config, params) VALUES('SolverA', 7, ?);",
+             {params});
+    }
+
+    const auto output = dir.path / "merged.db";
+    const auto stats  = miopen::MergeDbs(
+        MakeOptions(miopen::DbKinds::PerfDb, {dir.path / "a.udb", dir.path / "b.udb"}, output));
+
+    EXPECT_EQ(stats.conflicts, 1u);
+    EXPECT_EQ(stats.records, 1u);
+
+    const auto sql  = miopen::SQLite{output, true};
+    const auto rows = sql.Exec("SELECT layout, in_channels, solver, params FROM perf_db "
+                               "INNER JOIN config ON perf_db.config = config.id;");
+    ASSERT_EQ(rows.size(), 1u);
+    EXPECT_EQ(rows[0].at("layout"), "NCHW");
+    EXPECT_EQ(rows[0].at("in_channels"), "16");
+    EXPECT_EQ(rows[0].at("params"), "3,4");
+}
+
+TEST(CPU_DbMerge_NONE, KernelDbDropsOrphans)
+{
+    const miopen::TmpDir dir{"db_merge"};
+    for(const auto& name : {"a.ukdb", "b.ukdb"})
+    {
+        const auto sql = miopen::SQLite{dir.path / name, false};
+        sql.Exec(miopen::KernelConfig::CreateQuery());
+        AddKernel(sql, "MIOpenIm2d2Col.cl.o", "hash");
+        AddKernel(sql, "NoSuchKernel.cl.o", "hash");
+    }
+
+    auto options = MakeOptions(
+        miopen::DbKinds::KernelDb, {dir.path / "a.ukdb", dir.path / "b.ukdb"}, dir.path / "m.kdb");
+    const auto stats = miopen::MergeDbs(options);
+
+    EXPECT_EQ(stats.read, 4u);
+    EXPECT_EQ(stats.orphaned_kernels, 2u);
+    EXPECT_EQ(stats.duplicates, 1u);
+    EXPECT_EQ(stats.written, 1u);
+
+    const auto sql  = miopen::SQLite{options.output, true};
+    const auto rows = sql.Exec("SELECT kernel_name FROM kern_db;");
+    ASSERT_EQ(rows.size(), 1u);
+    EXPECT_EQ(rows[0].at("kernel_name"), "MIOpenIm2d2Col.cl.o");
+}
+#endif
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/db_text_parser.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+struct CacheItem
+{
+    int line;
+    std::string content;
+};
+
+using Cache = std::map<std::string, CacheItem>;
+
+// The sequential parsing the databases used before.
+Cache ParseSequentially(const std::string& text)
+{
+    auto cache  = Cache{};
+    auto input  = std::istringstream{text};
+    auto line   = std::string{};
+    auto n_line = 0;
+
+    while(std::getline(input, line))
+    {
+        ++n_line;
+        const auto key_size = line.find('=');
+        if(line.empty() || key_size == std::string::npos || key_size == 0)
+            continue;
+        cache.emplace(line.substr(0, key_size), CacheItem{n_line, line.substr(key_size + 1)});
+    }
+    return cache;
+}
+
+std::string MakeDb()
+{
+    auto text = std::string{};
+    for(auto i = 0; i < 500; ++i)
+    {
+        text += "key" + std::to_string(i % 450) + "=id:" + std::to_string(i) + "\n";
+        if(i % 37 == 0)
+            text += "\n";
+        if(i % 53 == 0)
+            text += "ill-formed\n=no key\n";
+    }
+    return text + "last=no newline";
+}
+
+void ExpectEqual(const Cache& actual, const Cache& expected)
+{
+    ASSERT_EQ(actual.size(), expected.size());
+    for(const auto& [key, item] : expected)
+    {
+        const auto it = actual.find(key);
+        ASSERT_NE(it, actual.end()) << key;
+        EXPECT_EQ(it->second.line, item.line) << key;
+        EXPECT_EQ(it->second.content, item.content) << key;
+    }
+}
+
+} // namespace
+
+class CPU_DbTextParser_NONE : public testing::TestWithParam<std::size_t>
+{
+};
+
+TEST_P(CPU_DbTextParser_NONE, MatchesSequentialParse)
+{
+    const auto text     = MakeDb();
+    const auto n_chunks = GetParam();
+
+    const auto chunks = miopen::SplitTextDb(text, n_chunks);
+    EXPECT_LE(chunks.size(), n_chunks);
+    auto joined = std::string{};
+    for(const auto& chunk : chunks)
+    {
+        EXPECT_FALSE(chunk.empty());
+        joined += chunk;
+    }
+    EXPECT_EQ(joined, text);
+
+    auto cache = Cache{};
+    miopen::ParseTextDb(text, "test.db.txt", cache, n_chunks);
+    ExpectEqual(cache, ParseSequentially(text));
+
+    auto unordered = std::unordered_map<std::string, CacheItem>{};
+    miopen::ParseTextDb(text, "test.db.txt", unordered, n_chunks);
+    EXPECT_EQ(unordered.size(), cache.size());
+    EXPECT_EQ(unordered.at("key3").line, cache.at("key3").line);
+}
+
+INSTANTIATE_TEST_SUITE_P(Unit, CPU_DbTextParser_NONE, testing::Values(1, 2, 3, 7, 64, 100000));
@@ -25,6 +25,7 @@
  *******************************************************************************/
 
 #include "../driver/tensor_driver.hpp"
+#include "cpu_tensor_walk.hpp"
 #include "get_handle.hpp"
 #include "random.hpp"
 #include "tensor_holder.hpp"
@@ -46,9 +47,7 @@ void cpu_getitem_backward(tensor<T> dy,
                           int32_t* slices,
                           uint32_t offset)
 {
-    auto dy_dims  = dy.desc.GetLengths();
-    auto dy_numel = std::accumulate(dy_dims.begin(), dy_dims.end(), 1L, std::multiplies<int64_t>());
-    auto dx_dims  = ref_dx.desc.GetLengths();
+    auto dx_dims    = ref_dx.desc.GetLengths();
     auto index_dims = indexs[0].desc.GetLengths();
     auto index_numel =
         std::accumulate(index_dims.begin(), index_dims.end(), 1L, std::multiplies<int64_t>());
@@ -97,8 +96,9 @@ void cpu_getitem_backward(tensor<T> dy,
     }
 
     // GetItem
-    par_ford(dy_numel)([&](int32_t o) {
-        tensor_layout_t<5> ncdhw(dy_tv, o);
+    // Several elements of dy can be added to the same element of dx, so the walk is serial.
+    tensor_walk_serial(std::array{dy_tv}, [&](const auto& pos) {
+        const auto& ncdhw = pos.layout;
         tensor_layout_t<5> idx(ncdhw);
 
         if(indexCount > 0)
@@ -121,7 +121,7 @@ void cpu_getitem_backward(tensor<T> dy,
             }
         }
 
-        ref_dx[ref_dx_tv.get_tensor_view_idx(idx)] += dy[dy_tv.get_tensor_view_idx(ncdhw)];
+        ref_dx[ref_dx_tv.get_tensor_view_idx(idx)] += dy[pos.offset[0]];
     });
 }
 
@@ -0,0 +1,144 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/graphapi/engine_cache.hpp>
+#include <miopen/graphapi/opgraph.hpp>
+#include <miopen/graphapi/pointwise.hpp>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+namespace gr = miopen::graphapi;
+
+class DummyExecutor : public gr::GraphPatternExecutor
+{
+    bool mReusable;
+
+public:
+    explicit DummyExecutor(bool reusable) : mReusable(reusable) {}
+
+    void execute(miopenHandle_t, const gr::VariantPack&) final {}
+    size_t getWorkspaceSize() const final { return 0; }
+    bool isReusable() const final { return mReusable; }
+};
+
+struct ReluGraph
+{
+    gr::Tensor mX;
+    gr::Tensor mY;
+    gr::Tensor mZ;
+    gr::Pointwise mRelu{MIOPEN_POINTWISE_RELU_FWD, miopenFloat};
+    gr::OperationPointwise mFirst;
+    gr::OperationPointwise mSecond;
+    gr::OpGraph mGraph;
+
+    ReluGraph(const std::vector<size_t>& dims, float alpha, bool reversed)
+        : mX(miopenFloat, dims, miopen::TensorDescriptor{miopenFloat, dims}.GetStrides(), 1, false),
+          mY(miopenFloat, dims, miopen::TensorDescriptor{miopenFloat, dims}.GetStrides(), 2, true),
+          mZ(miopenFloat, dims, miopen::TensorDescriptor{miopenFloat, dims}.GetStrides(), 3, false),
+          mFirst(&mRelu, &mX, &mY, alpha),
+          mSecond(&mRelu, &mY, &mZ)
+    {
+        gr::OpGraphBuilder builder;
+        if(reversed)
+            builder.setNodes({&mSecond, &mFirst});
+        else
+            builder.setNodes({&mFirst, &mSecond});
+        mGraph = std::move(builder).build();
+    }
+};
+
+} // namespace
+
+TEST(CPU_GraphApiEngineCache_NONE, Signature)
+{
+    ReluGraph base{{8, 64, 64}, 1.0f, false};
+    ReluGraph reordered{{8, 64, 64}, 1.0f, true};
+    ReluGraph other_dims{{8, 64, 32}, 1.0f, false};
+    ReluGraph other_alpha{{8, 64, 64}, 0.5f, false};
+
+    EXPECT_EQ(base.mGraph.getSignature(), reordered.mGraph.getSignature());
+    EXPECT_NE(base.mGraph.getSignature(), other_dims.mGraph.getSignature());
+    EXPECT_NE(base.mGraph.getSignature(), other_alpha.mGraph.getSignature());
+}
+
+TEST(CPU_GraphApiEngineCache_NONE, HitsAndMisses)
+{
+    gr::EngineCache cache;
+
+    ReluGraph first{{8, 64, 64}, 1.0f, false};
+    ReluGraph second{{8, 64, 64}, 1.0f, true};
+
+    const auto key = gr::EngineCache::makeKey(first.mGraph);
+    ASSERT_EQ(key, gr::EngineCache::makeKey(second.mGraph));
+
+    EXPECT_FALSE(cache.find(key, &first.mGraph));
+    EXPECT_EQ(cache.getMisses(), 1);
+
+    std::vector<gr::Engine> engines;
+    for(int i = 0; i < 2; ++i)
+    {
+        engines.emplace_back(gr::EngineBuilder()
+                                 .setGraph(&first.mGraph)
+                                 .setExecutor(std::make_shared<DummyExecutor>(true))
+                                 .setGlobalIndex(i)
+                                 .build());
+    }
+    ASSERT_TRUE(cache.store(key, engines));
+
+    auto cached = cache.find(key, &second.mGraph);
+    ASSERT_TRUE(cached);
+    EXPECT_EQ(cache.getHits(), 1);
+    ASSERT_EQ(cached->size(), engines.size());
+    for(size_t i = 0; i < engines.size(); ++i)
+    {
+        EXPECT_EQ((*cached)[i].getOpGraph(), &second.mGraph);
+        EXPECT_EQ((*cached)[i].getExecutor(), engines[i].getExecutor());
+        EXPECT_EQ((*cached)[i].getGlobalIndex(), engines[i].getGlobalIndex());
+    }
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0);
+    EXPECT_EQ(cache.getHits(), 0);
+}
+
+TEST(CPU_GraphApiEngineCache_NONE, NotReusable)
+{
+    gr::EngineCache cache;
+    ReluGraph graph{{8, 64, 64}, 1.0f, false};
+
+    const auto key = gr::EngineCache::makeKey(graph.mGraph);
+    auto engine    = gr::EngineBuilder()
+                      .setGraph(&graph.mGraph)
+                      .setExecutor(std::make_shared<DummyExecutor>(false))
+                      .setGlobalIndex(0)
+                      .build();
+
+    EXPECT_FALSE(cache.store(key, {engine}));
+    EXPECT_FALSE(cache.find(key, &graph.mGraph));
+    EXPECT_EQ(cache.size(), 0);
+}
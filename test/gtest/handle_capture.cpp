@@ -0,0 +1,177 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/handle.hpp>
+#include <miopen/hipoc_kernel.hpp>
+#include <miopen/launch_recording.hpp>
+
+#include <gtest/gtest.h>
+
+#include "get_handle.hpp"
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+
+// Launches are recorded without being issued, so host memory can stand for device buffers and
+// the kernels do not need to exist.
+miopen::Kernel MakeKernel(const std::string& name, std::size_t global)
+{
+    miopen::Kernel kernel;
+    kernel.name  = name;
+    kernel.ldims = {64, 1, 1};
+    kernel.gdims = {global, 1, 1};
+    return kernel;
+}
+
+// Padding in front of the hidden arguments is left uninitialized, so only the argument pack
+// itself is compared.
+template <class... Ts>
+std::vector<char> Pack(Ts... xs)
+{
+    const miopen::KernelArgs<Ts...> args{xs...};
+    const auto* bytes = reinterpret_cast<const char*>(&args.pack);
+    return {bytes, bytes + sizeof(args.pack)};
+}
+
+template <class... Ts>
+void ExpectPacked(const std::vector<char>& args, Ts... xs)
+{
+    const auto expected = Pack(xs...);
+    ASSERT_GE(args.size(), expected.size());
+    EXPECT_EQ(std::vector<char>(args.begin(), args.begin() + expected.size()), expected);
+}
+
+} // namespace
+
+TEST(CPU_HandleCapture_NONE, RecordsLaunchStream)
+{
+    auto&& handle = get_handle();
+
+    std::array<float, 16> x{};
+    std::array<float, 16> y{};
+    std::array<float, 16> new_x{};
+    std::array<float, 16> new_y{};
+
+    handle.BeginCapture({{x.data(), sizeof(x)}, {y.data(), sizeof(y)}}, false);
+    ASSERT_TRUE(handle.IsCapturing());
+
+    handle.Run(MakeKernel("scale", 1024))(x.data(), 2.0f, y.data() + 4, 5);
+    handle.Run(MakeKernel("reduce", 64))(y.data());
+
+    const auto recording = handle.EndCapture();
+    EXPECT_FALSE(handle.IsCapturing());
+
+    const auto& launches = recording.GetLaunches();
+    ASSERT_EQ(launches.size(), 2u);
+    EXPECT_EQ(launches[0].name, "scale");
+    EXPECT_EQ(launches[0].gdims[0], 1024u);
+    EXPECT_EQ(launches[1].name, "reduce");
+    EXPECT_EQ(launches[1].ldims[0], 64u);
+
+    ExpectPacked(launches[0].args, x.data(), 2.0f, y.data() + 4, 5);
+    ExpectPacked(launches[1].args, y.data());
+
+    // Only the buffer addresses are patched, scalars stay as they were.
+    const auto& patches = recording.GetPatches();
+    ASSERT_EQ(patches.size(), 3u);
+    EXPECT_EQ(patches[0].buffer, 0u);
+    EXPECT_EQ(patches[0].delta, 0);
+    EXPECT_EQ(patches[1].buffer, 1u);
+    EXPECT_EQ(patches[1].delta, static_cast<std::ptrdiff_t>(4 * sizeof(float)));
+    EXPECT_EQ(patches[2].launch, 1u);
+
+    const std::vector<Data_t> buffers = {new_x.data(), new_y.data()};
+    ExpectPacked(recording.GetArgs(0, buffers), new_x.data(), 2.0f, new_y.data() + 4, 5);
+    ExpectPacked(recording.GetArgs(1, buffers), new_y.data());
+}
+
+TEST(CPU_HandleCapture_NONE, KeepsProgramsAlive)
+{
+    auto&& handle = get_handle();
+
+    std::array<float, 16> x{};
+    auto program = std::weak_ptr<miopen::HIPOCProgramImpl>{};
+
+    handle.BeginCapture({{x.data(), sizeof(x)}}, false);
+    {
+        auto kernel         = MakeKernel("scale", 64);
+        kernel.program.impl = std::make_shared<miopen::HIPOCProgramImpl>();
+        program             = kernel.program.impl;
+        handle.Run(kernel)(x.data());
+    }
+    const auto recording = handle.EndCapture();
+
+    // The kernel and its invoke are gone, the recording still owns the module.
+    ASSERT_EQ(recording.GetLaunches().size(), 1u);
+    EXPECT_FALSE(program.expired());
+    EXPECT_EQ(recording.GetLaunches()[0].program.impl, program.lock());
+}
+
+TEST(CPU_HandleCapture_NONE, PackedArguments)
+{
+    auto&& handle = get_handle();
+
+    std::array<float, 16> x{};
+    std::array<float, 16> new_x{};
+
+    handle.BeginCapture({{x.data(), sizeof(x)}}, false);
+
+    std::vector<OpKernelArg> args;
+    args.emplace_back(3);
+    args.emplace_back(static_cast<void*>(x.data() + 8));
+    handle.Run(MakeKernel("packed", 64))(args);
+
+    const auto recording = handle.EndCapture();
+
+    ASSERT_EQ(recording.GetLaunches().size(), 1u);
+    ASSERT_EQ(recording.GetPatches().size(), 1u);
+    EXPECT_EQ(recording.GetPatches()[0].offset, 8u);
+
+    const auto patched = recording.GetArgs(0, {new_x.data()});
+    void* address      = nullptr;
+    std::memcpy(&address, patched.data() + 8, sizeof(address));
+    EXPECT_EQ(address, static_cast<void*>(new_x.data() + 8));
+}
+
+TEST(CPU_HandleCapture_NONE, Errors)
+{
+    auto&& handle = get_handle();
+
+    EXPECT_ANY_THROW(handle.EndCapture());
+
+    std::array<float, 4> x{};
+    handle.BeginCapture({{x.data(), sizeof(x)}}, false);
+    EXPECT_ANY_THROW(handle.BeginCapture({}, false));
+    EXPECT_ANY_THROW(handle.Run(MakeKernel("coop", 64), true)(x.data()));
+
+    const auto recording = handle.EndCapture();
+    EXPECT_TRUE(recording.GetLaunches().empty());
+    EXPECT_ANY_THROW(recording.GetArgs(0, {x.data()}));
+}
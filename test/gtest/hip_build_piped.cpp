@@ -0,0 +1,119 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/hip_build_utils.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+
+namespace {
+
+/// Writes a shell script which stands in for the offline compiler.
+miopen::fs::path MakeStandInCompiler(const miopen::TmpDir& dir, const std::string& body)
+{
+    const auto script = dir / "compiler.sh";
+    std::ofstream(script) << "#!/bin/sh\n" << body << std::endl;
+    miopen::fs::permissions(script, miopen::fs::perms::owner_all);
+    return script;
+}
+
+} // namespace
+
+TEST(CPU_HipBuildPiped_NONE, SourceInObjectOut)
+{
+    const miopen::TmpDir tools{"hip_build_piped"};
+    const miopen::TmpDir scratch{"hip_build_piped_scratch"};
+    std::ofstream(scratch / "header.h") << "header;";
+
+    // Includes are resolved relative to the scratch directory, the source comes from stdin.
+    const auto compiler = MakeStandInCompiler(tools, "cat header.h -");
+    const auto object   = miopen::HipBuildPiped(compiler, scratch, "source;", "");
+
+    EXPECT_EQ(std::string(object.begin(), object.end()), "header;source;");
+}
+
+TEST(CPU_HipBuildPiped_NONE, LargeSource)
+{
+    const miopen::TmpDir tools{"hip_build_piped"};
+
+    // Bigger than any pipe buffer, so reading and writing must be interleaved.
+    std::string source(4 * 1024 * 1024, ' ');
+    for(std::size_t i = 0; i < source.size(); ++i)
+        source[i] = static_cast<char>('a' + i % 26);
+
+    const auto compiler = MakeStandInCompiler(tools, "cat");
+    const auto object   = miopen::HipBuildPiped(compiler, tools, source, "");
+
+    EXPECT_EQ(std::string(object.begin(), object.end()), source);
+}
+
+TEST(CPU_HipBuildPiped_NONE, Failure)
+{
+    const miopen::TmpDir tools{"hip_build_piped"};
+
+    EXPECT_ANY_THROW(
+        miopen::HipBuildPiped(MakeStandInCompiler(tools, "cat; exit 1"), tools, "source", ""));
+    EXPECT_ANY_THROW(
+        miopen::HipBuildPiped(MakeStandInCompiler(tools, "true"), tools, "source", ""));
+}
+
+#endif // _WIN32
+
+TEST(CPU_TmpDirPool_NONE, Reuse)
+{
+    int initialized = 0;
+    miopen::TmpDirPool pool{"tmp_dir_pool", [&](const miopen::TmpDir&) { ++initialized; }, 1};
+
+    miopen::fs::path first_path;
+    {
+        const auto first = pool.Acquire();
+        first_path       = first.Get().path;
+        EXPECT_TRUE(miopen::fs::exists(first_path));
+    }
+    EXPECT_EQ(pool.IdleCount(), 1u);
+
+    {
+        const auto again = pool.Acquire();
+        EXPECT_EQ(again.Get().path, first_path);
+        EXPECT_EQ(initialized, 1);
+
+        // Leased directories are never shared.
+        const auto other = pool.Acquire();
+        EXPECT_NE(other.Get().path, first_path);
+        EXPECT_EQ(initialized, 2);
+        EXPECT_EQ(pool.IdleCount(), 0u);
+    }
+
+    // Only one directory is kept, the other one is removed.
+    EXPECT_EQ(pool.IdleCount(), 1u);
+    EXPECT_EQ(initialized, 2);
+}
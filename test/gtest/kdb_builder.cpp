@@ -0,0 +1,144 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/errors.hpp>
+#include <miopen/kdb_builder.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string Serialize(const miopen::conv::ProblemDescription& problem)
+{
+    auto ss = std::ostringstream{};
+    problem.Serialize(ss);
+    return ss.str();
+}
+
+std::vector<std::string> Serialize(const std::vector<miopen::conv::ProblemDescription>& problems)
+{
+    auto keys = std::vector<std::string>{};
+    for(const auto& problem : problems)
+        keys.push_back(Serialize(problem));
+    return keys;
+}
+
+} // namespace
+
+TEST(CPU_KdbBuilder_NONE, ProblemKeysRoundTrip)
+{
+    const auto keys = std::vector<std::string>{
+        "64-56-56-3x3-64-56-56-16-1x1-1x1-1x1-0-NCHW-FP32-F",
+        "256-14-14-1x1-1024-14-14-32-0x0-1x1-1x1-0-NCHW-FP16-B",
+        "64-56-56-3x3-64-28-28-8-1x1-2x2-1x1-0-NHWC-NHWC-NHWC-BF16-W",
+        "32-64-64-3x3-32-64-64-4-1x1-1x1-1x1-0-NCHW-FP32-F_g32",
+        "16-8-32-32-3x3x3-32-8-32-32-2-1x1x1-1x1x1-1x1x1-0-NCDHW-FP32-F",
+        "16-8-32-32-3x3x3-32-4-16-16-2-1x1x1-2x2x2-1x1x1-0-NDHWC-NDHWC-NDHWC-FP16-B_g2",
+    };
+
+    for(const auto& key : keys)
+        EXPECT_EQ(Serialize(miopen::ParseConvProblemKey(key)), key);
+}
+
+TEST(CPU_KdbBuilder_NONE, InvalidProblemKeys)
+{
+    const auto keys = std::vector<std::string>{
+        "",
+        "64-56-56-3x3",
+        "64-56-56-3x3-64-56-56-16-1x1-1x1-1x1-0-NCHW-FP32",
+        "64-56-56-3x3-64-56-56-16-1x1x1-1x1-1x1-0-NCHW-FP32-F",
+        "64-56-56-3x3-64-56-56-16-1x1-1x1-1x1-0-NCHW-FP32-X",
+        "64-56-56-3x3-64-56-56-16-1x1-1x1-1x1-0-NCHW-FP99-F",
+        "64-56-5a-3x3-64-56-56-16-1x1-1x1-1x1-0-NCHW-FP32-F",
+        "64-56-56-3x3-64-56-56-16-1x1-1x1-1x1-0-NCHW-FP32-F_ciFP8",
+        "64-56-56-3x3-64-56-56-16-1x1-1x1-1x1-0-NCHW-FP32-F_g3",
+    };
+
+    for(const auto& key : keys)
+        EXPECT_THROW(miopen::ParseConvProblemKey(key), miopen::Exception) << key;
+}
+
+TEST(CPU_KdbBuilder_NONE, DriverCommands)
+{
+    EXPECT_EQ(Serialize(miopen::ParseConvDriverCommand(
+                  "./bin/MIOpenDriver convfp16 -n 16 -c 64 -H 56 -W 56 -k 128 -y 3 -x 3 -p 1 -q 1 "
+                  "-u 2 -v 2 -F 1 -t 1 -V 0")),
+              std::vector<std::string>{"64-56-56-3x3-128-28-28-16-1x1-2x2-1x1-0-NCHW-FP16-F"});
+
+    EXPECT_EQ(Serialize(miopen::ParseConvDriverCommand(
+                  "conv --batchsize 16 --in_channels 64 --in_h 56 --in_w 56 --out_channels 128 "
+                  "--fil_h 3 --fil_w 3 --pad_h 1 --pad_w 1 --conv_stride_h 2 --conv_stride_w 2")),
+              (std::vector<std::string>{
+                  "64-56-56-3x3-128-28-28-16-1x1-2x2-1x1-0-NCHW-FP32-F",
+                  "128-28-28-3x3-64-56-56-16-1x1-2x2-1x1-0-NCHW-FP32-B",
+                  "128-28-28-3x3-64-56-56-16-1x1-2x2-1x1-0-NCHW-FP32-W",
+              }));
+
+    // Same padding, groups and layouts.
+    EXPECT_EQ(Serialize(miopen::ParseConvDriverCommand(
+                  "convbfp16 -n 8 -c 32 -H 28 -W 28 -k 32 -y 3 -x 3 -z same -g 32 -F 4 "
+                  "-I NHWC -f NHWC -O NHWC")),
+              std::vector<std::string>{
+                  "32-28-28-3x3-32-28-28-8-1x1-1x1-1x1-0-NHWC-NHWC-NHWC-BF16-W_g32"});
+
+    // Transposed convolutions swap the forward and backward data directions.
+    EXPECT_EQ(Serialize(miopen::ParseConvDriverCommand(
+                  "conv -n 4 -c 64 -H 14 -W 14 -k 32 -y 2 -x 2 -u 2 -v 2 -m trans -F 3")),
+              (std::vector<std::string>{
+                  "64-14-14-2x2-32-28-28-4-0x0-2x2-1x1-0-NCHW-FP32-B",
+                  "32-28-28-2x2-64-14-14-4-0x0-2x2-1x1-0-NCHW-FP32-F",
+              }));
+
+    // 3D convolutions take their defaults from the driver.
+    EXPECT_EQ(Serialize(miopen::ParseConvDriverCommand("conv -_ 3 -n 2 -c 16 -k 16 -F 1")),
+              std::vector<std::string>{
+                  "16-32-32-32-3x3x3-16-30-30-30-2-0x0x0-1x1x1-1x1x1-0-NCDHW-FP32-F"});
+}
+
+TEST(CPU_KdbBuilder_NONE, InvalidDriverCommands)
+{
+    const auto commands = std::vector<std::string>{
+        "",
+        "./bin/MIOpenDriver",
+        "pool -n 16",
+        "conv -n",
+        "conv -n 1x",
+        "conv 16",
+        "conv -_ 4",
+        "conv -m fft",
+        "conv -c 3 -g 2",
+        "conv -F 8",
+        "convint8 -n 16",
+        "conv -U FP8",
+    };
+
+    for(const auto& command : commands)
+        EXPECT_THROW(miopen::ParseConvDriverCommand(command), miopen::Exception) << command;
+}
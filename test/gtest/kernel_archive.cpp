@@ -0,0 +1,120 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/bz2.hpp>
+#include <miopen/kernel_archive.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <fstream>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+struct TestArchive
+{
+    std::vector<char> data;
+    std::vector<std::string> names;
+    std::vector<miopen::KernelArchiveEntry> index;
+
+    void Add(const std::string& name, const std::string& text)
+    {
+        const auto compressed = miopen::compress(std::vector<char>(text.begin(), text.end()));
+        names.push_back(name);
+        index.push_back({nullptr, data.size(), compressed.size(), text.size()});
+        data.insert(data.end(), compressed.begin(), compressed.end());
+    }
+
+    miopen::KernelArchive Make()
+    {
+        for(std::size_t i = 0; i < index.size(); ++i)
+            index[i].name = names[i].c_str();
+        return {data.data(), index.data(), index.size()};
+    }
+};
+
+} // namespace
+
+TEST(CPU_KernelArchive_NONE, Lookup)
+{
+    const std::string first(4096, 'a');
+    std::string second;
+    for(int i = 0; i < 64; ++i)
+        second += "__kernel void k" + std::to_string(i) + "() {}\n";
+
+    TestArchive builder;
+    builder.Add("first.cl", first);
+    builder.Add("second.s", second);
+    const auto archive = builder.Make();
+
+    EXPECT_TRUE(archive.Contains("first.cl"));
+    EXPECT_FALSE(archive.Contains("third.cl"));
+    EXPECT_EQ(archive.GetNames().size(), 2);
+
+    const auto first_view = archive.Get("first.cl");
+    EXPECT_EQ(first_view, first);
+    EXPECT_EQ(archive.Get("second.s"), second);
+    // decompressed only once
+    EXPECT_EQ(archive.Get("first.cl").data(), first_view.data());
+
+    EXPECT_ANY_THROW(archive.Get("third.cl"));
+}
+
+TEST(CPU_KernelArchive_NONE, AddKernels)
+{
+    const miopen::TmpDir test_srcs{"test_kernel_archive"};
+
+    const auto bin_path   = miopen::fs::path(::testing::internal::GetArgvs().front()).parent_path();
+    const auto addkernels = miopen::make_executable_name(bin_path / "addkernels").string();
+
+    const auto header_src = test_srcs / "header.h";
+    const auto kernel_src = test_srcs / "kernel.cl";
+
+    std::ofstream(header_src.c_str()) << "#define VALUE 1" << std::endl;
+    std::ofstream(kernel_src.c_str()) << "#include \"header.h\"\n"
+                                      << "__kernel void k() {}" << std::endl;
+
+    const auto generated = test_srcs / "generated.inc";
+
+    ASSERT_EQ(0,
+              test_srcs.Execute(addkernels,
+                                "-archive MIOPEN_TEST_ARCHIVE -target " + generated.string() +
+                                    " -source " + kernel_src.string() + " " +
+                                    header_src.string()));
+
+    // kernel.cpp.in and kernel_includes.cpp.in declare these symbols as extern.
+    std::stringstream text;
+    text << std::ifstream{generated}.rdbuf();
+    const auto source = text.str();
+    EXPECT_NE(source.find("#include <miopen/kernel_archive.hpp>"), std::string::npos);
+    EXPECT_NE(source.find("MIOPEN_TEST_ARCHIVE[]"), std::string::npos);
+    EXPECT_NE(source.find("const miopen::KernelArchiveEntry MIOPEN_TEST_ARCHIVE_INDEX[] = {"),
+              std::string::npos);
+    EXPECT_NE(source.find("const size_t MIOPEN_TEST_ARCHIVE_INDEX_SIZE = 2;"), std::string::npos);
+    EXPECT_NE(source.find("{ \"kernel.cl\", "), std::string::npos);
+    EXPECT_NE(source.find("{ \"header.h\", "), std::string::npos);
+}
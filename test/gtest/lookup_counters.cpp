@@ -0,0 +1,133 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/db.hpp>
+#include <miopen/lookup_counters.hpp>
+
+#include <gtest/gtest.h>
+
+#include <boost/optional.hpp>
+
+#include <chrono>
+#include <set>
+#include <sstream>
+
+using miopen::LookupCounters;
+using miopen::LookupEvent;
+using miopen::LookupSource;
+
+namespace {
+
+struct FakeDb
+{
+    std::set<int> keys;
+
+    explicit FakeDb(miopen::DbKinds) {}
+
+    boost::optional<int> FindRecord(int key) const
+    {
+        if(keys.count(key) == 0)
+            return boost::none;
+        return key;
+    }
+
+    bool StoreRecord(int key) { return keys.insert(key).second; }
+    bool RemoveRecord(int key) { return keys.erase(key) != 0; }
+};
+
+} // namespace
+
+TEST(CPU_LookupCounters_NONE, CountsEvents)
+{
+    LookupCounters counters;
+    counters.Record(LookupSource::PerfDb, LookupEvent::Hit, std::chrono::nanoseconds{10});
+    counters.Record(LookupSource::PerfDb, LookupEvent::Hit, std::chrono::nanoseconds{20});
+    counters.Record(LookupSource::PerfDb, LookupEvent::Miss, std::chrono::nanoseconds{30});
+    counters.Record(LookupSource::PerfDb, LookupEvent::Store, std::chrono::nanoseconds{40});
+
+    const auto perf_db = counters.Get(LookupSource::PerfDb);
+    EXPECT_EQ(perf_db.hits, 2u);
+    EXPECT_EQ(perf_db.misses, 1u);
+    EXPECT_EQ(perf_db.stores, 1u);
+    EXPECT_EQ(perf_db.latency_ns, 100u);
+
+    const auto find_db = counters.Get(LookupSource::FindDb);
+    EXPECT_EQ(find_db.hits + find_db.misses + find_db.stores + find_db.latency_ns, 0u);
+
+    counters.Reset();
+    EXPECT_EQ(counters.Get(LookupSource::PerfDb).hits, 0u);
+    EXPECT_EQ(counters.Get(LookupSource::PerfDb).latency_ns, 0u);
+}
+
+TEST(CPU_LookupCounters_NONE, ProcessCountsHandleEvents)
+{
+    auto& process       = LookupCounters::Process();
+    const auto before   = process.Get(LookupSource::InvokerCache);
+    auto handle_counter = LookupCounters{};
+
+    miopen::RecordLookup(&handle_counter,
+                         LookupSource::InvokerCache,
+                         LookupEvent::Miss,
+                         std::chrono::nanoseconds{5});
+    miopen::RecordLookup(
+        nullptr, LookupSource::InvokerCache, LookupEvent::Hit, std::chrono::nanoseconds{7});
+
+    EXPECT_EQ(handle_counter.Get(LookupSource::InvokerCache).misses, 1u);
+    EXPECT_EQ(handle_counter.Get(LookupSource::InvokerCache).hits, 0u);
+
+    const auto after = process.Get(LookupSource::InvokerCache);
+    EXPECT_EQ(after.misses - before.misses, 1u);
+    EXPECT_EQ(after.hits - before.hits, 1u);
+    EXPECT_EQ(after.latency_ns - before.latency_ns, 12u);
+}
+
+TEST(CPU_LookupCounters_NONE, DbTimerCountsLookups)
+{
+    auto counters = LookupCounters{};
+    auto db       = miopen::DbTimer<FakeDb>{&counters, miopen::DbKinds::KernelDb};
+
+    auto key = 1;
+    EXPECT_FALSE(db.FindRecord(key));
+    EXPECT_TRUE(db.StoreRecord(key));
+    EXPECT_TRUE(db.FindRecord(key));
+    EXPECT_TRUE(db.RemoveRecord(key));
+
+    const auto kernel_db = counters.Get(LookupSource::KernelDb);
+    EXPECT_EQ(kernel_db.hits, 1u);
+    EXPECT_EQ(kernel_db.misses, 1u);
+    EXPECT_EQ(kernel_db.stores, 1u);
+    EXPECT_EQ(counters.Get(LookupSource::FindDb).hits, 0u);
+}
+
+TEST(CPU_LookupCounters_NONE, PrintsActiveSources)
+{
+    auto counters = LookupCounters{};
+    counters.Record(LookupSource::ProgramCache, LookupEvent::Hit, std::chrono::milliseconds{2});
+
+    std::ostringstream ss;
+    ss << counters;
+
+    EXPECT_EQ(ss.str(), "    program cache: hits 1, misses 0, stores 0, latency 2.000 ms\n");
+}
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/handle.hpp>
+#include <miopen/pending_invokers.hpp>
+
+#include <gtest/gtest.h>
+
+#include "get_handle.hpp"
+
+namespace {
+
+miopen::solver::KernelInfo MakeKernel(const std::string& comp_options)
+{
+    auto kernel         = miopen::solver::KernelInfo{};
+    kernel.comp_options = comp_options;
+    kernel.l_wk         = {256, 1, 1};
+    kernel.g_wk         = {256, 1, 1};
+    kernel.kernel_file  = "MIOpenCheckNumerics.cpp";
+    kernel.kernel_name  = "check_numerics_fp32";
+    return kernel;
+}
+
+miopen::InvokerFactory MakeFactory(std::size_t& n_kernels)
+{
+    return [&n_kernels](const std::vector<miopen::Kernel>& kernels) {
+        n_kernels = kernels.size();
+        return miopen::Invoker{[](const miopen::Handle&, const miopen::AnyInvokeParams&) {}};
+    };
+}
+
+} // namespace
+
+TEST(GPU_PendingInvokers_FP32, BuildsInBackground)
+{
+    auto&& handle      = get_handle();
+    const auto options = std::string{"-DMIOPEN_PENDING_INVOKERS_TEST=1"};
+    const auto kernels = std::vector{MakeKernel(options), MakeKernel(options)};
+    const auto key     = miopen::PendingInvokers::Key{"pending_invokers_test", "Builds"};
+    auto n_kernels     = std::size_t{0};
+    auto pending       = miopen::PendingInvokers{};
+
+    ASSERT_TRUE(pending.Start(handle, key, MakeFactory(n_kernels), kernels));
+    EXPECT_TRUE(pending.IsPending(key));
+    // A second start of the same key joins the running build.
+    EXPECT_TRUE(pending.Start(handle, key, MakeFactory(n_kernels), kernels));
+    EXPECT_EQ(pending.Size(), 1u);
+
+    const auto invoker = pending.Wait(handle, key);
+    ASSERT_TRUE(invoker.has_value());
+    EXPECT_FALSE(pending.IsPending(key));
+    EXPECT_EQ(n_kernels, kernels.size());
+    EXPECT_TRUE(handle.HasProgram(kernels[0].kernel_file, options));
+
+    // The programs are loaded now, so there is nothing left to build.
+    EXPECT_FALSE(pending.Start(handle, key, MakeFactory(n_kernels), kernels));
+    EXPECT_FALSE(pending.Take(handle, key).has_value());
+}
+
+TEST(GPU_PendingInvokers_FP32, RethrowsBuildErrors)
+{
+    auto&& handle      = get_handle();
+    auto kernel        = MakeKernel("-DMIOPEN_PENDING_INVOKERS_TEST=2");
+    kernel.kernel_file = "MIOpenPendingInvokersNoSuchKernel.cpp";
+    const auto key     = miopen::PendingInvokers::Key{"pending_invokers_test", "RethrowsErrors"};
+    auto n_kernels     = std::size_t{0};
+    auto pending       = miopen::PendingInvokers{};
+
+    ASSERT_TRUE(pending.Start(handle, key, MakeFactory(n_kernels), {kernel}));
+    EXPECT_ANY_THROW(pending.Wait(handle, key));
+    EXPECT_FALSE(pending.IsPending(key));
+}
@@ -0,0 +1,208 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/generic_search.hpp>
+#include <miopen/perf_config_catalog.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+using miopen::solver::PerfConfigCatalog;
+using miopen::solver::PerfConfigCatalogEntry;
+
+namespace {
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+std::size_t n_validations = 0;
+
+struct Stream
+{
+    std::string GetDbBasename() const { return "gfx000_1"; }
+};
+
+struct Context
+{
+    Stream stream;
+    bool is_for_generic_search = false;
+    const Stream& GetStream() const { return stream; }
+};
+
+struct NetworkConfig
+{
+    std::string value;
+    const std::string& ToString() const { return value; }
+};
+
+struct Problem
+{
+    std::string network_config;
+    int n_configs;
+    NetworkConfig MakeNetworkConfig() const { return {network_config}; }
+};
+
+/// Odd values of the main set are valid. The spare set is used if there are none.
+struct PerformanceConfig
+{
+    int value  = -1;
+    bool spare = false;
+
+    PerformanceConfig() = default;
+    explicit PerformanceConfig(bool spare_) : value(0), spare(spare_) {}
+
+    bool SetNextValue(const Problem& problem) { return ++value < problem.n_configs; }
+    bool IsValid(const Context&, const Problem&) const
+    {
+        ++n_validations;
+        return spare || value % 2 == 1;
+    }
+    bool operator==(const PerformanceConfig& other) const
+    {
+        return value == other.value && spare == other.spare;
+    }
+    void Serialize(std::ostream& stream) const { stream << value << ',' << spare; }
+    bool Deserialize(const std::string& str)
+    {
+        const auto comma = str.find(',');
+        if(comma == std::string::npos)
+            return false;
+        value = std::stoi(str.substr(0, comma));
+        spare = str.substr(comma + 1) == "1";
+        return true;
+    }
+};
+
+struct Solver
+{
+    std::string SolverDbId() const { return "PerfConfigCatalogTestSolver"; }
+    PerformanceConfig GetDefaultPerformanceConfig(const Context&, const Problem&) const
+    {
+        return PerformanceConfig{false};
+    }
+};
+
+} // namespace
+
+TEST(CPU_PerfConfigCatalog_NONE, StoreAndFind)
+{
+    const miopen::TmpDir dir{"perf_config_catalog"};
+    PerfConfigCatalog catalog{dir.path};
+
+    EXPECT_EQ(catalog.Find("solver problem"), nullptr);
+
+    const auto stored = catalog.Store("solver problem", {false, {"1,0", "3,0"}});
+    EXPECT_EQ(catalog.Find("solver problem"), stored);
+    EXPECT_TRUE(stored->Contains("3,0"));
+    EXPECT_FALSE(stored->Contains("2,0"));
+
+    // Another process reads the entry from the file.
+    PerfConfigCatalog other{dir.path};
+    const auto loaded = other.Find("solver problem");
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_FALSE(loaded->IsSpare());
+    EXPECT_EQ(loaded->Configs(), std::vector<std::string>({"1,0", "3,0"}));
+    EXPECT_EQ(other.Find("solver other"), nullptr);
+
+    // Solvers without valid configs are stored as well, so they are not enumerated again.
+    other.Store("solver empty", {true, {}});
+    const auto empty = PerfConfigCatalog{dir.path}.Find("solver empty");
+    ASSERT_NE(empty, nullptr);
+    EXPECT_TRUE(empty->IsSpare());
+    EXPECT_TRUE(empty->Configs().empty());
+}
+
+TEST(CPU_PerfConfigCatalog_NONE, RejectsStaleEntries)
+{
+    const miopen::TmpDir dir{"perf_config_catalog"};
+    PerfConfigCatalog catalog{dir.path};
+    catalog.Store("solver problem", {false, {"1,0"}});
+
+    for(const auto& file : miopen::fs::directory_iterator{dir.path})
+    {
+        if(file.path().extension() != ".txt")
+            continue;
+        // Written by another version of the library.
+        std::ofstream out{file.path(), std::ios::trunc};
+        out << "stale\nsolver problem\nprimary\n1,0\n";
+    }
+
+    EXPECT_EQ(PerfConfigCatalog{dir.path}.Find("solver problem"), nullptr);
+
+    catalog.Remove("solver problem");
+    EXPECT_EQ(catalog.Find("solver problem"), nullptr);
+}
+
+TEST(CPU_PerfConfigCatalog_NONE, IgnoresUnwritableDirectory)
+{
+    const miopen::TmpDir dir{"perf_config_catalog"};
+    const auto path = dir / "not_a_directory";
+    std::ofstream{path} << "neither entries nor lock files can be created in a file";
+
+    PerfConfigCatalog catalog{path};
+    EXPECT_NO_THROW(catalog.Store("solver problem", {false, {"1,0"}}));
+    ASSERT_NE(catalog.Find("solver problem"), nullptr);
+
+    EXPECT_NO_THROW(catalog.Remove("solver problem"));
+    EXPECT_EQ(catalog.Find("solver problem"), nullptr);
+}
+
+TEST(CPU_PerfConfigCatalog_NONE, InMemory)
+{
+    PerfConfigCatalog catalog{miopen::fs::path{}};
+    catalog.Store("solver problem", {false, {"1,0"}});
+    ASSERT_NE(catalog.Find("solver problem"), nullptr);
+    EXPECT_EQ(PerfConfigCatalog{miopen::fs::path{}}.Find("solver problem"), nullptr);
+}
+
+TEST(CPU_PerfConfigCatalog_NONE, EnumeratesOnce)
+{
+    if(miopen::solver::GetPerfConfigCatalog() == nullptr)
+        GTEST_SKIP() << "The perf config catalog is disabled";
+
+    // The key must be new to the catalog, which may be shared with earlier runs.
+    const miopen::TmpDir dir{"perf_config_catalog"};
+    const auto context = Context{};
+    const auto problem = Problem{dir.path.string(), 8};
+
+    n_validations      = 0;
+    const auto configs = miopen::solver::GetAllConfigs(Solver{}, context, problem);
+    ASSERT_EQ(configs.size(), 4u);
+    EXPECT_EQ(configs.front().value, 1);
+    EXPECT_EQ(configs.back().value, 7);
+    EXPECT_GT(n_validations, 0u);
+
+    n_validations = 0;
+    EXPECT_EQ(miopen::solver::GetAllConfigs(Solver{}, context, problem), configs);
+    EXPECT_EQ(n_validations, 0u);
+
+    // Only the spare set is valid.
+    const auto spare_problem = Problem{dir.path.string() + " spare", 1};
+    const auto spare         = miopen::solver::GetAllConfigs(Solver{}, context, spare_problem);
+    ASSERT_EQ(spare.size(), 1u);
+    EXPECT_TRUE(spare.front().spare);
+}
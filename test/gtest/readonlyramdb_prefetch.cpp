@@ -0,0 +1,94 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/db_record.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/readonlyramdb.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+
+using namespace std::string_literals;
+
+namespace {
+
+constexpr auto Kind = miopen::DbKinds::PerfDb;
+
+struct Value
+{
+    std::string value;
+
+    void Serialize(std::ostream& stream) const { stream << value; }
+
+    bool Deserialize(const std::string& str)
+    {
+        value = str;
+        return true;
+    }
+};
+
+void WriteDb(const miopen::fs::path& path, int records)
+{
+    auto file = std::ofstream{path};
+    for(auto i = 0; i < records; ++i)
+        file << "key" << i << "=id:value" << i << '\n';
+}
+
+} // namespace
+
+TEST(CPU_ReadonlyRamDbPrefetch_NONE, LookupWaitsForBackgroundLoad)
+{
+    const auto dir  = miopen::TmpDir{"rordb_prefetch"};
+    const auto path = dir.path / "prefetched.db.txt";
+    constexpr auto records = 20000;
+    WriteDb(path, records);
+
+    miopen::ReadonlyRamDb::PrefetchAsync(Kind, path, true);
+    // A second request for the same path must not start another load.
+    miopen::ReadonlyRamDb::PrefetchAsync(Kind, path, true);
+
+    const auto& db = miopen::ReadonlyRamDb::GetCached(Kind, path, true);
+    EXPECT_EQ(db.GetCacheMap().size(), records);
+    EXPECT_EQ(&db, &miopen::ReadonlyRamDb::GetCached(Kind, path, true));
+
+    auto value        = Value{};
+    const auto record = db.FindRecord("key" + std::to_string(records - 1));
+    ASSERT_TRUE(record);
+    ASSERT_TRUE(record->GetValues("id", value));
+    EXPECT_EQ(value.value, "value" + std::to_string(records - 1));
+    EXPECT_FALSE(db.FindRecord("key"s + std::to_string(records)));
+}
+
+TEST(CPU_ReadonlyRamDbPrefetch_NONE, MissingFileLoadsEmpty)
+{
+    const auto dir  = miopen::TmpDir{"rordb_prefetch"};
+    const auto path = dir.path / "missing.db.txt";
+
+    miopen::ReadonlyRamDb::PrefetchAsync(Kind, path, false);
+    EXPECT_TRUE(miopen::ReadonlyRamDb::GetCached(Kind, path, false).GetCacheMap().empty());
+}
@@ -0,0 +1,260 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/handle.hpp>
+#include <miopen/hipoc_program.hpp>
+#include <miopen/shared_program_cache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr auto params = "-DMIOPEN_TEST=1";
+
+// There is nothing to compile, an empty implementation is enough to tell the programs apart.
+miopen::Program MakeProgram(const std::string& name)
+{
+    auto program          = miopen::Program{};
+    program.impl          = std::make_shared<miopen::HIPOCProgramImpl>();
+    program.impl->program = name;
+    return program;
+}
+
+std::string ProgramName(const std::string& test, std::size_t i)
+{
+    return "shared_program_cache_" + test + "_" + std::to_string(i) + ".cpp";
+}
+
+template <class F>
+void RunThreads(std::size_t n_threads, F f)
+{
+    auto threads = std::vector<std::thread>{};
+    threads.reserve(n_threads);
+    for(auto i = 0; i < n_threads; ++i)
+        threads.emplace_back([&f, i]() { f(i); });
+    for(auto& thread : threads)
+        thread.join();
+}
+
+} // namespace
+
+TEST(CPU_SharedProgramCache_NONE, ConcurrentRequestsLoadOnce)
+{
+    constexpr std::size_t n_threads  = 8;
+    constexpr std::size_t n_programs = 16;
+
+    auto& cache = miopen::SharedProgramCache::Instance();
+    cache.ResetStats();
+
+    std::atomic<std::size_t> loads_performed{0};
+    std::mutex mutex;
+    auto results = std::vector<std::vector<miopen::Program>>(n_programs);
+
+    RunThreads(n_threads, [&](std::size_t thread) {
+        for(auto i = 0; i < n_programs; ++i)
+        {
+            // Every thread starts from a different program, so that loads overlap.
+            const auto name    = ProgramName("load_once", (i + thread) % n_programs);
+            const auto program = cache.GetOrLoad("test", name, params, [&]() {
+                ++loads_performed;
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                return MakeProgram(name);
+            });
+
+            std::lock_guard<std::mutex> lock(mutex);
+            results[(i + thread) % n_programs].push_back(program);
+        }
+    });
+
+    EXPECT_EQ(loads_performed, n_programs);
+    for(const auto& programs : results)
+    {
+        ASSERT_EQ(programs.size(), n_threads);
+        for(const auto& program : programs)
+            EXPECT_EQ(program, programs.front());
+    }
+
+    const auto stats = cache.GetStats();
+    EXPECT_EQ(stats.loads, n_programs);
+    EXPECT_EQ(stats.hits + stats.waits, n_threads * n_programs - n_programs);
+    EXPECT_EQ(stats.failures, 0);
+}
+
+TEST(CPU_SharedProgramCache_NONE, FailureIsPropagatedAndRetried)
+{
+    constexpr std::size_t n_threads = 4;
+
+    auto& cache = miopen::SharedProgramCache::Instance();
+    cache.ResetStats();
+
+    const auto name = ProgramName("failure", 0);
+    std::atomic<std::size_t> loads_performed{0};
+    std::atomic<std::size_t> errors{0};
+
+    RunThreads(n_threads, [&](std::size_t) {
+        try
+        {
+            std::ignore = cache.GetOrLoad("test", name, params, [&]() -> miopen::Program {
+                ++loads_performed;
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                throw std::runtime_error("compilation failed");
+            });
+        }
+        catch(const std::runtime_error&)
+        {
+            ++errors;
+        }
+    });
+
+    // Threads that came after the failure start a new load, which fails as well.
+    EXPECT_EQ(errors, n_threads);
+    EXPECT_GE(loads_performed, 1);
+    EXPECT_EQ(cache.GetStats().failures, loads_performed);
+
+    const auto program = cache.GetOrLoad("test", name, params, [&]() {
+        ++loads_performed;
+        return MakeProgram(name);
+    });
+    EXPECT_EQ(program.impl->program, name);
+    EXPECT_EQ(cache.GetStats().loads, loads_performed);
+}
+
+TEST(CPU_SharedProgramCache_NONE, ProgramsAreOwnedByTheUsers)
+{
+    auto& cache = miopen::SharedProgramCache::Instance();
+
+    const auto name = ProgramName("ownership", 0);
+    auto loads      = 0;
+    const auto load = [&]() {
+        ++loads;
+        return MakeProgram(name);
+    };
+
+    {
+        const auto program = cache.GetOrLoad("test", name, params, load);
+        EXPECT_EQ(cache.GetOrLoad("test", name, params, load), program);
+        EXPECT_EQ(cache.Find("test", name, params), program);
+        EXPECT_EQ(cache.Find("other", name, params), std::nullopt);
+        EXPECT_EQ(loads, 1);
+    }
+
+    // Nobody holds the program anymore, so it has been released.
+    EXPECT_EQ(cache.Find("test", name, params), std::nullopt);
+    std::ignore = cache.GetOrLoad("test", name, params, load);
+    EXPECT_EQ(loads, 2);
+}
+
+TEST(CPU_SharedProgramCache_NONE, ReleasedProgramsAreDropped)
+{
+    auto& cache = miopen::SharedProgramCache::Instance();
+    cache.Clear();
+
+    // A long-running process cycling through program variants, none of which stays alive.
+    const auto kept = cache.GetOrLoad(
+        "test", ProgramName("dropped", 0), params, [&]() { return MakeProgram("kept"); });
+    for(auto i = 1; i < 1000; ++i)
+    {
+        const auto name = ProgramName("dropped", i);
+        const auto load = [&]() { return MakeProgram(name); };
+        std::ignore     = cache.GetOrLoad("test", name, params, load);
+    }
+    EXPECT_LT(cache.Size(), 200);
+    EXPECT_EQ(cache.Find("test", ProgramName("dropped", 0), params), kept);
+
+    // A lookup of a released program drops its entry.
+    const auto size = cache.Size();
+    EXPECT_EQ(cache.Find("test", ProgramName("dropped", 999), params), std::nullopt);
+    EXPECT_EQ(cache.Size(), size - 1);
+}
+
+TEST(CPU_SharedProgramCache_NONE, ProgramsAreSharedBetweenHandles)
+{
+    constexpr std::size_t n_threads  = 4;
+    constexpr std::size_t n_programs = 8;
+    constexpr std::size_t n_rounds   = 16;
+
+    auto& cache = miopen::SharedProgramCache::Instance();
+    cache.ResetStats();
+
+    // Handles are created on the worker threads, one per thread, like a server would do.
+    auto handles = std::vector<std::unique_ptr<miopen::Handle>>(n_threads);
+    RunThreads(n_threads, [&](std::size_t thread) {
+        handles[thread] = std::make_unique<miopen::Handle>();
+    });
+
+    const auto scope = handles.front()->GetProgramCacheScope();
+    ASSERT_FALSE(scope.empty());
+    for(const auto& handle : handles)
+        EXPECT_EQ(handle->GetProgramCacheScope(), scope);
+
+    // A program added to one handle is visible from the others.
+    const auto added = MakeProgram(ProgramName("handles", n_programs));
+    handles.front()->AddProgram(added, ProgramName("handles", n_programs), params);
+    for(const auto& handle : handles)
+        EXPECT_TRUE(handle->HasProgram(ProgramName("handles", n_programs), params));
+
+    std::atomic<std::size_t> loads_performed{0};
+
+    RunThreads(n_threads, [&](std::size_t thread) {
+        const auto& handle = *handles[thread];
+        for(auto round = 0; round < n_rounds; ++round)
+        {
+            for(auto i = 0; i < n_programs; ++i)
+            {
+                const auto name = ProgramName("handles", (i + thread + round) % n_programs);
+                const auto load = [&]() {
+                    ++loads_performed;
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    return MakeProgram(name);
+                };
+                // This is what the kernel cache of the handle does for a program it has not seen.
+                if(!handle.HasProgram(name, params))
+                {
+                    const auto program =
+                        cache.GetOrLoad(handle.GetProgramCacheScope(), name, params, load);
+                    handle.AddProgram(program, name, params);
+                }
+            }
+        }
+    });
+
+    EXPECT_EQ(loads_performed, n_programs);
+    EXPECT_EQ(cache.GetStats().loads, n_programs);
+    EXPECT_EQ(cache.GetStats().failures, 0);
+
+    // Clearing a program from one handle makes the handles created later load it again.
+    handles.back()->ClearProgram(ProgramName("handles", n_programs), params);
+    EXPECT_EQ(cache.Find(scope, ProgramName("handles", n_programs), params), std::nullopt);
+}
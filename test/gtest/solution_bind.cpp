@@ -0,0 +1,217 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/data_invoke_params.hpp>
+#include <miopen/conv/wrw_invoke_params.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/solution.hpp>
+
+#include <gtest/gtest.h>
+
+#include "get_handle.hpp"
+
+#include <array>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+/// Buffers and descriptors as seen by the invoker, in the x, w, y order.
+struct InvokedWith
+{
+    std::array<ConstData_t, 3> buffers{};
+    std::array<std::vector<std::size_t>, 3> lengths;
+    Data_t workspace           = nullptr;
+    std::size_t workspace_size = 0;
+    std::size_t calls          = 0;
+
+    void Record(miopenProblemDirection_t direction, const miopen::AnyInvokeParams& params)
+    {
+        ++calls;
+        workspace      = params.GetWorkspace();
+        workspace_size = params.GetWorkspaceSize();
+
+        if(direction == miopenProblemDirectionBackwardWeights)
+        {
+            const auto& tensors = params.CastTo<miopen::conv::WrWInvokeParams>().tensors;
+            buffers             = {tensors.x, tensors.dw, tensors.dy};
+            lengths             = {tensors.xDesc.GetLengths(),
+                       tensors.dwDesc.GetLengths(),
+                       tensors.dyDesc.GetLengths()};
+            return;
+        }
+
+        const auto& tensors = params.CastTo<miopen::conv::DataInvokeParams>().tensors;
+        if(direction == miopenProblemDirectionForward)
+        {
+            buffers = {tensors.in, tensors.w, tensors.out};
+            lengths = {tensors.inDesc.GetLengths(),
+                       tensors.wDesc.GetLengths(),
+                       tensors.outDesc.GetLengths()};
+        }
+        else
+        {
+            buffers = {tensors.out, tensors.w, tensors.in};
+            lengths = {tensors.outDesc.GetLengths(),
+                       tensors.wDesc.GetLengths(),
+                       tensors.inDesc.GetLengths()};
+        }
+    }
+};
+
+struct BindTestCase
+{
+    miopenProblemDirection_t direction;
+    miopenConvolutionMode_t mode;
+};
+
+class GPU_SolutionBind_FP32 : public ::testing::TestWithParam<BindTestCase>
+{
+protected:
+    void SetUp() override
+    {
+        const auto test_case = GetParam();
+        const auto conv =
+            miopen::ConvolutionDescriptor{2, test_case.mode, miopenPaddingDefault, {1, 1}};
+        const bool transposed = test_case.mode == miopenTranspose;
+        const auto make_desc  = [](std::size_t c) {
+            return miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{2, c, 16, 16}};
+        };
+
+        auto problem = miopen::Problem{};
+        problem.SetOperatorDescriptor(conv);
+        problem.SetDirection(test_case.direction);
+        problem.RegisterTensorDescriptor(miopenTensorConvolutionX, make_desc(transposed ? 16 : 8));
+        problem.RegisterTensorDescriptor(
+            miopenTensorConvolutionW,
+            miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{16, 8, 3, 3}});
+        problem.RegisterTensorDescriptor(miopenTensorConvolutionY, make_desc(transposed ? 8 : 16));
+
+        solution = miopen::Solution{miopen::solver::Id{}, 0.0f, 0};
+        solution.SetProblem(miopen::ProblemContainer{problem});
+        solution.SetInvoker(
+            [this, direction = test_case.direction](const miopen::Handle&,
+                                                    const miopen::AnyInvokeParams& params) {
+                invoked.Record(direction, params);
+            });
+    }
+
+    /// Runs the unbound solution and returns what the invoker has seen.
+    InvokedWith RunUnbound(Data_t x, Data_t w, Data_t y)
+    {
+        invoked = {};
+        solution.Run(get_handle(),
+                     {{miopenTensorConvolutionX, x},
+                      {miopenTensorConvolutionW, w},
+                      {miopenTensorConvolutionY, y}},
+                     nullptr,
+                     0);
+        return invoked;
+    }
+
+    miopen::Solution solution;
+    InvokedWith invoked;
+    std::array<char, 6> storage{};
+};
+
+} // namespace
+
+TEST_P(GPU_SolutionBind_FP32, MatchesRun)
+{
+#if MIOPEN_BACKEND_HIP
+    auto&& handle = get_handle();
+
+    // The order of buffers is defined by the order of arguments, not by their ids.
+    const auto arguments = std::vector<miopenTensorArgumentId_t>{
+        miopenTensorConvolutionY, miopenTensorConvolutionX, miopenTensorConvolutionW};
+    auto bound = solution.Bind(handle,
+                               arguments,
+                               {{miopenTensorConvolutionX, {}},
+                                {miopenTensorConvolutionW, {}},
+                                {miopenTensorConvolutionY, {}}});
+
+    for(auto i = 0; i < 2; ++i)
+    {
+        const auto x = DataCast(&storage[3 * i]);
+        const auto w = DataCast(&storage[3 * i + 1]);
+        const auto y = DataCast(&storage[3 * i + 2]);
+
+        const auto expected = RunUnbound(x, w, y);
+
+        invoked            = {};
+        const auto buffers = std::array<Data_t, 3>{y, x, w};
+        bound.Run(handle, buffers.data(), buffers.size(), nullptr, 0);
+
+        ASSERT_EQ(invoked.calls, 1u);
+        EXPECT_EQ(invoked.buffers, expected.buffers);
+        EXPECT_EQ(invoked.lengths, expected.lengths);
+        EXPECT_EQ(invoked.workspace, expected.workspace);
+        EXPECT_EQ(invoked.workspace_size, expected.workspace_size);
+    }
+
+    EXPECT_ANY_THROW(bound.Run(handle, nullptr, 2, nullptr, 0));
+#else
+    GTEST_SKIP() << "Invokers can only be attached to solutions with the HIP backend";
+#endif
+}
+
+TEST(GPU_SolutionBindArguments_FP32, MissingArgument)
+{
+    auto problem = miopen::Problem{};
+    problem.SetOperatorDescriptor(miopen::ConvolutionDescriptor{});
+    problem.SetDirection(miopenProblemDirectionForward);
+    problem.RegisterTensorDescriptor(
+        miopenTensorConvolutionX,
+        miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{1, 1, 4, 4}});
+    problem.RegisterTensorDescriptor(
+        miopenTensorConvolutionW,
+        miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{1, 1, 1, 1}});
+    problem.RegisterTensorDescriptor(
+        miopenTensorConvolutionY,
+        miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{1, 1, 4, 4}});
+
+    auto solution = miopen::Solution{miopen::solver::Id{}, 0.0f, 0};
+    solution.SetProblem(miopen::ProblemContainer{problem});
+    solution.SetInvoker([](const miopen::Handle&, const miopen::AnyInvokeParams&) {});
+
+    const auto arguments =
+        std::vector<miopenTensorArgumentId_t>{miopenTensorConvolutionX, miopenTensorConvolutionW};
+    EXPECT_ANY_THROW(std::ignore = solution.Bind(get_handle(),
+                                                 arguments,
+                                                 {{miopenTensorConvolutionX, {}},
+                                                  {miopenTensorConvolutionW, {}},
+                                                  {miopenTensorConvolutionY, {}}}));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Full,
+    GPU_SolutionBind_FP32,
+    testing::Values(BindTestCase{miopenProblemDirectionForward, miopenConvolution},
+                    BindTestCase{miopenProblemDirectionBackward, miopenConvolution},
+                    BindTestCase{miopenProblemDirectionBackwardWeights, miopenConvolution},
+                    BindTestCase{miopenProblemDirectionForward, miopenTranspose},
+                    BindTestCase{miopenProblemDirectionBackward, miopenTranspose}));
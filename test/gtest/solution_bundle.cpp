@@ -0,0 +1,220 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/convolution.hpp>
+#include <miopen/env.hpp>
+#include <miopen/filesystem.hpp>
+#include <miopen/hipoc_program.hpp>
+#include <miopen/problem.hpp>
+#include <miopen/solution.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <fstream>
+#include <vector>
+
+// Loaded code objects are not turned into modules when the target is given, so no device is needed.
+MIOPEN_DECLARE_ENV_VAR_STR(MIOPEN_DEVICE_ARCH)
+
+namespace {
+
+constexpr std::size_t BinarySize = 64 * 1024;
+
+miopen::Problem MakeProblem()
+{
+    auto problem = miopen::Problem{};
+    problem.SetOperatorDescriptor(miopen::ConvolutionDescriptor{});
+    problem.SetDirection(miopenProblemDirectionForward);
+    problem.RegisterTensorDescriptor(
+        miopenTensorConvolutionX,
+        miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{1, 1, 4, 4}});
+    problem.RegisterTensorDescriptor(
+        miopenTensorConvolutionW,
+        miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{1, 1, 1, 1}});
+    problem.RegisterTensorDescriptor(
+        miopenTensorConvolutionY,
+        miopen::TensorDescriptor{miopenFloat, std::vector<std::size_t>{1, 1, 4, 4}});
+    return problem;
+}
+
+// Programs with a code object attached in memory do not need a device to be serialized.
+miopen::Program MakeProgram(char fill)
+{
+    auto program = miopen::Program{};
+    program.impl = std::make_shared<miopen::HIPOCProgramImpl>();
+    program.AttachBinary(std::vector<char>(BinarySize, fill));
+    return program;
+}
+
+miopen::Solution MakeSolution(const char* solver,
+                              float time,
+                              const std::vector<miopen::Program>& programs = {})
+{
+    auto solution = miopen::Solution{miopen::solver::Id{solver}, time, 1024};
+    solution.SetProblem(miopen::ProblemContainer{MakeProblem()});
+    solution.SetPerfConfig("1,2,3");
+
+    auto kernels = std::vector<miopen::solver::KernelInfo>(programs.size());
+    for(auto& kernel : kernels)
+    {
+        kernel.kernel_name = "kernel";
+        kernel.kernel_file = "kernel.s";
+        kernel.l_wk        = {64, 1, 1};
+        kernel.g_wk        = {256, 1, 1};
+    }
+    solution.SetInvoker(
+        [](const miopen::Handle&, const miopen::AnyInvokeParams&) {}, programs, kernels);
+    return solution;
+}
+
+} // namespace
+
+TEST(CPU_SolutionBundle_NONE, DeduplicatesBinaries)
+{
+    const miopen::TmpDir dir{"solution_bundle"};
+    const auto path = dir / "bundle";
+
+    // Distinct programs with the same code object are stored once as well.
+    const auto shared    = MakeProgram('a');
+    const auto same      = MakeProgram('a');
+    const auto different = MakeProgram('b');
+
+    const auto first  = MakeSolution("ConvDirectNaiveConvFwd", 1.0f, {shared});
+    const auto second = MakeSolution("ConvDirectNaiveConvBwd", 2.0f, {shared, same});
+    const auto third  = MakeSolution("ConvDirectNaiveConvWrw", 3.0f, {different});
+
+    miopen::SolutionBundle::Save(path, {&first, &second, &third});
+
+    EXPECT_EQ(miopen::SolutionBundle::GetSize(path), 3u);
+    EXPECT_GT(miopen::fs::file_size(path), 2 * BinarySize);
+    EXPECT_LT(miopen::fs::file_size(path), 3 * BinarySize);
+}
+
+TEST(CPU_SolutionBundle_NONE, LoadsMetadata)
+{
+    const miopen::TmpDir dir{"solution_bundle"};
+    const auto path = dir / "bundle";
+
+    const auto first  = MakeSolution("ConvDirectNaiveConvFwd", 1.0f);
+    const auto second = MakeSolution("ConvDirectNaiveConvBwd", 2.0f);
+
+    miopen::SolutionBundle::Save(path, {&first, &second});
+    const auto loaded = miopen::SolutionBundle::Load(path);
+
+    ASSERT_EQ(loaded.size(), 2u);
+    EXPECT_EQ(loaded[0].GetSolver(), first.GetSolver());
+    EXPECT_EQ(loaded[1].GetSolver(), second.GetSolver());
+    EXPECT_EQ(loaded[1].GetTime(), 2.0f);
+    EXPECT_EQ(loaded[1].GetWorkspaceSize(), 1024u);
+    EXPECT_TRUE(loaded[0].GetKernels().empty());
+}
+
+TEST(CPU_SolutionBundle_NONE, RejectsInvalidFile)
+{
+    const miopen::TmpDir dir{"solution_bundle"};
+    const auto path = dir / "bundle";
+
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "definitely not a solution bundle, but long enough to hold a header";
+    }
+
+    EXPECT_ANY_THROW(miopen::SolutionBundle::GetSize(path));
+    EXPECT_ANY_THROW(miopen::SolutionBundle::Load(path));
+    EXPECT_ANY_THROW(miopen::SolutionBundle::Load(dir / "missing"));
+}
+
+TEST(CPU_SolutionBundle_NONE, SavesLoadedSolutionsToTheSamePath)
+{
+    const miopen::TmpDir dir{"solution_bundle"};
+    const auto path = dir / "bundle";
+    miopen::env::update(MIOPEN_DEVICE_ARCH, "gfx90a");
+
+    const auto first  = MakeSolution("ConvDirectNaiveConvFwd", 1.0f, {MakeProgram('a')});
+    const auto second = MakeSolution("ConvDirectNaiveConvBwd", 2.0f, {MakeProgram('b')});
+    miopen::SolutionBundle::Save(path, {&first, &second});
+
+    // The code objects of the loaded solutions are mapped from the file being replaced.
+    const auto loaded = miopen::SolutionBundle::Load(path);
+    ASSERT_EQ(loaded.size(), 2u);
+    miopen::SolutionBundle::Save(path, {&loaded[1], &loaded[0]});
+
+    const auto reloaded = miopen::SolutionBundle::Load(path);
+    ASSERT_EQ(reloaded.size(), 2u);
+    EXPECT_EQ(reloaded[0].GetSolver(), second.GetSolver());
+    EXPECT_EQ(reloaded[1].GetSolver(), first.GetSolver());
+
+    const auto is_filled = [](const miopen::Solution& solution, char fill) {
+        const auto binary = solution.GetKernels().at(0).program.GetMappedCodeObject();
+        return binary.size() == BinarySize &&
+               std::all_of(binary.begin(), binary.end(), [&](char c) { return c == fill; });
+    };
+    EXPECT_TRUE(is_filled(reloaded[0], 'b'));
+    EXPECT_TRUE(is_filled(reloaded[1], 'a'));
+    // The solutions loaded before still see the old contents.
+    EXPECT_TRUE(is_filled(loaded[0], 'a'));
+    EXPECT_TRUE(is_filled(loaded[1], 'b'));
+
+    miopen::env::clear(MIOPEN_DEVICE_ARCH);
+}
+
+TEST(CPU_SolutionBundle_NONE, RejectsCorruptTables)
+{
+    const miopen::TmpDir dir{"solution_bundle"};
+    const auto path = dir / "bundle";
+    miopen::env::update(MIOPEN_DEVICE_ARCH, "gfx90a");
+
+    const auto solution = MakeSolution("ConvDirectNaiveConvFwd", 1.0f, {MakeProgram('a')});
+    miopen::SolutionBundle::Save(path, {&solution});
+    ASSERT_EQ(miopen::SolutionBundle::Load(path).size(), 1u);
+
+    // Offsets of the counts in the header.
+    constexpr std::streamoff SolutionCount = 24;
+    constexpr std::streamoff BinaryCount   = 32;
+
+    // The only code object is at the end of the file.
+    const auto binary_offset = static_cast<std::streamoff>(miopen::fs::file_size(path) - 1);
+
+    const auto patch = [&](std::streamoff offset, const auto& value) {
+        auto file = std::fstream{path, std::ios::binary | std::ios::in | std::ios::out};
+        file.seekp(offset);
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+
+    patch(binary_offset, 'b');
+    EXPECT_ANY_THROW(miopen::SolutionBundle::Load(path));
+
+    patch(SolutionCount, ~std::uint64_t{0} / 8);
+    EXPECT_ANY_THROW(miopen::SolutionBundle::Load(path));
+
+    patch(SolutionCount, std::uint64_t{1});
+    patch(BinaryCount, ~std::uint64_t{0});
+    EXPECT_ANY_THROW(miopen::SolutionBundle::Load(path));
+
+    miopen::env::clear(MIOPEN_DEVICE_ARCH);
+}
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/tmp_dir.hpp>
+#include <miopen/tuning_queue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using miopen::solver::TuningQueue;
+using miopen::solver::TuningUnitState;
+
+namespace {
+
+std::vector<std::string> MakeConfigs(std::size_t count)
+{
+    std::vector<std::string> configs;
+    for(std::size_t i = 0; i < count; ++i)
+        configs.emplace_back(std::to_string(i) + ",1,1");
+    return configs;
+}
+
+} // namespace
+
+TEST(CPU_TuningQueue_NONE, Enqueue)
+{
+    const miopen::TmpDir dir{"tuning_queue"};
+    TuningQueue queue{dir / "queue.txt"};
+
+    EXPECT_EQ(queue.Enqueue("solver problem", MakeConfigs(10), 4), 3u);
+    EXPECT_EQ(queue.Count("solver problem"), 3u);
+    EXPECT_EQ(queue.Count("solver problem", TuningUnitState::Pending), 3u);
+
+    // Another worker which has enumerated the same configs does not add them twice.
+    EXPECT_EQ(queue.Enqueue("solver problem", MakeConfigs(10), 4), 0u);
+    EXPECT_EQ(queue.Enqueue("solver other", MakeConfigs(2), 4), 1u);
+
+    // The queue is shared through the file.
+    const TuningQueue reopened{dir / "queue.txt"};
+    EXPECT_EQ(reopened.Count("solver problem"), 3u);
+    EXPECT_EQ(reopened.Count("solver other"), 1u);
+}
+
+TEST(CPU_TuningQueue_NONE, Claim)
+{
+    const miopen::TmpDir dir{"tuning_queue"};
+    TuningQueue queue{dir / "queue.txt"};
+    queue.Enqueue("key", MakeConfigs(4), 2);
+
+    auto compiling = queue.Claim("key", true);
+    ASSERT_TRUE(compiling);
+    EXPECT_EQ(compiling->state, TuningUnitState::Compiling);
+    EXPECT_EQ(compiling->configs, std::vector<std::string>({"0,1,1", "1,1,1"}));
+    compiling->state = TuningUnitState::Compiled;
+    queue.Complete(*compiling);
+
+    // Benchmarking workers take the compiled units first.
+    auto running = queue.Claim("key", false);
+    ASSERT_TRUE(running);
+    EXPECT_EQ(running->chunk, compiling->chunk);
+    EXPECT_EQ(running->state, TuningUnitState::Running);
+
+    auto last = queue.Claim("key", false);
+    ASSERT_TRUE(last);
+    EXPECT_NE(last->chunk, running->chunk);
+
+    EXPECT_FALSE(queue.Claim("key", false));
+    EXPECT_FALSE(queue.Claim("key", true));
+    EXPECT_FALSE(queue.Claim("unknown", false));
+}
+
+TEST(CPU_TuningQueue_NONE, Best)
+{
+    const miopen::TmpDir dir{"tuning_queue"};
+    TuningQueue queue{dir / "queue.txt"};
+    queue.Enqueue("key", MakeConfigs(6), 2);
+
+    EXPECT_FALSE(queue.Best("key"));
+
+    const auto times = std::vector<float>{2.5f, 1.5f};
+    for(const auto time : times)
+    {
+        auto unit = queue.Claim("key", false);
+        ASSERT_TRUE(unit);
+        unit->state = TuningUnitState::Done;
+        unit->time  = time;
+        unit->best  = unit->configs.back();
+        queue.Complete(*unit);
+    }
+
+    // All configs of a unit have failed.
+    auto failed = queue.Claim("key", false);
+    ASSERT_TRUE(failed);
+    failed->state = TuningUnitState::Done;
+    queue.Complete(*failed);
+
+    const auto best = queue.Best("key");
+    ASSERT_TRUE(best);
+    EXPECT_EQ(best->best, "3,1,1");
+    EXPECT_FLOAT_EQ(best->time, 1.5f);
+    EXPECT_EQ(queue.Count("key", TuningUnitState::Done), 3u);
+}
+
+#ifndef _WIN32
+TEST(CPU_TuningQueue_NONE, RequeuesClaimsOfDeadWorkers)
+{
+    const miopen::TmpDir dir{"tuning_queue"};
+    TuningQueue queue{dir / "queue.txt"};
+    queue.Enqueue("key", MakeConfigs(4), 2);
+
+    // The worker is killed before it completes its unit.
+    const auto pid = fork();
+    ASSERT_GE(pid, 0);
+    if(pid == 0)
+    {
+        TuningQueue{dir / "queue.txt"}.Claim("key", false);
+        _exit(0);
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+
+    EXPECT_EQ(queue.Count("key", TuningUnitState::Running), 1u);
+
+    auto unit = queue.Claim("key", false);
+    ASSERT_TRUE(unit);
+    EXPECT_EQ(unit->chunk, 0u);
+    EXPECT_EQ(unit->state, TuningUnitState::Running);
+    EXPECT_EQ(queue.Count("key", TuningUnitState::Pending), 1u);
+}
+#endif
+
+TEST(CPU_TuningQueue_NONE, RequeuesExpiredClaims)
+{
+    const miopen::TmpDir dir{"tuning_queue"};
+    const auto path = dir / "queue.txt";
+
+    // Claimed long ago by a worker of another host, whose process cannot be checked.
+    std::ofstream{path} << "key\t0\tcompiling\t0\t\tother-host:1\t1\t0,1,1\n";
+
+    EXPECT_FALSE(TuningQueue{path}.Claim("key", true));
+    EXPECT_EQ(TuningQueue{path}.Count("key", TuningUnitState::Compiling), 1u);
+
+    TuningQueue queue{path, std::chrono::seconds{60}};
+    auto unit = queue.Claim("key", true);
+    ASSERT_TRUE(unit);
+    EXPECT_EQ(unit->state, TuningUnitState::Compiling);
+    EXPECT_NE(unit->owner, "other-host:1");
+    EXPECT_GT(unit->claimed, 1);
+
+    // A fresh claim of a live worker stays.
+    EXPECT_FALSE(queue.Claim("key", true));
+}
@@ -0,0 +1,395 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/conv/heuristics/ai_model_format.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace format = miopen::ai::model_format;
+
+namespace {
+
+struct Shape
+{
+    std::uint32_t rows;
+    std::uint32_t cols;
+
+    bool operator==(const Shape& other) const { return rows == other.rows && cols == other.cols; }
+};
+
+[[noreturn]] void Fail(const std::string& layer, const std::string& message)
+{
+    throw std::runtime_error{layer + ": " + message};
+}
+
+/// frugally-deep stores the weights as base64 encoded float32 split into several strings.
+std::vector<float> DecodeFloats(const nlohmann::json& chunks)
+{
+    auto encoded = std::string{};
+    for(const auto& chunk : chunks)
+        encoded += chunk.get<std::string>();
+
+    constexpr auto alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    auto lookup             = std::array<int, 256>{};
+    lookup.fill(-1);
+    for(auto i = 0; i < 64; ++i)
+        lookup[static_cast<unsigned char>(alphabet[i])] = i;
+
+    auto bytes = std::vector<char>{};
+    auto value = 0u;
+    auto bits  = 0;
+    for(const auto c : encoded)
+    {
+        if(c == '=')
+            break;
+        const auto digit = lookup[static_cast<unsigned char>(c)];
+        if(digit < 0)
+            throw std::runtime_error{"Invalid base64 data"};
+        value = (value << 6) | static_cast<unsigned>(digit);
+        bits += 6;
+        if(bits >= 8)
+        {
+            bits -= 8;
+            bytes.push_back(static_cast<char>((value >> bits) & 0xFF));
+        }
+    }
+
+    if(bytes.size() % sizeof(float) != 0)
+        throw std::runtime_error{"Invalid size of float data"};
+    auto floats = std::vector<float>(bytes.size() / sizeof(float));
+    std::memcpy(floats.data(), bytes.data(), bytes.size());
+    return floats;
+}
+
+class Converter
+{
+public:
+    explicit Converter(const nlohmann::json& model_) : model(model_) {}
+
+    void Run()
+    {
+        const auto& config = model.at("architecture").at("config");
+
+        // The inputs come first, in the order the model takes them.
+        for(const auto& input : config.at("input_layers"))
+        {
+            const auto& name = input.at(0).get<std::string>();
+            const auto layer = std::find_if(
+                config.at("layers").begin(), config.at("layers").end(), [&](const auto& l) {
+                    return l.at("name") == name;
+                });
+            if(layer == config.at("layers").end())
+                Fail(name, "No such input layer");
+            AddInput(*layer);
+        }
+
+        for(const auto& layer : config.at("layers"))
+        {
+            const auto& type = layer.at("class_name").get<std::string>();
+            if(type == "InputLayer")
+                continue;
+            else if(type == "Dense")
+                AddDense(layer);
+            else if(type == "ReLU")
+                AddReLU(layer);
+            else if(type == "Add")
+                AddAdd(layer);
+            else if(type == "Embedding")
+                AddEmbedding(layer);
+            else if(type == "LSTM")
+                AddLSTM(layer);
+            else
+                Fail(layer.at("name"), "Unsupported layer " + type);
+        }
+
+        for(const auto& output : config.at("output_layers"))
+            outputs.push_back(GetOutput(output.at(0), output.at(2)));
+    }
+
+    void Write(std::ostream& out) const
+    {
+        auto header        = format::Header{};
+        std::copy(std::begin(format::Magic), std::end(format::Magic), header.magic);
+        header.version     = format::Version;
+        header.num_nodes   = static_cast<std::uint32_t>(nodes.size());
+        header.num_outputs = static_cast<std::uint32_t>(outputs.size());
+        const auto graph_size =
+            sizeof(header) + nodes.size() * sizeof(format::Node) +
+            outputs.size() * sizeof(format::NodeOutput);
+        header.data_offset = (graph_size + format::DataAlignment - 1) / format::DataAlignment *
+                             format::DataAlignment;
+        header.data_size   = data.size();
+
+        const auto padding = std::vector<char>(header.data_offset - graph_size, 0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(nodes.data()), nodes.size() * sizeof(nodes[0]));
+        out.write(reinterpret_cast<const char*>(outputs.data()),
+                  outputs.size() * sizeof(outputs[0]));
+        out.write(padding.data(), padding.size());
+        out.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(data[0]));
+    }
+
+private:
+    const nlohmann::json& model;
+    std::vector<format::Node> nodes;
+    std::vector<std::vector<Shape>> shapes;
+    std::vector<format::NodeOutput> outputs;
+    std::vector<float> data;
+    std::unordered_map<std::string, std::uint32_t> node_ids;
+
+    static format::Node MakeNode(format::LayerType type)
+    {
+        auto node = format::Node{};
+        node.type = type;
+        std::fill(std::begin(node.weights), std::end(node.weights), format::NoWeights);
+        return node;
+    }
+
+    void AddNode(const nlohmann::json& layer, format::Node node, std::vector<Shape> node_shapes)
+    {
+        const auto& name = layer.at("name").get<std::string>();
+        if(!node_ids.emplace(name, static_cast<std::uint32_t>(nodes.size())).second)
+            Fail(name, "Duplicate layer name");
+        nodes.push_back(node);
+        shapes.push_back(std::move(node_shapes));
+    }
+
+    format::NodeOutput GetOutput(const nlohmann::json& name, const nlohmann::json& index) const
+    {
+        const auto it = node_ids.find(name.get<std::string>());
+        if(it == node_ids.end())
+            Fail(name, "Used before it is defined");
+        const auto output = index.get<std::uint32_t>();
+        if(output >= shapes[it->second].size())
+            Fail(name, "No output " + std::to_string(output));
+        return {it->second, output};
+    }
+
+    Shape GetShape(const format::NodeOutput& output) const
+    {
+        return shapes[output.node][output.output];
+    }
+
+    /// Resolves the inputs of a layer, which must be used only once in the graph.
+    std::vector<format::NodeOutput> GetInputs(const nlohmann::json& layer,
+                                              std::size_t min,
+                                              std::size_t max) const
+    {
+        const auto& name     = layer.at("name").get<std::string>();
+        const auto& inbounds = layer.at("inbound_nodes");
+        if(inbounds.size() != 1)
+            Fail(name, "Shared layers are not supported");
+        auto inputs = std::vector<format::NodeOutput>{};
+        for(const auto& inbound : inbounds.at(0))
+            inputs.push_back(GetOutput(inbound.at(0), inbound.at(2)));
+        if(inputs.size() < min || inputs.size() > max)
+            Fail(name, "Unexpected number of inputs");
+        return inputs;
+    }
+
+    static void SetInputs(format::Node& node, const std::vector<format::NodeOutput>& inputs)
+    {
+        node.num_inputs = static_cast<std::uint32_t>(inputs.size());
+        std::copy(inputs.begin(), inputs.end(), node.inputs);
+    }
+
+    std::uint64_t AddWeights(const nlohmann::json& layer,
+                             const std::string& kind,
+                             std::size_t expected_size)
+    {
+        const auto& name   = layer.at("name").get<std::string>();
+        const auto weights = DecodeFloats(model.at("trainable_params").at(name).at(kind));
+        if(weights.size() != expected_size)
+            Fail(name, "Unexpected size of " + kind);
+        // Every block of weights starts on a cache line, as the data itself does.
+        constexpr auto alignment = format::DataAlignment / sizeof(float);
+        data.resize((data.size() + alignment - 1) / alignment * alignment, 0.0f);
+        const auto offset = data.size();
+        data.insert(data.end(), weights.begin(), weights.end());
+        return offset;
+    }
+
+    static void CheckConfig(const nlohmann::json& layer,
+                            const std::string& key,
+                            const nlohmann::json& expected)
+    {
+        const auto& config = layer.at("config");
+        if(config.contains(key) && config.at(key) != expected)
+            Fail(layer.at("name"), "Unsupported " + key + " " + config.at(key).dump());
+    }
+
+    void AddInput(const nlohmann::json& layer)
+    {
+        const auto& shape = layer.at("config").at("batch_input_shape");
+        auto node         = MakeNode(format::LayerType::Input);
+        if(shape.size() == 2)
+        {
+            node.params[0] = 1;
+            node.params[1] = shape.at(1).get<std::uint32_t>();
+        }
+        else if(shape.size() == 3)
+        {
+            node.params[0] = shape.at(1).get<std::uint32_t>();
+            node.params[1] = shape.at(2).get<std::uint32_t>();
+        }
+        else
+        {
+            Fail(layer.at("name"), "Unsupported input shape " + shape.dump());
+        }
+        AddNode(layer, node, {{node.params[0], node.params[1]}});
+    }
+
+    void AddDense(const nlohmann::json& layer)
+    {
+        CheckConfig(layer, "activation", "linear");
+        const auto inputs = GetInputs(layer, 1, 1);
+        const auto in     = GetShape(inputs[0]);
+        const auto units  = layer.at("config").at("units").get<std::uint32_t>();
+        auto node         = MakeNode(format::LayerType::Dense);
+        SetInputs(node, inputs);
+        node.params[0]  = in.cols;
+        node.params[1]  = units;
+        node.weights[0] = AddWeights(layer, "weights", std::size_t{in.cols} * units);
+        if(layer.at("config").value("use_bias", true))
+            node.weights[1] = AddWeights(layer, "bias", units);
+        AddNode(layer, node, {{in.rows, units}});
+    }
+
+    void AddReLU(const nlohmann::json& layer)
+    {
+        CheckConfig(layer, "max_value", nullptr);
+        CheckConfig(layer, "negative_slope", 0.0);
+        CheckConfig(layer, "threshold", 0.0);
+        const auto inputs = GetInputs(layer, 1, 1);
+        auto node         = MakeNode(format::LayerType::ReLU);
+        SetInputs(node, inputs);
+        AddNode(layer, node, {GetShape(inputs[0])});
+    }
+
+    void AddAdd(const nlohmann::json& layer)
+    {
+        const auto inputs = GetInputs(layer, 2, 2);
+        if(!(GetShape(inputs[0]) == GetShape(inputs[1])))
+            Fail(layer.at("name"), "The shapes of the inputs differ");
+        auto node = MakeNode(format::LayerType::Add);
+        SetInputs(node, inputs);
+        AddNode(layer, node, {GetShape(inputs[0])});
+    }
+
+    void AddEmbedding(const nlohmann::json& layer)
+    {
+        CheckConfig(layer, "mask_zero", false);
+        const auto inputs     = GetInputs(layer, 1, 1);
+        const auto in         = GetShape(inputs[0]);
+        const auto input_dim  = layer.at("config").at("input_dim").get<std::uint32_t>();
+        const auto output_dim = layer.at("config").at("output_dim").get<std::uint32_t>();
+        auto node             = MakeNode(format::LayerType::Embedding);
+        SetInputs(node, inputs);
+        node.params[0]  = input_dim;
+        node.params[1]  = output_dim;
+        node.weights[0] = AddWeights(layer, "weights", std::size_t{input_dim} * output_dim);
+        AddNode(layer, node, {{in.rows * in.cols, output_dim}});
+    }
+
+    void AddLSTM(const nlohmann::json& layer)
+    {
+        CheckConfig(layer, "activation", "tanh");
+        CheckConfig(layer, "recurrent_activation", "sigmoid");
+        CheckConfig(layer, "use_bias", true);
+        CheckConfig(layer, "go_backwards", false);
+        CheckConfig(layer, "stateful", false);
+        CheckConfig(layer, "time_major", false);
+        const auto inputs = GetInputs(layer, 1, 3);
+        if(inputs.size() == 2)
+            Fail(layer.at("name"), "Both initial states are required");
+        const auto in               = GetShape(inputs[0]);
+        const auto units            = layer.at("config").at("units").get<std::uint32_t>();
+        const auto return_sequences = layer.at("config").value("return_sequences", false);
+        for(auto i = std::size_t{1}; i < inputs.size(); ++i)
+        {
+            if(!(GetShape(inputs[i]) == Shape{1, units}))
+                Fail(layer.at("name"), "Unexpected shape of the initial state");
+        }
+
+        auto node = MakeNode(format::LayerType::LSTM);
+        SetInputs(node, inputs);
+        node.params[0]  = in.cols;
+        node.params[1]  = units;
+        node.params[2]  = return_sequences ? 1 : 0;
+        node.weights[0] = AddWeights(layer, "weights", std::size_t{in.cols} * 4 * units);
+        node.weights[1] = AddWeights(layer, "recurrent_weights", std::size_t{units} * 4 * units);
+        node.weights[2] = AddWeights(layer, "bias", std::size_t{4} * units);
+        AddNode(layer, node, {{return_sequences ? in.rows : 1, units}, {1, units}, {1, units}});
+    }
+};
+
+} // namespace
+
+int main(int argn, char** args)
+{
+    if(argn != 3)
+    {
+        std::cerr << "Usage:" << std::endl;
+        std::cerr << args[0] << " input_path output_path" << std::endl;
+        std::cerr << "input_path - path to a TunaNet or KernelTuningNet model in the JSON format "
+                     "of frugally-deep."
+                  << std::endl;
+        std::cerr << "output_path - path to the binary model to write." << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        auto in = std::ifstream{args[1]};
+        if(!in)
+            throw std::runtime_error{"Unable to open the input"};
+        const auto model = nlohmann::json::parse(in);
+
+        auto converter = Converter{model};
+        converter.Run();
+
+        auto out = std::ofstream{args[2], std::ios::binary};
+        converter.Write(out);
+        if(!out)
+            throw std::runtime_error{"Unable to write the output"};
+    }
+    catch(const std::exception& ex)
+    {
+        std::cerr << args[1] << ": " << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
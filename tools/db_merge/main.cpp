@@ -0,0 +1,124 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/db_merge.hpp>
+
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+void PrintUsage(const char* name)
+{
+    std::cerr << "Usage:" << std::endl;
+    std::cerr << name << " --kind find|perf|kernel --output path [--jobs count]"
+              << " [--keep-unknown-solvers] [--keep-orphaned-kernels] input_path..." << std::endl;
+    std::cerr << "path - the database to write, replaced if it exists. Its extension selects the "
+                 "format: .db, .udb, .kdb and .ukdb are SQLite, the rest are text."
+              << std::endl;
+    std::cerr << "count - number of inputs read in parallel, one per hardware thread by default."
+              << std::endl;
+    std::cerr << "input_path - databases of the kind and format of the output. Find-db entries "
+                 "with the best time are kept, of the other entries the one of the last input."
+              << std::endl;
+}
+
+miopen::DbKinds ParseKind(const std::string& kind)
+{
+    if(kind == "find")
+        return miopen::DbKinds::FindDb;
+    if(kind == "perf")
+        return miopen::DbKinds::PerfDb;
+    if(kind == "kernel")
+        return miopen::DbKinds::KernelDb;
+    throw std::invalid_argument{"Unknown database kind " + kind};
+}
+
+} // namespace
+
+int main(int argn, char** args)
+{
+    auto options  = miopen::DbMergeOptions{};
+    auto has_kind = false;
+
+    try
+    {
+        for(auto i = 1; i < argn; ++i)
+        {
+            const auto arg   = std::string{args[i]};
+            const auto value = [&]() {
+                if(i + 1 == argn)
+                    throw std::invalid_argument{"No value for " + arg};
+                return std::string{args[++i]};
+            };
+
+            if(arg == "--kind")
+            {
+                options.kind = ParseKind(value());
+                has_kind     = true;
+            }
+            else if(arg == "--output")
+                options.output = value();
+            else if(arg == "--jobs")
+                options.jobs = std::stoul(value());
+            else if(arg == "--keep-unknown-solvers")
+                options.validate_solvers = false;
+            else if(arg == "--keep-orphaned-kernels")
+                options.drop_orphaned_kernels = false;
+            else if(arg.front() == '-')
+                throw std::invalid_argument{"Unknown argument " + arg};
+            else
+                options.inputs.emplace_back(arg);
+        }
+    }
+    catch(const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        PrintUsage(args[0]);
+        return EXIT_FAILURE;
+    }
+
+    if(!has_kind || options.output.empty() || options.inputs.empty())
+    {
+        PrintUsage(args[0]);
+        return EXIT_FAILURE;
+    }
+
+    try
+    {
+        const auto stats = miopen::MergeDbs(options);
+        std::cout << stats;
+        return stats.unreadable_inputs == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch(const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,159 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2024 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <miopen/kdb_builder.hpp>
+
+#include <cctype>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+void PrintUsage(const char* name)
+{
+    std::cerr << "Usage:" << std::endl;
+    std::cerr << name << " --arch target --num-cu count --output path"
+              << " [--jobs count] [--all-solvers] input_path..." << std::endl;
+    std::cerr << "target - as in MIOPEN_DEVICE_ARCH, e.g. gfx90a:sramecc+:xnack-." << std::endl;
+    std::cerr << "count - number of compute units the database is named after." << std::endl;
+    std::cerr << "path - the kernel database to create or extend, e.g. gfx90a68.kdb." << std::endl;
+    std::cerr << "input_path - text file with a MIOpenDriver convolution command or a problem key "
+                 "per line, find-db files can be used as is."
+              << std::endl;
+}
+
+/// Find-db and perf-db lines are "key=values", the keys start with the input channels.
+bool IsProblemKey(const std::string& line) { return std::isdigit(line.front()) != 0; }
+
+std::string TrimKey(const std::string& line) { return line.substr(0, line.find('=')); }
+
+} // namespace
+
+int main(int argn, char** args)
+{
+    auto options = miopen::KernelDbBuildOptions{};
+    auto inputs  = std::vector<std::string>{};
+
+    try
+    {
+        for(auto i = 1; i < argn; ++i)
+        {
+            const auto arg   = std::string{args[i]};
+            const auto value = [&]() {
+                if(i + 1 == argn)
+                    throw std::invalid_argument{"No value for " + arg};
+                return std::string{args[++i]};
+            };
+
+            if(arg == "--arch")
+                options.arch = value();
+            else if(arg == "--num-cu")
+                options.num_cu = std::stoul(value());
+            else if(arg == "--output")
+                options.output = value();
+            else if(arg == "--jobs")
+                options.jobs = std::stoul(value());
+            else if(arg == "--all-solvers")
+                options.all_solvers = true;
+            else if(arg.front() == '-')
+                throw std::invalid_argument{"Unknown argument " + arg};
+            else
+                inputs.push_back(arg);
+        }
+    }
+    catch(const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        PrintUsage(args[0]);
+        return EXIT_FAILURE;
+    }
+
+    if(options.arch.empty() || options.num_cu == 0 || options.output.empty() || inputs.empty())
+    {
+        PrintUsage(args[0]);
+        return EXIT_FAILURE;
+    }
+
+    auto problems = std::vector<miopen::conv::ProblemDescription>{};
+    for(const auto& input : inputs)
+    {
+        auto file = std::ifstream{input};
+        if(!file)
+        {
+            std::cerr << "Unable to open " << input << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        auto line_num = 0;
+        for(auto line = std::string{}; std::getline(file, line);)
+        {
+            ++line_num;
+            if(line.empty() || line.front() == '#')
+                continue;
+
+            try
+            {
+                if(IsProblemKey(line))
+                {
+                    problems.push_back(miopen::ParseConvProblemKey(TrimKey(line)));
+                }
+                else
+                {
+                    const auto parsed = miopen::ParseConvDriverCommand(line);
+                    problems.insert(problems.end(), parsed.begin(), parsed.end());
+                }
+            }
+            catch(const std::exception& ex)
+            {
+                std::cerr << input << ":" << line_num << ": " << ex.what() << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    try
+    {
+        const auto stats = miopen::BuildKernelDb(problems, options);
+        std::cout << "Problems: " << stats.problems << std::endl;
+        std::cout << "Solutions: " << stats.solutions << std::endl;
+        std::cout << "Kernels: " << stats.kernels << std::endl;
+        std::cout << "Already present: " << stats.present << std::endl;
+        std::cout << "Copied: " << stats.copied << std::endl;
+        std::cout << "Compiled: " << stats.compiled << std::endl;
+        std::cout << "Failed: " << stats.failed << std::endl;
+        return stats.failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    catch(const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+}